@@ -0,0 +1,1442 @@
+#include <stdio.h>      // printf, fprintf, vsnprintf
+#include <stdarg.h>     // va_list
+#include <stdlib.h>     // malloc, calloc, free, strtoul, qsort
+#include <string.h>     // strcmp, strstr
+#include <math.h>       // pow, cbrt, fabs, sqrt, atan2, cos, sin
+#include "chizl_clock.h"    // ChizlNowMs
+#include "main.h"
+
+#if defined(_WIN32) || defined(_WIN64)
+  #include <process.h>      // _beginthreadex
+#else
+  #include <pthread.h>      // pthread_create, pthread_join
+#endif
+
+// Sweeps all 16,777,216 24-bit colors through every conversion and checks two things:
+//   round trip - RGB -> space -> RGB must give the color back, error is the largest channel difference
+//   oracle     - RGB -> space must match a reference written here from the textbook definitions (integer
+//                channel math for HSV / HSL / CMYK, pow() gamma and the CIE constants for XYZ / Lab / Luv,
+//                Ottosson's matrices and cbrt() for OKLab),
+//                error is the largest difference of any component
+// For each check it prints the max error, a histogram, the worst color and the first failing colors, and
+// exits with 1 if any check is over its tolerance.  A new fast path (table, SIMD, float, fixed point) gets a
+// check here next to the path it replaces.
+//
+// The cube is split by red value across threads, each thread sweeps rows of 256 blues so the batch
+// functions see real batches, and per thread results are merged at the end.
+//
+// Functions that don't take one color at a time (gamut boundary, ...) have scenario checks instead:
+// each runs once over inputs of its own, against a brute force or structural oracle, and is listed
+// after the sweep with the same columns.
+
+#define ACCURACY_ROW 256
+#define ACCURACY_MAX_COLOR_SIZE 32             // Largest bytes per color of any space below
+#define ACCURACY_MAX_LISTED 32                 // Failing colors kept per check
+#define ACCURACY_MAX_BUCKETS 6
+#define ACCURACY_MAX_THREADS 256
+
+typedef enum {
+    CHECK_RGB,                  // Round trip, error in 8-bit steps
+    CHECK_VALUE,                // Oracle, error in the space's own units
+    CHECK_STEPS                 // Oracle for the 16-bit spaces, error in 16-bit steps
+} CheckKind;
+
+typedef struct {
+    const char* unit;
+    size_t edgeCount;
+    double edges[ACCURACY_MAX_BUCKETS - 1];     // Bucket i holds errors <= edges[i], the last one the rest
+    const char* labels[ACCURACY_MAX_BUCKETS];
+} CheckKindInfo;
+
+static const CheckKindInfo s_kinds[] = {
+    { "8-bit", 4, { 0.0, 1.0, 2.0, 3.0 }, { "0", "1", "2", "3", "4+" } },
+    { "value", 5, { 0.0, 1e-12, 1e-9, 1e-6, 1e-3 }, { "0", "<=1e-12", "<=1e-9", "<=1e-6", "<=1e-3", ">1e-3" } },
+    { "16-bit", 4, { 0.0, 0.25, 0.5, 1.0 }, { "0", "<=0.25", "<=0.5", "<=1", ">1" } }
+};
+
+// Reference values for one row, shared by every check on that row.
+typedef struct {
+    double hsv[ACCURACY_ROW][3];
+    double hsl[ACCURACY_ROW][3];
+    double cmyk[ACCURACY_ROW][4];
+    double xyz[ACCURACY_ROW][3];
+    double lab[ACCURACY_ROW][3];
+    double luv[ACCURACY_ROW][3];
+    double oklab[ACCURACY_ROW][3];
+} RefRow;
+
+typedef struct {
+    unsigned char space[ACCURACY_ROW * ACCURACY_MAX_COLOR_SIZE];
+    unsigned char planes[ACCURACY_ROW * ACCURACY_MAX_COLOR_SIZE];
+    RgbColor back[ACCURACY_ROW];
+} CheckScratch;
+
+typedef void (*CheckFn)(const RgbColor* rgb, const RefRow* ref, size_t count, double* error, CheckScratch* scratch);
+
+typedef struct {
+    const char* name;
+    CheckKind kind;
+    double tolerance;
+    CheckFn fn;
+} AccuracyCheck;
+
+typedef struct {
+    RgbColor color;
+    double error;
+} FailedColor;
+
+typedef struct {
+    double maxError;
+    RgbColor worst;
+    size_t failures;
+    size_t histogram[ACCURACY_MAX_BUCKETS];
+    FailedColor listed[ACCURACY_MAX_LISTED];
+    size_t listedCount;
+} CheckStats;
+
+static ConversionPlan* s_planRgbToLab = NULL;
+static ConversionPlan* s_planRgbToLchD50 = NULL;
+static ConversionPlan* s_planLchD50ToRgb = NULL;
+
+// --- Reference math ---
+
+static const double s_refWhite[3] = { 95.0489, 100.0, 108.884 };    // WPID_D65_FULL, the library default
+static const double s_cieEpsilon = 216.0 / 24389.0;
+static const double s_cieKappa = 24389.0 / 27.0;
+
+static double RefHue(int r, int g, int b, int max, int delta)
+{
+    if (delta == 0)
+        return 0.0;
+
+    double h;
+    if (max == r)
+        h = 60.0 * (g - b) / delta;
+    else if (max == g)
+        h = 120.0 + 60.0 * (b - r) / delta;
+    else
+        h = 240.0 + 60.0 * (r - g) / delta;
+    return (h < 0.0) ? h + 360.0 : h;
+}
+
+static double RefLinear(int channel)
+{
+    const double c = channel / 255.0;
+    return (c > 0.04045) ? pow((c + 0.055) / 1.055, 2.4) : c / 12.92;
+}
+
+static double RefLabF(double t)
+{
+    return (t > s_cieEpsilon) ? cbrt(t) : (s_cieKappa * t + 16.0) / 116.0;
+}
+
+static void BuildRefRow(const RgbColor* rgb, size_t count, RefRow* ref)
+{
+    const double dn = s_refWhite[0] + 15.0 * s_refWhite[1] + 3.0 * s_refWhite[2];
+    const double un = 4.0 * s_refWhite[0] / dn;
+    const double vn = 9.0 * s_refWhite[1] / dn;
+
+    for (size_t i = 0; i < count; i++)
+    {
+        const int r = rgb[i].red, g = rgb[i].green, b = rgb[i].blue;
+        const int max = (r > g) ? ((r > b) ? r : b) : ((g > b) ? g : b);
+        const int min = (r < g) ? ((r < b) ? r : b) : ((g < b) ? g : b);
+        const int delta = max - min;
+        const double hue = RefHue(r, g, b, max, delta);
+
+        ref->hsv[i][0] = hue;
+        ref->hsv[i][1] = (max == 0) ? 0.0 : 100.0 * delta / max;
+        ref->hsv[i][2] = 100.0 * max / 255.0;
+
+        ref->hsl[i][0] = hue;
+        ref->hsl[i][1] = (delta == 0) ? 0.0 : 100.0 * delta / ((max + min <= 255) ? (max + min) : (510 - max - min));
+        ref->hsl[i][2] = 100.0 * (max + min) / 510.0;
+
+        ref->cmyk[i][0] = (max == 0) ? 0.0 : 100.0 * (max - r) / max;
+        ref->cmyk[i][1] = (max == 0) ? 0.0 : 100.0 * (max - g) / max;
+        ref->cmyk[i][2] = (max == 0) ? 0.0 : 100.0 * (max - b) / max;
+        ref->cmyk[i][3] = 100.0 * (255 - max) / 255.0;
+
+        // sRGB (IEC 61966-2-1) to XYZ, 0 - 100 scale.
+        const double lr = RefLinear(r), lg = RefLinear(g), lb = RefLinear(b);
+        const double x = 100.0 * (lr * 0.4124564 + lg * 0.3575761 + lb * 0.1804375);
+        const double y = 100.0 * (lr * 0.2126729 + lg * 0.7151522 + lb * 0.0721750);
+        const double z = 100.0 * (lr * 0.0193339 + lg * 0.1191920 + lb * 0.9503041);
+        ref->xyz[i][0] = x;
+        ref->xyz[i][1] = y;
+        ref->xyz[i][2] = z;
+
+        const double fx = RefLabF(x / s_refWhite[0]);
+        const double fy = RefLabF(y / s_refWhite[1]);
+        const double fz = RefLabF(z / s_refWhite[2]);
+        ref->lab[i][0] = 116.0 * fy - 16.0;
+        ref->lab[i][1] = 500.0 * (fx - fy);
+        ref->lab[i][2] = 200.0 * (fy - fz);
+
+        const double yr = y / s_refWhite[1];
+        const double l = (yr > s_cieEpsilon) ? 116.0 * cbrt(yr) - 16.0 : s_cieKappa * yr;
+        const double d = x + 15.0 * y + 3.0 * z;
+        ref->luv[i][0] = l;
+        ref->luv[i][1] = (d == 0.0) ? 0.0 : 13.0 * l * (4.0 * x / d - un);
+        ref->luv[i][2] = (d == 0.0) ? 0.0 : 13.0 * l * (9.0 * y / d - vn);
+
+        const double ol = cbrt(0.4122214708 * lr + 0.5363325363 * lg + 0.0514459929 * lb);
+        const double om = cbrt(0.2119034982 * lr + 0.6806995451 * lg + 0.1073969566 * lb);
+        const double os = cbrt(0.0883024619 * lr + 0.2817188376 * lg + 0.6299787005 * lb);
+        ref->oklab[i][0] = 0.2104542553 * ol + 0.7936177850 * om - 0.0040720468 * os;
+        ref->oklab[i][1] = 1.9779984951 * ol - 2.4285922050 * om + 0.4505937099 * os;
+        ref->oklab[i][2] = 0.0259040371 * ol + 0.7827717662 * om - 0.8086757660 * os;
+    }
+}
+
+// --- Error measures ---
+
+static inline double Max3(double a, double b, double c)
+{
+    return (a > b) ? ((a > c) ? a : c) : ((b > c) ? b : c);
+}
+
+static inline double RgbError(RgbColor a, RgbColor b)
+{
+    const int dr = abs((int)a.red - b.red), dg = abs((int)a.green - b.green), db = abs((int)a.blue - b.blue);
+    return (double)((dr > dg) ? ((dr > db) ? dr : db) : ((dg > db) ? dg : db));
+}
+
+static inline double HueDiff(double a, double b)
+{
+    const double d = fabs(a - b);
+    return (d > 180.0) ? 360.0 - d : d;
+}
+
+static inline double ErrHsv(const RefRow* ref, size_t i, double h, double s, double v)
+{
+    return Max3(HueDiff(h, ref->hsv[i][0]), fabs(s - ref->hsv[i][1]), fabs(v - ref->hsv[i][2]));
+}
+
+static inline double ErrHsl(const RefRow* ref, size_t i, double h, double s, double l)
+{
+    return Max3(HueDiff(h, ref->hsl[i][0]), fabs(s - ref->hsl[i][1]), fabs(l - ref->hsl[i][2]));
+}
+
+static inline double ErrCmyk(const RefRow* ref, size_t i, double c, double m, double y, double k)
+{
+    const double e = Max3(fabs(c - ref->cmyk[i][0]), fabs(m - ref->cmyk[i][1]), fabs(y - ref->cmyk[i][2]));
+    const double ek = fabs(k - ref->cmyk[i][3]);
+    return (e > ek) ? e : ek;
+}
+
+static inline double Err3(const double* expected, double a, double b, double c)
+{
+    return Max3(fabs(a - expected[0]), fabs(b - expected[1]), fabs(c - expected[2]));
+}
+
+// LCh is compared as the Lab it stands for, so hue is weighted by chroma and near grays do not count
+// a meaningless hue as an error.
+static inline double ErrLch(const RefRow* ref, size_t i, double l, double c, double h)
+{
+    const double rad = h * (3.14159265358979323846 / 180.0);
+    return Err3(ref->lab[i], l, c * cos(rad), c * sin(rad));
+}
+
+static inline double ErrOkLch(const RefRow* ref, size_t i, double l, double c, double h)
+{
+    const double rad = h * (3.14159265358979323846 / 180.0);
+    return Err3(ref->oklab[i], l, c * cos(rad), c * sin(rad));
+}
+
+// 16-bit fields in steps: hue 65536 per turn (wrapping), percentages 65535 per 100%.
+static inline double HueSteps(unsigned short h, double degrees)
+{
+    const double d = fabs((double)h - degrees * (65536.0 / 360.0));
+    return (d > 32768.0) ? 65536.0 - d : d;
+}
+
+static inline double PercentSteps(unsigned short v, double percent)
+{
+    return fabs((double)v - percent * (65535.0 / 100.0));
+}
+
+#define HSV_ERR(ref, i, o)  ErrHsv(ref, i, (o).hue, (o).saturation, (o).value)
+#define HSL_ERR(ref, i, o)  ErrHsl(ref, i, (o).hue, (o).saturation, (o).lightness)
+#define CMYK_ERR(ref, i, o) ErrCmyk(ref, i, (o).cyan, (o).magenta, (o).yellow, (o).key)
+#define XYZ_ERR(ref, i, o)  Err3((ref)->xyz[i], (o).x, (o).y, (o).z)
+#define LAB_ERR(ref, i, o)  Err3((ref)->lab[i], (o).l, (o).a, (o).b)
+#define LUV_ERR(ref, i, o)  Err3((ref)->luv[i], (o).l, (o).u, (o).v)
+#define LCH_ERR(ref, i, o)  ErrLch(ref, i, (o).l, (o).c, (o).h)
+#define OKLAB_ERR(ref, i, o) Err3((ref)->oklab[i], (o).l, (o).a, (o).b)
+#define OKLCH_ERR(ref, i, o) ErrOkLch(ref, i, (o).l, (o).c, (o).h)
+#define HSV_U16_ERR(ref, i, o) Max3(HueSteps((o).hue, (ref)->hsv[i][0]), \
+    PercentSteps((o).saturation, (ref)->hsv[i][1]), PercentSteps((o).value, (ref)->hsv[i][2]))
+#define HSL_U16_ERR(ref, i, o) Max3(HueSteps((o).hue, (ref)->hsl[i][0]), \
+    PercentSteps((o).saturation, (ref)->hsl[i][1]), PercentSteps((o).lightness, (ref)->hsl[i][2]))
+#define CMYK_U16_ERR(ref, i, o) Max3(Max3(PercentSteps((o).cyan, (ref)->cmyk[i][0]), \
+    PercentSteps((o).magenta, (ref)->cmyk[i][1]), PercentSteps((o).yellow, (ref)->cmyk[i][2])), \
+    PercentSteps((o).key, (ref)->cmyk[i][3]), 0.0)
+
+// --- Checks ---
+
+#define ROUND_TRIP(name, to, from) \
+    static void Check_##name(const RgbColor* rgb, const RefRow* ref, size_t count, double* error, CheckScratch* scratch) \
+    { \
+        (void)ref; (void)scratch; \
+        for (size_t i = 0; i < count; i++) \
+            error[i] = RgbError(rgb[i], from(to(rgb[i]))); \
+    }
+
+#define ROUND_TRIP_BATCH(name, T, to, from) \
+    static void Check_##name(const RgbColor* rgb, const RefRow* ref, size_t count, double* error, CheckScratch* scratch) \
+    { \
+        (void)ref; \
+        to(rgb, (T*)scratch->space, count, 0); \
+        from((const T*)scratch->space, scratch->back, count, 0); \
+        for (size_t i = 0; i < count; i++) \
+            error[i] = RgbError(rgb[i], scratch->back[i]); \
+    }
+
+#define ORACLE(name, fn, T, ERR) \
+    static void Check_##name(const RgbColor* rgb, const RefRow* ref, size_t count, double* error, CheckScratch* scratch) \
+    { \
+        (void)scratch; \
+        for (size_t i = 0; i < count; i++) \
+        { \
+            const T o = fn(rgb[i]); \
+            error[i] = ERR(ref, i, o); \
+        } \
+    }
+
+#define ORACLE_BATCH(name, fn, T, ERR) \
+    static void Check_##name(const RgbColor* rgb, const RefRow* ref, size_t count, double* error, CheckScratch* scratch) \
+    { \
+        const T* out = (const T*)scratch->space; \
+        fn(rgb, (T*)scratch->space, count, 0); \
+        for (size_t i = 0; i < count; i++) \
+            error[i] = ERR(ref, i, out[i]); \
+    }
+
+ROUND_TRIP(Hsv, RgbToHsv, HsvToRgb)
+ROUND_TRIP(Hsl, RgbToHsl, HslToRgb)
+ROUND_TRIP(Cmyk, RgbToCmyk, CmykToRgb)
+ROUND_TRIP(Xyz, RgbToXyz, XyzToRgb)
+ROUND_TRIP(Lab, RgbToLab, LabToRgb)
+ROUND_TRIP(Luv, RgbToLuv, LuvToRgb)
+ROUND_TRIP(Lch, RgbToLch, LchToRgb)
+ROUND_TRIP(OkLab, RgbToOkLab, OkLabToRgb)
+ROUND_TRIP(OkLch, RgbToOkLch, OkLchToRgb)
+ROUND_TRIP(HsvF, RgbToHsvF, HsvFToRgb)
+ROUND_TRIP(HslF, RgbToHslF, HslFToRgb)
+ROUND_TRIP(CmykF, RgbToCmykF, CmykFToRgb)
+ROUND_TRIP(XyzF, RgbToXyzF, XyzFToRgb)
+ROUND_TRIP(LabF, RgbToLabF, LabFToRgb)
+ROUND_TRIP(LuvF, RgbToLuvF, LuvFToRgb)
+ROUND_TRIP(LchF, RgbToLchF, LchFToRgb)
+ROUND_TRIP(HsvU16, RgbToHsvU16, HsvU16ToRgb)
+ROUND_TRIP(HslU16, RgbToHslU16, HslU16ToRgb)
+ROUND_TRIP(CmykU16, RgbToCmykU16, CmykU16ToRgb)
+ROUND_TRIP(Dec, RgbToRgbDec, RgbFromRgbDec)
+
+ROUND_TRIP_BATCH(XyzBatch, XyzSpace, RgbToXyzBatch, XyzToRgbBatch)
+ROUND_TRIP_BATCH(LabBatch, LabSpace, RgbToLabBatch, LabToRgbBatch)
+ROUND_TRIP_BATCH(LuvBatch, LuvSpace, RgbToLuvBatch, LuvToRgbBatch)
+ROUND_TRIP_BATCH(LchBatch, LchSpace, RgbToLchBatch, LchToRgbBatch)
+ROUND_TRIP_BATCH(OkLabBatch, OkLabSpace, RgbToOkLabBatch, OkLabToRgbBatch)
+ROUND_TRIP_BATCH(OkLchBatch, OkLchSpace, RgbToOkLchBatch, OkLchToRgbBatch)
+ROUND_TRIP_BATCH(HsvFBatch, HsvSpaceF, RgbToHsvFBatch, HsvFToRgbBatch)
+ROUND_TRIP_BATCH(HslFBatch, HslSpaceF, RgbToHslFBatch, HslFToRgbBatch)
+ROUND_TRIP_BATCH(CmykFBatch, CmykSpaceF, RgbToCmykFBatch, CmykFToRgbBatch)
+ROUND_TRIP_BATCH(XyzFBatch, XyzSpaceF, RgbToXyzFBatch, XyzFToRgbBatch)
+ROUND_TRIP_BATCH(LabFBatch, LabSpaceF, RgbToLabFBatch, LabFToRgbBatch)
+ROUND_TRIP_BATCH(LuvFBatch, LuvSpaceF, RgbToLuvFBatch, LuvFToRgbBatch)
+ROUND_TRIP_BATCH(LchFBatch, LchSpaceF, RgbToLchFBatch, LchFToRgbBatch)
+ROUND_TRIP_BATCH(HsvU16Batch, HsvSpaceU16, RgbToHsvU16Batch, HsvU16ToRgbBatch)
+ROUND_TRIP_BATCH(HslU16Batch, HslSpaceU16, RgbToHslU16Batch, HslU16ToRgbBatch)
+ROUND_TRIP_BATCH(CmykU16Batch, CmykSpaceU16, RgbToCmykU16Batch, CmykU16ToRgbBatch)
+
+static void Check_LabD50(const RgbColor* rgb, const RefRow* ref, size_t count, double* error, CheckScratch* scratch)
+{
+    (void)ref; (void)scratch;
+    for (size_t i = 0; i < count; i++)
+        error[i] = RgbError(rgb[i], LabToRgbEx(RgbToLabEx(rgb[i], WPID_D50, CAT_BRADFORD), WPID_D50, CAT_BRADFORD));
+}
+
+static void Check_LabD50Batch(const RgbColor* rgb, const RefRow* ref, size_t count, double* error, CheckScratch* scratch)
+{
+    (void)ref;
+    RgbToLabExBatch(rgb, (LabSpace*)scratch->space, count, 0, WPID_D50, CAT_BRADFORD);
+    LabToRgbExBatch((const LabSpace*)scratch->space, scratch->back, count, 0, WPID_D50, CAT_BRADFORD);
+    for (size_t i = 0; i < count; i++)
+        error[i] = RgbError(rgb[i], scratch->back[i]);
+}
+
+static void Check_XyzAdaptD50(const RgbColor* rgb, const RefRow* ref, size_t count, double* error, CheckScratch* scratch)
+{
+    (void)ref; (void)scratch;
+    for (size_t i = 0; i < count; i++)
+    {
+        const XyzSpace d50 = XyzAdapt(RgbToXyz(rgb[i]), WPID_D65_FULL, WPID_D50, CAT_BRADFORD);
+        error[i] = RgbError(rgb[i], XyzToRgb(XyzAdapt(d50, WPID_D50, WPID_D65_FULL, CAT_BRADFORD)));
+    }
+}
+
+static void Check_LabPlanar(const RgbColor* rgb, const RefRow* ref, size_t count, double* error, CheckScratch* scratch)
+{
+    unsigned char* p = scratch->planes;
+    double* lab = (double*)scratch->space;
+    (void)ref;
+    RgbDeinterleave(rgb, p, p + count, p + 2 * count, NULL, count);
+    RgbPlanarToLabPlanar(p, p + count, p + 2 * count, lab, lab + count, lab + 2 * count, count);
+    LabPlanarToRgbPlanar(lab, lab + count, lab + 2 * count, p, p + count, p + 2 * count, count);
+    for (size_t i = 0; i < count; i++)
+    {
+        const RgbColor back = { 255, p[i], p[count + i], p[2 * count + i] };
+        error[i] = RgbError(rgb[i], back);
+    }
+}
+
+static void Check_PlanLchD50(const RgbColor* rgb, const RefRow* ref, size_t count, double* error, CheckScratch* scratch)
+{
+    (void)ref;
+    ConversionPlanConvertBatch(s_planRgbToLchD50, rgb, scratch->space, count, 0);
+    ConversionPlanConvertBatch(s_planLchD50ToRgb, scratch->space, scratch->back, count, 0);
+    for (size_t i = 0; i < count; i++)
+        error[i] = RgbError(rgb[i], scratch->back[i]);
+}
+
+ORACLE(RgbToHsv, RgbToHsv, HsvSpace, HSV_ERR)
+ORACLE(RgbToHsl, RgbToHsl, HslSpace, HSL_ERR)
+ORACLE(RgbToCmyk, RgbToCmyk, CmykSpace, CMYK_ERR)
+ORACLE(RgbToXyz, RgbToXyz, XyzSpace, XYZ_ERR)
+ORACLE(RgbToLab, RgbToLab, LabSpace, LAB_ERR)
+ORACLE(RgbToLuv, RgbToLuv, LuvSpace, LUV_ERR)
+ORACLE(RgbToLch, RgbToLch, LchSpace, LCH_ERR)
+ORACLE(RgbToOkLab, RgbToOkLab, OkLabSpace, OKLAB_ERR)
+ORACLE(RgbToOkLch, RgbToOkLch, OkLchSpace, OKLCH_ERR)
+ORACLE(RgbToHsvF, RgbToHsvF, HsvSpaceF, HSV_ERR)
+ORACLE(RgbToHslF, RgbToHslF, HslSpaceF, HSL_ERR)
+ORACLE(RgbToCmykF, RgbToCmykF, CmykSpaceF, CMYK_ERR)
+ORACLE(RgbToXyzF, RgbToXyzF, XyzSpaceF, XYZ_ERR)
+ORACLE(RgbToLabF, RgbToLabF, LabSpaceF, LAB_ERR)
+ORACLE(RgbToLuvF, RgbToLuvF, LuvSpaceF, LUV_ERR)
+ORACLE(RgbToLchF, RgbToLchF, LchSpaceF, LCH_ERR)
+ORACLE(RgbToHsvU16, RgbToHsvU16, HsvSpaceU16, HSV_U16_ERR)
+ORACLE(RgbToHslU16, RgbToHslU16, HslSpaceU16, HSL_U16_ERR)
+ORACLE(RgbToCmykU16, RgbToCmykU16, CmykSpaceU16, CMYK_U16_ERR)
+
+ORACLE_BATCH(RgbToHsvBatch, RgbToHsvBatch, HsvSpace, HSV_ERR)
+ORACLE_BATCH(RgbToHslBatch, RgbToHslBatch, HslSpace, HSL_ERR)
+ORACLE_BATCH(RgbToCmykBatch, RgbToCmykBatch, CmykSpace, CMYK_ERR)
+ORACLE_BATCH(RgbToXyzBatch, RgbToXyzBatch, XyzSpace, XYZ_ERR)
+ORACLE_BATCH(RgbToLabBatch, RgbToLabBatch, LabSpace, LAB_ERR)
+ORACLE_BATCH(RgbToLuvBatch, RgbToLuvBatch, LuvSpace, LUV_ERR)
+ORACLE_BATCH(RgbToLchBatch, RgbToLchBatch, LchSpace, LCH_ERR)
+ORACLE_BATCH(RgbToOkLabBatch, RgbToOkLabBatch, OkLabSpace, OKLAB_ERR)
+ORACLE_BATCH(RgbToOkLchBatch, RgbToOkLchBatch, OkLchSpace, OKLCH_ERR)
+ORACLE_BATCH(RgbToHsvFBatch, RgbToHsvFBatch, HsvSpaceF, HSV_ERR)
+ORACLE_BATCH(RgbToHslFBatch, RgbToHslFBatch, HslSpaceF, HSL_ERR)
+ORACLE_BATCH(RgbToCmykFBatch, RgbToCmykFBatch, CmykSpaceF, CMYK_ERR)
+ORACLE_BATCH(RgbToXyzFBatch, RgbToXyzFBatch, XyzSpaceF, XYZ_ERR)
+ORACLE_BATCH(RgbToLabFBatch, RgbToLabFBatch, LabSpaceF, LAB_ERR)
+ORACLE_BATCH(RgbToLuvFBatch, RgbToLuvFBatch, LuvSpaceF, LUV_ERR)
+ORACLE_BATCH(RgbToLchFBatch, RgbToLchFBatch, LchSpaceF, LCH_ERR)
+ORACLE_BATCH(RgbToHsvU16Batch, RgbToHsvU16Batch, HsvSpaceU16, HSV_U16_ERR)
+ORACLE_BATCH(RgbToHslU16Batch, RgbToHslU16Batch, HslSpaceU16, HSL_U16_ERR)
+ORACLE_BATCH(RgbToCmykU16Batch, RgbToCmykU16Batch, CmykSpaceU16, CMYK_U16_ERR)
+ORACLE_BATCH(RgbToHsvParallel, RgbToHsvParallel, HsvSpace, HSV_ERR)
+ORACLE_BATCH(RgbToHslParallel, RgbToHslParallel, HslSpace, HSL_ERR)
+ORACLE_BATCH(RgbToCmykParallel, RgbToCmykParallel, CmykSpace, CMYK_ERR)
+ORACLE_BATCH(RgbToXyzParallel, RgbToXyzParallel, XyzSpace, XYZ_ERR)
+ORACLE_BATCH(RgbToLabParallel, RgbToLabParallel, LabSpace, LAB_ERR)
+ORACLE_BATCH(RgbToLuvParallel, RgbToLuvParallel, LuvSpace, LUV_ERR)
+ORACLE_BATCH(RgbToLchParallel, RgbToLchParallel, LchSpace, LCH_ERR)
+
+static void Check_RgbToLabExD65(const RgbColor* rgb, const RefRow* ref, size_t count, double* error, CheckScratch* scratch)
+{
+    (void)scratch;
+    for (size_t i = 0; i < count; i++)
+    {
+        const LabSpace o = RgbToLabEx(rgb[i], WPID_D65_FULL, CAT_BRADFORD);
+        error[i] = LAB_ERR(ref, i, o);
+    }
+}
+
+static void Check_PlanRgbToLab(const RgbColor* rgb, const RefRow* ref, size_t count, double* error, CheckScratch* scratch)
+{
+    const LabSpace* out = (const LabSpace*)scratch->space;
+    ConversionPlanConvertBatch(s_planRgbToLab, rgb, scratch->space, count, 0);
+    for (size_t i = 0; i < count; i++)
+        error[i] = LAB_ERR(ref, i, out[i]);
+}
+
+static void Check_RgbPlanarToLabPlanar(const RgbColor* rgb, const RefRow* ref, size_t count, double* error, CheckScratch* scratch)
+{
+    unsigned char* p = scratch->planes;
+    double* lab = (double*)scratch->space;
+    RgbDeinterleave(rgb, p, p + count, p + 2 * count, NULL, count);
+    RgbPlanarToLabPlanar(p, p + count, p + 2 * count, lab, lab + count, lab + 2 * count, count);
+    for (size_t i = 0; i < count; i++)
+        error[i] = Err3(ref->lab[i], lab[i], lab[count + i], lab[2 * count + i]);
+}
+
+static void Check_RgbPlanarToLabPlanarF(const RgbColor* rgb, const RefRow* ref, size_t count, double* error, CheckScratch* scratch)
+{
+    unsigned char* p = scratch->planes;
+    float* lab = (float*)scratch->space;
+    RgbDeinterleave(rgb, p, p + count, p + 2 * count, NULL, count);
+    RgbPlanarToLabPlanarF(p, p + count, p + 2 * count, lab, lab + count, lab + 2 * count, count);
+    for (size_t i = 0; i < count; i++)
+        error[i] = Err3(ref->lab[i], lab[i], lab[count + i], lab[2 * count + i]);
+}
+
+// Double results are held to 1e-9 (the reference and the library differ only in operation order).  Float
+// results are held to 1e-4: half a float step at 360 is 1.5e-5, plus the double to float rounding of inputs
+// already computed in float.  16-bit results must be the nearest step.  LCh chroma under 0.003 is snapped to
+// 0 by design (hue is meaningless there), so LCh is held to that, and OKLCh to its 0.00003.  RGB -> XYZ is held
+// to TOL_EXACT: it is the same expression as the reference in the same order, so any difference means the
+// sRGB linearization table no longer matches pow() bit for bit.
+#define TOL_EXACT 0.0
+#define TOL_DOUBLE 1e-9
+#define TOL_FLOAT 1e-4
+#define TOL_STEP (0.5 + 1e-9)
+#define TOL_LCH (0.003 + 1e-9)
+#define TOL_OKLCH (0.00003 + 1e-9)
+
+static const AccuracyCheck s_checks[] = {
+    { "Hsv", CHECK_RGB, 0.0, Check_Hsv },
+    { "Hsl", CHECK_RGB, 0.0, Check_Hsl },
+    { "Cmyk", CHECK_RGB, 0.0, Check_Cmyk },
+    { "Xyz", CHECK_RGB, 0.0, Check_Xyz },
+    { "Lab", CHECK_RGB, 0.0, Check_Lab },
+    { "Luv", CHECK_RGB, 0.0, Check_Luv },
+    { "Lch", CHECK_RGB, 0.0, Check_Lch },
+    { "OkLab", CHECK_RGB, 0.0, Check_OkLab },
+    { "OkLch", CHECK_RGB, 0.0, Check_OkLch },
+    { "HsvF", CHECK_RGB, 0.0, Check_HsvF },
+    { "HslF", CHECK_RGB, 0.0, Check_HslF },
+    { "CmykF", CHECK_RGB, 0.0, Check_CmykF },
+    { "XyzF", CHECK_RGB, 0.0, Check_XyzF },
+    { "LabF", CHECK_RGB, 0.0, Check_LabF },
+    { "LuvF", CHECK_RGB, 0.0, Check_LuvF },
+    { "LchF", CHECK_RGB, 0.0, Check_LchF },
+    { "HsvU16", CHECK_RGB, 0.0, Check_HsvU16 },
+    { "HslU16", CHECK_RGB, 0.0, Check_HslU16 },
+    { "CmykU16", CHECK_RGB, 0.0, Check_CmykU16 },
+    { "Dec", CHECK_RGB, 0.0, Check_Dec },
+    { "XyzBatch", CHECK_RGB, 0.0, Check_XyzBatch },
+    { "LabBatch", CHECK_RGB, 0.0, Check_LabBatch },
+    { "LuvBatch", CHECK_RGB, 0.0, Check_LuvBatch },
+    { "LchBatch", CHECK_RGB, 0.0, Check_LchBatch },
+    { "OkLabBatch", CHECK_RGB, 0.0, Check_OkLabBatch },
+    { "OkLchBatch", CHECK_RGB, 0.0, Check_OkLchBatch },
+    { "HsvFBatch", CHECK_RGB, 0.0, Check_HsvFBatch },
+    { "HslFBatch", CHECK_RGB, 0.0, Check_HslFBatch },
+    { "CmykFBatch", CHECK_RGB, 0.0, Check_CmykFBatch },
+    { "XyzFBatch", CHECK_RGB, 0.0, Check_XyzFBatch },
+    { "LabFBatch", CHECK_RGB, 0.0, Check_LabFBatch },
+    { "LuvFBatch", CHECK_RGB, 0.0, Check_LuvFBatch },
+    { "LchFBatch", CHECK_RGB, 0.0, Check_LchFBatch },
+    { "HsvU16Batch", CHECK_RGB, 0.0, Check_HsvU16Batch },
+    { "HslU16Batch", CHECK_RGB, 0.0, Check_HslU16Batch },
+    { "CmykU16Batch", CHECK_RGB, 0.0, Check_CmykU16Batch },
+    { "Lab D50", CHECK_RGB, 0.0, Check_LabD50 },
+    { "Lab D50 Batch", CHECK_RGB, 0.0, Check_LabD50Batch },
+    { "XyzAdapt D65<->D50", CHECK_RGB, 0.0, Check_XyzAdaptD50 },
+    { "Lab Planar", CHECK_RGB, 0.0, Check_LabPlanar },
+    { "Plan Lch D50", CHECK_RGB, 0.0, Check_PlanLchD50 },
+
+    { "RgbToHsv", CHECK_VALUE, TOL_DOUBLE, Check_RgbToHsv },
+    { "RgbToHsl", CHECK_VALUE, TOL_DOUBLE, Check_RgbToHsl },
+    { "RgbToCmyk", CHECK_VALUE, TOL_DOUBLE, Check_RgbToCmyk },
+    { "RgbToXyz", CHECK_VALUE, TOL_EXACT, Check_RgbToXyz },
+    { "RgbToLab", CHECK_VALUE, TOL_DOUBLE, Check_RgbToLab },
+    { "RgbToLuv", CHECK_VALUE, TOL_DOUBLE, Check_RgbToLuv },
+    { "RgbToLch", CHECK_VALUE, TOL_LCH, Check_RgbToLch },
+    { "RgbToOkLab", CHECK_VALUE, TOL_DOUBLE, Check_RgbToOkLab },
+    { "RgbToOkLch", CHECK_VALUE, TOL_OKLCH, Check_RgbToOkLch },
+    { "RgbToHsvF", CHECK_VALUE, TOL_FLOAT, Check_RgbToHsvF },
+    { "RgbToHslF", CHECK_VALUE, TOL_FLOAT, Check_RgbToHslF },
+    { "RgbToCmykF", CHECK_VALUE, TOL_FLOAT, Check_RgbToCmykF },
+    { "RgbToXyzF", CHECK_VALUE, TOL_FLOAT, Check_RgbToXyzF },
+    { "RgbToLabF", CHECK_VALUE, TOL_FLOAT, Check_RgbToLabF },
+    { "RgbToLuvF", CHECK_VALUE, TOL_FLOAT, Check_RgbToLuvF },
+    { "RgbToLchF", CHECK_VALUE, TOL_LCH, Check_RgbToLchF },
+    { "RgbToHsvBatch", CHECK_VALUE, TOL_DOUBLE, Check_RgbToHsvBatch },
+    { "RgbToHslBatch", CHECK_VALUE, TOL_DOUBLE, Check_RgbToHslBatch },
+    { "RgbToCmykBatch", CHECK_VALUE, TOL_DOUBLE, Check_RgbToCmykBatch },
+    { "RgbToXyzBatch", CHECK_VALUE, TOL_EXACT, Check_RgbToXyzBatch },
+    { "RgbToLabBatch", CHECK_VALUE, TOL_DOUBLE, Check_RgbToLabBatch },
+    { "RgbToLuvBatch", CHECK_VALUE, TOL_DOUBLE, Check_RgbToLuvBatch },
+    { "RgbToLchBatch", CHECK_VALUE, TOL_LCH, Check_RgbToLchBatch },
+    { "RgbToOkLabBatch", CHECK_VALUE, TOL_DOUBLE, Check_RgbToOkLabBatch },
+    { "RgbToOkLchBatch", CHECK_VALUE, TOL_OKLCH, Check_RgbToOkLchBatch },
+    { "RgbToHsvFBatch", CHECK_VALUE, TOL_FLOAT, Check_RgbToHsvFBatch },
+    { "RgbToHslFBatch", CHECK_VALUE, TOL_FLOAT, Check_RgbToHslFBatch },
+    { "RgbToCmykFBatch", CHECK_VALUE, TOL_FLOAT, Check_RgbToCmykFBatch },
+    { "RgbToXyzFBatch", CHECK_VALUE, TOL_FLOAT, Check_RgbToXyzFBatch },
+    { "RgbToLabFBatch", CHECK_VALUE, TOL_FLOAT, Check_RgbToLabFBatch },
+    { "RgbToLuvFBatch", CHECK_VALUE, TOL_FLOAT, Check_RgbToLuvFBatch },
+    { "RgbToLchFBatch", CHECK_VALUE, TOL_LCH, Check_RgbToLchFBatch },
+    { "RgbToHsvParallel", CHECK_VALUE, TOL_DOUBLE, Check_RgbToHsvParallel },
+    { "RgbToHslParallel", CHECK_VALUE, TOL_DOUBLE, Check_RgbToHslParallel },
+    { "RgbToCmykParallel", CHECK_VALUE, TOL_DOUBLE, Check_RgbToCmykParallel },
+    { "RgbToXyzParallel", CHECK_VALUE, TOL_EXACT, Check_RgbToXyzParallel },
+    { "RgbToLabParallel", CHECK_VALUE, TOL_DOUBLE, Check_RgbToLabParallel },
+    { "RgbToLuvParallel", CHECK_VALUE, TOL_DOUBLE, Check_RgbToLuvParallel },
+    { "RgbToLchParallel", CHECK_VALUE, TOL_LCH, Check_RgbToLchParallel },
+    { "RgbToLabEx D65", CHECK_VALUE, TOL_DOUBLE, Check_RgbToLabExD65 },
+    { "Plan RGB->LAB", CHECK_VALUE, TOL_DOUBLE, Check_PlanRgbToLab },
+    { "RgbPlanarToLabPlanar", CHECK_VALUE, TOL_DOUBLE, Check_RgbPlanarToLabPlanar },
+    { "RgbPlanarToLabPlanarF", CHECK_VALUE, TOL_FLOAT, Check_RgbPlanarToLabPlanarF },
+
+    { "RgbToHsvU16", CHECK_STEPS, TOL_STEP, Check_RgbToHsvU16 },
+    { "RgbToHslU16", CHECK_STEPS, TOL_STEP, Check_RgbToHslU16 },
+    { "RgbToCmykU16", CHECK_STEPS, TOL_STEP, Check_RgbToCmykU16 },
+    { "RgbToHsvU16Batch", CHECK_STEPS, TOL_STEP, Check_RgbToHsvU16Batch },
+    { "RgbToHslU16Batch", CHECK_STEPS, TOL_STEP, Check_RgbToHslU16Batch },
+    { "RgbToCmykU16Batch", CHECK_STEPS, TOL_STEP, Check_RgbToCmykU16Batch },
+};
+
+#define ACCURACY_CHECK_COUNT (sizeof(s_checks) / sizeof(s_checks[0]))
+
+// --- Sweep ---
+
+typedef struct {
+    size_t index;
+    size_t threadCount;
+    const unsigned char* enabled;   // Per check
+    CheckStats* stats;              // Per check, this thread's share
+    int failed;                     // Out of memory
+} Worker;
+
+static void Accumulate(CheckStats* stats, const AccuracyCheck* check, const RgbColor* rgb, const double* error, size_t count)
+{
+    const CheckKindInfo* kind = &s_kinds[check->kind];
+
+    for (size_t i = 0; i < count; i++)
+    {
+        const double e = error[i];
+        size_t bucket = 0;
+        while (bucket < kind->edgeCount && !(e <= kind->edges[bucket]))
+            bucket++;
+        stats->histogram[bucket]++;
+
+        // !(e <= max) so a NaN is always reported.
+        if (!(e <= stats->maxError))
+        {
+            stats->maxError = e;
+            stats->worst = rgb[i];
+        }
+        if (!(e <= check->tolerance))
+        {
+            if (stats->listedCount < ACCURACY_MAX_LISTED)
+            {
+                stats->listed[stats->listedCount].color = rgb[i];
+                stats->listed[stats->listedCount].error = e;
+                stats->listedCount++;
+            }
+            stats->failures++;
+        }
+    }
+}
+
+static void RunWorker(Worker* worker)
+{
+    RefRow* ref = (RefRow*)malloc(sizeof(RefRow));
+    CheckScratch* scratch = (CheckScratch*)malloc(sizeof(CheckScratch));
+    RgbColor row[ACCURACY_ROW];
+    double error[ACCURACY_ROW];
+
+    if (ref == NULL || scratch == NULL)
+    {
+        worker->failed = 1;
+        free(ref);
+        free(scratch);
+        return;
+    }
+
+    for (size_t r = worker->index; r < 256; r += worker->threadCount)
+    {
+        for (size_t g = 0; g < 256; g++)
+        {
+            for (size_t b = 0; b < ACCURACY_ROW; b++)
+            {
+                row[b].alpha = 255;
+                row[b].red = (unsigned char)r;
+                row[b].green = (unsigned char)g;
+                row[b].blue = (unsigned char)b;
+            }
+            BuildRefRow(row, ACCURACY_ROW, ref);
+
+            for (size_t c = 0; c < ACCURACY_CHECK_COUNT; c++)
+            {
+                if (!worker->enabled[c])
+                    continue;
+                s_checks[c].fn(row, ref, ACCURACY_ROW, error, scratch);
+                Accumulate(&worker->stats[c], &s_checks[c], row, error, ACCURACY_ROW);
+            }
+        }
+    }
+
+    free(scratch);
+    free(ref);
+}
+
+#if defined(_WIN32) || defined(_WIN64)
+static unsigned __stdcall WorkerMain(void* arg)
+{
+    RunWorker((Worker*)arg);
+    return 0;
+}
+#else
+static void* WorkerMain(void* arg)
+{
+    RunWorker((Worker*)arg);
+    return NULL;
+}
+#endif
+
+/// <summary>
+/// Runs the workers on threadCount threads (the caller is one of them).  A thread that fails to start
+/// has its share run on the caller instead.
+/// </summary>
+static void RunWorkers(Worker* workers, size_t threadCount)
+{
+#if defined(_WIN32) || defined(_WIN64)
+    HANDLE threads[ACCURACY_MAX_THREADS] = { 0 };
+    for (size_t t = 1; t < threadCount; t++)
+        threads[t] = (HANDLE)_beginthreadex(NULL, 0, WorkerMain, &workers[t], 0, NULL);
+    RunWorker(&workers[0]);
+    for (size_t t = 1; t < threadCount; t++)
+    {
+        if (threads[t] == NULL)
+            RunWorker(&workers[t]);
+        else
+        {
+            WaitForSingleObject(threads[t], INFINITE);
+            CloseHandle(threads[t]);
+        }
+    }
+#else
+    pthread_t threads[ACCURACY_MAX_THREADS];
+    int started[ACCURACY_MAX_THREADS] = { 0 };
+    for (size_t t = 1; t < threadCount; t++)
+        started[t] = pthread_create(&threads[t], NULL, WorkerMain, &workers[t]) == 0;
+    RunWorker(&workers[0]);
+    for (size_t t = 1; t < threadCount; t++)
+    {
+        if (!started[t])
+            RunWorker(&workers[t]);
+        else
+            pthread_join(threads[t], NULL);
+    }
+#endif
+}
+
+static int CompareFailed(const void* a, const void* b)
+{
+    const RgbColor* x = &((const FailedColor*)a)->color;
+    const RgbColor* y = &((const FailedColor*)b)->color;
+    const long kx = ((long)x->red << 16) | ((long)x->green << 8) | x->blue;
+    const long ky = ((long)y->red << 16) | ((long)y->green << 8) | y->blue;
+    return (kx > ky) - (kx < ky);
+}
+
+/// <summary>
+/// Folds the per thread stats of one check into 'total'.  Each thread lists its first failures in cube
+/// order, so the lowest of all lists are the first failures of the whole cube.
+/// </summary>
+static void MergeStats(CheckStats* total, const Worker* workers, size_t threadCount, size_t check)
+{
+    FailedColor all[ACCURACY_MAX_LISTED * ACCURACY_MAX_THREADS];
+    size_t allCount = 0;
+
+    memset(total, 0, sizeof(*total));
+    for (size_t t = 0; t < threadCount; t++)
+    {
+        const CheckStats* s = &workers[t].stats[check];
+        if (t == 0 || !(s->maxError <= total->maxError))
+        {
+            total->maxError = s->maxError;
+            total->worst = s->worst;
+        }
+        total->failures += s->failures;
+        for (size_t b = 0; b < ACCURACY_MAX_BUCKETS; b++)
+            total->histogram[b] += s->histogram[b];
+        for (size_t i = 0; i < s->listedCount; i++)
+            all[allCount++] = s->listed[i];
+    }
+
+    qsort(all, allCount, sizeof(FailedColor), CompareFailed);
+    total->listedCount = (allCount < ACCURACY_MAX_LISTED) ? allCount : ACCURACY_MAX_LISTED;
+    memcpy(total->listed, all, total->listedCount * sizeof(FailedColor));
+}
+
+// --- Scenario checks ---
+
+typedef struct {
+    double maxError;
+    size_t cases;
+    size_t failures;
+    char worst[48];             // Case with the largest error
+} ScenarioStats;
+
+typedef void (*ScenarioFn)(ScenarioStats* stats, double tolerance);
+
+typedef struct {
+    const char* name;
+    const char* unit;
+    double tolerance;
+    ScenarioFn fn;
+} ScenarioCheck;
+
+/// <summary>
+/// Records one case.  'format' describes it, kept when the case has the largest error so far.
+/// </summary>
+static void ScenarioCase(ScenarioStats* stats, double error, double tolerance, const char* format, ...)
+{
+    stats->cases++;
+    if (!(error <= tolerance))
+        stats->failures++;
+    if (stats->cases == 1 || !(error <= stats->maxError))
+    {
+        va_list args;
+        va_start(args, format);
+        vsnprintf(stats->worst, sizeof(stats->worst), format, args);
+        va_end(args);
+        stats->maxError = error;
+    }
+}
+
+// LchMaxChroma against a scan of every 0.01 chroma, on a grid that is dense just below white where the
+// boundary has re-entrant sections.  The solved chroma must be in gamut and at or above the largest
+// scanned one (a scan can miss sections narrower than its step, the solver must not).  The scan also
+// counts chromas inside the 1e-9 linear RGB slack, worth a few 1e-7 where a channel is flat.
+#define GAMUT_SCAN_STEP 0.01
+
+static void LchMaxChromaCase(ScenarioStats* stats, double tolerance, double l, double h)
+{
+    double scanned = 0.0;
+    for (int k = 0; k * GAMUT_SCAN_STEP <= 150.0; k++)
+    {
+        const LchSpace lch = { l, k * GAMUT_SCAN_STEP, h };
+        if (LchInGamut(lch))
+            scanned = lch.c;
+    }
+
+    const LchSpace solved = { l, LchMaxChroma(l, h), h };
+    double e = scanned - solved.c;
+    if (e < 0.0)
+        e = 0.0;
+    if (solved.c > 0.0 && !LchInGamut(solved))
+        e = 1.0;
+    ScenarioCase(stats, e, tolerance, "L %.2f h %.2f", l, h);
+}
+
+static void Scenario_LchMaxChroma(ScenarioStats* stats, double tolerance)
+{
+    for (int li = 0; li < 160; li++)
+    {
+        const double l = (li < 100) ? 0.5 + li * 0.99 : 90.0 + (li - 100) * 0.165;
+        for (double h = 0.25; h < 360.0; h += 2.0)
+            LchMaxChromaCase(stats, tolerance, l, h);
+    }
+
+    // Where the outer section between yellow and green starts, it is only a few tenths of chroma wide.
+    for (double l = 95.0; l < 98.0; l += 0.1)
+    {
+        for (double h = 99.0; h < 108.0; h += 0.3)
+            LchMaxChromaCase(stats, tolerance, l, h);
+    }
+}
+
+// GAMUT_MAP_TABLE against the solved boundary, for colors past it.  The table may keep up to 0.05 chroma
+// less than the boundary, a couple of 8-bit steps where a channel is near 0.
+static void Scenario_GamutMapTable(ScenarioStats* stats, double tolerance)
+{
+    unsigned seed = 12345;
+    for (int i = 0; i < 200000; i++)
+    {
+        LchSpace lch;
+        seed = seed * 1103515245u + 12345u;
+        lch.l = (i & 1) ? 85.0 + 15.0 * ((seed >> 8) & 0xFFFF) / 65536.0 : 100.0 * ((seed >> 8) & 0xFFFF) / 65536.0;
+        seed = seed * 1103515245u + 12345u;
+        lch.h = 360.0 * ((seed >> 8) & 0xFFFF) / 65536.0;
+        seed = seed * 1103515245u + 12345u;
+        lch.c = 150.0 * ((seed >> 8) & 0xFFFF) / 65536.0;
+
+        const double maxC = LchMaxChroma(lch.l, lch.h);
+        if (lch.l <= 0.0 || lch.c <= maxC)
+            continue;
+
+        const LchSpace boundary = { lch.l, maxC, lch.h };
+        const RgbColor mapped = LchToRgbMapped(lch, GAMUT_MAP_TABLE);
+        ScenarioCase(stats, RgbError(mapped, LchToRgb(boundary)), tolerance, "L %.2f C %.2f h %.2f", lch.l, lch.c, lch.h);
+    }
+}
+
+static inline RgbColor MakeRgb(int r, int g, int b)
+{
+    RgbColor c;
+    c.alpha = 255;
+    c.red = (unsigned char)r;
+    c.green = (unsigned char)g;
+    c.blue = (unsigned char)b;
+    return c;
+}
+
+// Synthetic test image: smooth gradients with a little noise and a band of flat blocks, or with 'flat'
+// set only the blocks, a handful of colors for palettes larger than the image needs.
+static void ScenarioImage(RgbColor* pixels, size_t width, size_t height, int flat)
+{
+    const RgbColor blocks[5] = { MakeRgb(0, 0, 0), MakeRgb(255, 255, 255), MakeRgb(200, 30, 40), MakeRgb(20, 120, 220), MakeRgb(250, 210, 0) };
+    unsigned seed = 2024;
+    for (size_t y = 0; y < height; y++)
+    {
+        for (size_t x = 0; x < width; x++)
+        {
+            RgbColor* p = &pixels[y * width + x];
+            if (flat || y < height / 8)
+            {
+                *p = blocks[(x * 5 / width + y * 3 / height) % 5];
+                continue;
+            }
+
+            seed = seed * 1103515245u + 12345u;
+            const int noise = (int)((seed >> 16) & 15) - 8;
+            const int r = (int)(x * 255 / width) + noise;
+            const int g = (int)(y * 255 / height) - noise;
+            const int b = (int)((x + y) * 255 / (width + height)) + noise / 2;
+            p->alpha = 255;
+            p->red = (unsigned char)((r < 0) ? 0 : ((r > 255) ? 255 : r));
+            p->green = (unsigned char)((g < 0) ? 0 : ((g > 255) ? 255 : g));
+            p->blue = (unsigned char)((b < 0) ? 0 : ((b > 255) ? 255 : b));
+        }
+    }
+}
+
+// QuantizeImage and QuantizeRemap at several thread counts.  Per case (image, method, maxColors) the error
+// counts broken invariants: a palette of 0 or more than maxColors colors, an index past the palette, and a
+// palette or index that differs from the single thread run.  The thread count is restored afterwards.
+#define QUANT_SCENARIO_WIDTH 400
+#define QUANT_SCENARIO_HEIGHT 300
+
+static void Scenario_QuantizeInvariants(ScenarioStats* stats, double tolerance)
+{
+    static const size_t maxColors[] = { 1, 2, 16, 256 };
+    static const size_t threads[] = { 1, 2, 3, 8 };
+    const size_t count = QUANT_SCENARIO_WIDTH * QUANT_SCENARIO_HEIGHT;
+    const size_t savedThreads = ChizlGetThreadCount();
+
+    RgbColor* pixels = (RgbColor*)malloc(count * sizeof(RgbColor));
+    unsigned char* first = (unsigned char*)malloc(count);         // Single thread QuantizeImage indexes
+    unsigned char* firstRemap = (unsigned char*)malloc(count);    // Single thread QuantizeRemap indexes
+    unsigned char* indexes = (unsigned char*)malloc(count);
+    if (pixels == NULL || first == NULL || firstRemap == NULL || indexes == NULL)
+    {
+        ScenarioCase(stats, 1.0, tolerance, "out of memory");
+        free(pixels);
+        free(first);
+        free(firstRemap);
+        free(indexes);
+        return;
+    }
+
+    for (int flat = 0; flat <= 1; flat++)
+    {
+        ScenarioImage(pixels, QUANT_SCENARIO_WIDTH, QUANT_SCENARIO_HEIGHT, flat);
+        for (int method = QUANTIZE_MEDIAN_CUT; method <= QUANTIZE_KMEANS; method++)
+        {
+            for (size_t m = 0; m < sizeof(maxColors) / sizeof(maxColors[0]); m++)
+            {
+                RgbColor firstPalette[QUANTIZE_MAX_COLORS];
+                size_t firstCount = 0;
+                size_t errors = 0;
+
+                for (size_t t = 0; t < sizeof(threads) / sizeof(threads[0]); t++)
+                {
+                    RgbColor palette[QUANTIZE_MAX_COLORS];
+                    ChizlSetThreadCount(threads[t]);
+                    const size_t n = QuantizeImage(pixels, count, palette, maxColors[m], indexes, (QuantizeMethod)method);
+                    if (n == 0 || n > maxColors[m])
+                    {
+                        errors++;
+                        continue;
+                    }
+                    for (size_t i = 0; i < count; i++)
+                        errors += (indexes[i] >= n);
+
+                    if (t == 0)
+                    {
+                        firstCount = n;
+                        memcpy(firstPalette, palette, n * sizeof(RgbColor));
+                        memcpy(first, indexes, count);
+                    }
+                    else if (n != firstCount || memcmp(palette, firstPalette, n * sizeof(RgbColor)) != 0 || memcmp(indexes, first, count) != 0)
+                        errors++;
+
+                    // Remapping onto the palette just built must not depend on the thread count either.
+                    if (QuantizeRemap(pixels, count, firstPalette, firstCount, indexes) != count)
+                        errors++;
+                    else if (t == 0)
+                        memcpy(firstRemap, indexes, count);
+                    else if (memcmp(indexes, firstRemap, count) != 0)
+                        errors++;
+                }
+
+                ScenarioCase(stats, (double)errors, tolerance, "%s %s %zu colors", flat ? "flat" : "gradient",
+                    (method == QUANTIZE_KMEANS) ? "k-means" : "median cut", maxColors[m]);
+            }
+        }
+    }
+
+    ChizlSetThreadCount(savedThreads);
+    free(pixels);
+    free(first);
+    free(firstRemap);
+    free(indexes);
+}
+
+// QuantizeRemap against a brute force nearest color by CIE76 in D65 Lab, the error is how much farther
+// the chosen color is than the nearest (0 when it is the nearest or ties with it).
+static void Scenario_QuantizeRemapNearest(ScenarioStats* stats, double tolerance)
+{
+    const size_t count = QUANT_SCENARIO_WIDTH * QUANT_SCENARIO_HEIGHT;
+    RgbColor* pixels = (RgbColor*)malloc(count * sizeof(RgbColor));
+    unsigned char* indexes = (unsigned char*)malloc(count);
+    if (pixels == NULL || indexes == NULL)
+    {
+        ScenarioCase(stats, 1.0, tolerance, "out of memory");
+        free(pixels);
+        free(indexes);
+        return;
+    }
+
+    // A 6x7x6 cube plus 4 grays, then the pixels shuffled through it with a stride so runs don't repeat.
+    RgbColor palette[QUANTIZE_MAX_COLORS];
+    LabSpace labs[QUANTIZE_MAX_COLORS];
+    size_t n = 0;
+    for (int r = 0; r < 6; r++)
+        for (int g = 0; g < 7; g++)
+            for (int b = 0; b < 6; b++)
+                palette[n++] = MakeRgb(r * 51, g * 255 / 6, b * 51);
+    for (int k = 1; k <= 4; k++)
+        palette[n++] = MakeRgb(k * 50 + 3, k * 50 + 3, k * 50 + 3);
+    for (size_t i = 0; i < n; i++)
+        labs[i] = RgbToLab(palette[i]);
+
+    ScenarioImage(pixels, QUANT_SCENARIO_WIDTH, QUANT_SCENARIO_HEIGHT, 0);
+    if (QuantizeRemap(pixels, count, palette, n, indexes) != count)
+    {
+        ScenarioCase(stats, 1.0, tolerance, "remap failed");
+        free(pixels);
+        free(indexes);
+        return;
+    }
+
+    for (size_t i = 0; i < count; i += 7)
+    {
+        const LabSpace lab = RgbToLab(pixels[i]);
+        double best = -1.0;
+        for (size_t j = 0; j < n; j++)
+        {
+            const double d = sqrt((lab.l - labs[j].l) * (lab.l - labs[j].l) + (lab.a - labs[j].a) * (lab.a - labs[j].a)
+                + (lab.b - labs[j].b) * (lab.b - labs[j].b));
+            if (best < 0.0 || d < best)
+                best = d;
+        }
+
+        const LabSpace* chosen = &labs[indexes[i]];
+        const double d = sqrt((lab.l - chosen->l) * (lab.l - chosen->l) + (lab.a - chosen->a) * (lab.a - chosen->a)
+            + (lab.b - chosen->b) * (lab.b - chosen->b));
+        ScenarioCase(stats, d - best, tolerance, "#%02X%02X%02X", pixels[i].red, pixels[i].green, pixels[i].blue);
+    }
+
+    free(pixels);
+    free(indexes);
+}
+
+// DITHER_SCAN_WAVEFRONT against DITHER_SCAN_RASTER, which it must match bit for bit.  Odd widths and the
+// 1 and 2 pixel widths where a row can't get DITHER_LAG pixels ahead, at several thread counts.  The error
+// counts pixels whose index or output color differs.
+static void Scenario_DitherWavefront(ScenarioStats* stats, double tolerance)
+{
+    static const size_t widths[] = { 1, 2, 3, 5, 17, 63, 255 };
+    static const size_t heights[] = { 1, 2, 7, 64 };
+    static const size_t threads[] = { 2, 3, 8 };
+    const size_t maxCount = 255 * 64;
+    const size_t savedThreads = ChizlGetThreadCount();
+
+    // Cube corners and mid grays, coarse enough that every pixel carries a large error forward.
+    RgbColor palette[12];
+    for (int i = 0; i < 8; i++)
+        palette[i] = MakeRgb((i & 1) ? 255 : 0, (i & 2) ? 255 : 0, (i & 4) ? 255 : 0);
+    for (int i = 0; i < 4; i++)
+        palette[8 + i] = MakeRgb(51 + i * 51, 51 + i * 51, 51 + i * 51);
+
+    RgbColor* pixels = (RgbColor*)malloc(maxCount * sizeof(RgbColor));
+    RgbColor* rasterOut = (RgbColor*)malloc(maxCount * sizeof(RgbColor));
+    RgbColor* waveOut = (RgbColor*)malloc(maxCount * sizeof(RgbColor));
+    unsigned char* rasterIndexes = (unsigned char*)malloc(maxCount);
+    unsigned char* waveIndexes = (unsigned char*)malloc(maxCount);
+    if (pixels == NULL || rasterOut == NULL || waveOut == NULL || rasterIndexes == NULL || waveIndexes == NULL)
+        ScenarioCase(stats, 1.0, tolerance, "out of memory");
+
+    for (int method = DITHER_FLOYD_STEINBERG; method <= DITHER_ATKINSON && waveIndexes != NULL; method++)
+    {
+        for (size_t w = 0; w < sizeof(widths) / sizeof(widths[0]); w++)
+        {
+            for (size_t h = 0; h < sizeof(heights) / sizeof(heights[0]); h++)
+            {
+                const size_t width = widths[w], height = heights[h], count = width * height;
+                ScenarioImage(pixels, width, height, 0);
+
+                ChizlSetThreadCount(1);
+                const int rasterOk = DitherImage(pixels, width, height, 0, palette, 12, rasterIndexes, rasterOut,
+                    (DitherMethod)method, DITHER_SCAN_RASTER);
+
+                for (size_t t = 0; t < sizeof(threads) / sizeof(threads[0]); t++)
+                {
+                    size_t errors = rasterOk ? 0 : count;
+                    ChizlSetThreadCount(threads[t]);
+                    if (!DitherImage(pixels, width, height, 0, palette, 12, waveIndexes, waveOut, (DitherMethod)method, DITHER_SCAN_WAVEFRONT))
+                        errors = count;
+                    for (size_t i = 0; errors < count && i < count; i++)
+                        errors += (waveIndexes[i] != rasterIndexes[i] || RgbError(waveOut[i], rasterOut[i]) != 0.0);
+
+                    ScenarioCase(stats, (double)errors, tolerance, "%s %zux%zu %zu threads",
+                        (method == DITHER_ATKINSON) ? "Atkinson" : "Floyd-Steinberg", width, height, threads[t]);
+                }
+            }
+        }
+    }
+
+    ChizlSetThreadCount(savedThreads);
+    free(pixels);
+    free(rasterOut);
+    free(waveOut);
+    free(rasterIndexes);
+    free(waveIndexes);
+}
+
+static inline double AlphaRgbError(RgbColor a, RgbColor b)
+{
+    const double e = RgbError(a, b);
+    const double ea = fabs((double)a.alpha - (double)b.alpha);
+    return (e > ea) ? e : ea;
+}
+
+// First and last stops of GradientFill and of a GradientLut, in every GradientSpace, against the anchors
+// they must reproduce (alpha included).  Two and three anchors, even and explicit positions, several
+// stop counts.
+static void Scenario_GradientEndpoints(ScenarioStats* stats, double tolerance)
+{
+    static const size_t counts[] = { 2, 3, 17, 256 };
+    static const double positions[3] = { 0.0, 0.3, 1.0 };
+    static const char* const spaceNames[] = { "RGB", "linear RGB", "HSL", "HSV", "Lab", "LCH", "Luv" };
+    const RgbColor colors[] = {
+        MakeRgb(0, 0, 0), MakeRgb(255, 255, 255), MakeRgb(128, 128, 128), MakeRgb(255, 0, 0), MakeRgb(0, 255, 0),
+        MakeRgb(0, 0, 255), MakeRgb(0, 255, 255), MakeRgb(255, 0, 255), MakeRgb(255, 255, 0), MakeRgb(1, 2, 3),
+        MakeRgb(254, 253, 252), MakeRgb(200, 30, 40), MakeRgb(20, 120, 220), MakeRgb(96, 180, 64), MakeRgb(250, 210, 0)
+    };
+    const size_t colorCount = sizeof(colors) / sizeof(colors[0]);
+    RgbColor stops[256];
+
+    for (int space = GRADIENT_RGB; space <= GRADIENT_LUV; space++)
+    {
+        for (size_t a = 0; a < colorCount; a++)
+        {
+            for (size_t b = 0; b < colorCount; b++)
+            {
+                RgbColor anchors[3] = { colors[a], colors[(a + b) % colorCount], colors[b] };
+                anchors[0].alpha = 255;
+                anchors[2].alpha = (unsigned char)(b * 17);
+
+                for (size_t n = 2; n <= 3; n++)
+                {
+                    const RgbColor first = anchors[0], last = anchors[n - 1];
+                    for (int explicitPositions = 0; explicitPositions <= 1; explicitPositions++)
+                    {
+                        const double* at = explicitPositions ? ((n == 3) ? positions : NULL) : NULL;
+                        if (explicitPositions && at == NULL)
+                            continue;
+
+                        for (size_t c = 0; c < sizeof(counts) / sizeof(counts[0]); c++)
+                        {
+                            double e = 256.0;
+                            if (GradientFill(anchors, at, n, stops, counts[c], 0, (GradientSpace)space) == counts[c])
+                            {
+                                const double e0 = AlphaRgbError(stops[0], first), e1 = AlphaRgbError(stops[counts[c] - 1], last);
+                                e = (e0 > e1) ? e0 : e1;
+                            }
+                            ScenarioCase(stats, e, tolerance, "fill %s #%02X%02X%02X..#%02X%02X%02X", spaceNames[space],
+                                first.red, first.green, first.blue, last.red, last.green, last.blue);
+                        }
+
+                        GradientLut* lut = GradientLutCreate(anchors, at, n, 0, (GradientSpace)space);
+                        double e = 256.0;
+                        if (lut != NULL)
+                        {
+                            const double e0 = AlphaRgbError(GradientLutSample(lut, 0.0), first);
+                            const double e1 = AlphaRgbError(GradientLutSample(lut, 1.0), last);
+                            e = (e0 > e1) ? e0 : e1;
+                        }
+                        GradientLutFree(lut);
+                        ScenarioCase(stats, e, tolerance, "LUT %s #%02X%02X%02X..#%02X%02X%02X", spaceNames[space],
+                            first.red, first.green, first.blue, last.red, last.green, last.blue);
+                    }
+                }
+            }
+        }
+    }
+}
+
+/// <summary>
+/// Reference stop between a colored anchor and a gray one in a cylindrical space: every channel but hue
+/// interpolated, the hue held at the colored anchor's.  'u' runs from 'color' (0) to 'gray' (1).
+/// </summary>
+static RgbColor GrayHueReference(GradientSpace space, RgbColor color, RgbColor gray, double u)
+{
+    if (space == GRADIENT_LCH)
+    {
+        const LchSpace a = RgbToLch(color), b = RgbToLch(gray);
+        const LchSpace v = { a.l + (b.l - a.l) * u, a.c + (b.c - a.c) * u, a.h };
+        return LchToRgb(v);
+    }
+    if (space == GRADIENT_HSL)
+    {
+        const HslSpace a = RgbToHsl(color), b = RgbToHsl(gray);
+        HslSpace v;
+        memset(&v, 0, sizeof(v));
+        v.hue = a.hue;
+        v.saturation = a.saturation + (b.saturation - a.saturation) * u;
+        v.lightness = a.lightness + (b.lightness - a.lightness) * u;
+        return HslToRgb(v);
+    }
+
+    const HsvSpace a = RgbToHsv(color), b = RgbToHsv(gray);
+    HsvSpace v;
+    memset(&v, 0, sizeof(v));
+    v.hue = a.hue;
+    v.saturation = a.saturation + (b.saturation - a.saturation) * u;
+    v.value = a.value + (b.value - a.value) * u;
+    return HsvToRgb(v);
+}
+
+// A gradient between a colored and a gray anchor (either way round) in HSL, HSV and LCH must keep the
+// colored anchor's hue all the way, only lightness and saturation / chroma move.  Every stop against
+// GrayHueReference, within one 8-bit step for the rounding of the public conversions.
+static void Scenario_GradientGrayHue(ScenarioStats* stats, double tolerance)
+{
+    static const GradientSpace spaces[] = { GRADIENT_HSL, GRADIENT_HSV, GRADIENT_LCH };
+    static const char* const spaceNames[] = { "HSL", "HSV", "LCH" };
+    const RgbColor grays[] = { MakeRgb(0, 0, 0), MakeRgb(128, 128, 128), MakeRgb(255, 255, 255), MakeRgb(37, 37, 37) };
+    const RgbColor colors[] = {
+        MakeRgb(255, 0, 0), MakeRgb(0, 255, 0), MakeRgb(0, 0, 255), MakeRgb(255, 255, 0), MakeRgb(0, 255, 255),
+        MakeRgb(255, 0, 255), MakeRgb(200, 30, 40), MakeRgb(20, 120, 220), MakeRgb(96, 180, 64), MakeRgb(250, 210, 0)
+    };
+    const size_t count = 65;
+    RgbColor stops[65];
+
+    for (size_t s = 0; s < sizeof(spaces) / sizeof(spaces[0]); s++)
+    {
+        for (size_t g = 0; g < sizeof(grays) / sizeof(grays[0]); g++)
+        {
+            for (size_t c = 0; c < sizeof(colors) / sizeof(colors[0]); c++)
+            {
+                for (int grayFirst = 0; grayFirst <= 1; grayFirst++)
+                {
+                    const RgbColor anchors[2] = { grayFirst ? grays[g] : colors[c], grayFirst ? colors[c] : grays[g] };
+                    double e = 256.0;
+                    if (GradientFill(anchors, NULL, 2, stops, count, 0, spaces[s]) == count)
+                    {
+                        e = 0.0;
+                        for (size_t i = 0; i < count; i++)
+                        {
+                            const double t = (double)i / (double)(count - 1);
+                            const RgbColor expected = GrayHueReference(spaces[s], colors[c], grays[g], grayFirst ? 1.0 - t : t);
+                            const double d = RgbError(stops[i], expected);
+                            if (d > e)
+                                e = d;
+                        }
+                    }
+                    ScenarioCase(stats, e, tolerance, "%s #%02X%02X%02X..#%02X%02X%02X", spaceNames[s],
+                        anchors[0].red, anchors[0].green, anchors[0].blue, anchors[1].red, anchors[1].green, anchors[1].blue);
+                }
+            }
+        }
+    }
+}
+
+static const ScenarioCheck s_scenarios[] = {
+    { "LchMaxChroma", "chroma", 1e-5, Scenario_LchMaxChroma },
+    { "GamutMap Table", "8-bit", 2.0, Scenario_GamutMapTable },
+    { "Quantize Invariants", "errors", 0.0, Scenario_QuantizeInvariants },
+    { "QuantizeRemap Nearest", "dE76", 1e-9, Scenario_QuantizeRemapNearest },
+    { "Dither Wavefront", "pixels", 0.0, Scenario_DitherWavefront },
+    { "Gradient Endpoints", "8-bit", 0.0, Scenario_GradientEndpoints },
+    { "Gradient Gray Hue", "8-bit", 1.0, Scenario_GradientGrayHue },
+};
+
+#define ACCURACY_SCENARIO_COUNT (sizeof(s_scenarios) / sizeof(s_scenarios[0]))
+
+static void Usage(void)
+{
+    printf("Usage: C_Accuracy [options]\n"
+        "  --filter TEXT     Only checks whose name contains TEXT\n"
+        "  --threads N       Threads for the sweep, 0 for all cores (default 0)\n"
+        "  --failures N      Failing colors listed per check, up to %d (default 8)\n"
+        "Exits with 0 when every check is within its tolerance, 1 otherwise.\n", ACCURACY_MAX_LISTED);
+}
+
+int main(int argc, char* argv[])
+{
+    const char* filter = NULL;
+    size_t threadCount = 0;
+    size_t listLimit = 8;
+
+    for (int i = 1; i < argc; i++)
+    {
+        const char* arg = argv[i];
+        const char* value = (i + 1 < argc) ? argv[i + 1] : NULL;
+
+        if (strcmp(arg, "--help") == 0 || strcmp(arg, "-h") == 0)
+        {
+            Usage();
+            return 0;
+        }
+        if (value != NULL && strcmp(arg, "--filter") == 0)
+            filter = value;
+        else if (value != NULL && strcmp(arg, "--threads") == 0)
+            threadCount = (size_t)strtoul(value, NULL, 10);
+        else if (value != NULL && strcmp(arg, "--failures") == 0)
+            listLimit = (size_t)strtoul(value, NULL, 10);
+        else
+        {
+            fprintf(stderr, "Unknown or incomplete option: %s\n", arg);
+            Usage();
+            return 1;
+        }
+        i++;
+    }
+
+    if (threadCount == 0)
+        threadCount = ChizlGetThreadCount();
+    if (threadCount > ACCURACY_MAX_THREADS)
+        threadCount = ACCURACY_MAX_THREADS;
+    if (listLimit > ACCURACY_MAX_LISTED)
+        listLimit = ACCURACY_MAX_LISTED;
+
+    unsigned char enabled[ACCURACY_CHECK_COUNT];
+    unsigned char scenarioEnabled[ACCURACY_SCENARIO_COUNT];
+    size_t enabledCount = 0;
+    size_t scenarioCount = 0;
+    for (size_t c = 0; c < ACCURACY_CHECK_COUNT; c++)
+    {
+        enabled[c] = (unsigned char)(filter == NULL || strstr(s_checks[c].name, filter) != NULL);
+        enabledCount += enabled[c];
+    }
+    for (size_t c = 0; c < ACCURACY_SCENARIO_COUNT; c++)
+    {
+        scenarioEnabled[c] = (unsigned char)(filter == NULL || strstr(s_scenarios[c].name, filter) != NULL);
+        scenarioCount += scenarioEnabled[c];
+    }
+    if (enabledCount + scenarioCount == 0)
+    {
+        fprintf(stderr, "No check matches \"%s\".\n", filter);
+        return 1;
+    }
+
+    s_planRgbToLab = ConversionPlanCreate(COLOR_SPACE_RGB, COLOR_SPACE_LAB, WPID_D65_FULL, CAT_BRADFORD);
+    s_planRgbToLchD50 = ConversionPlanCreate(COLOR_SPACE_RGB, COLOR_SPACE_LCH, WPID_D50, CAT_BRADFORD);
+    s_planLchD50ToRgb = ConversionPlanCreate(COLOR_SPACE_LCH, COLOR_SPACE_RGB, WPID_D50, CAT_BRADFORD);
+
+    Worker* workers = (Worker*)calloc(threadCount, sizeof(Worker));
+    CheckStats* stats = (CheckStats*)calloc(threadCount * ACCURACY_CHECK_COUNT, sizeof(CheckStats));
+    if (workers == NULL || stats == NULL || s_planRgbToLab == NULL || s_planRgbToLchD50 == NULL || s_planLchD50ToRgb == NULL)
+    {
+        fprintf(stderr, "Out of memory.\n");
+        return 1;
+    }
+
+    for (size_t t = 0; t < threadCount; t++)
+    {
+        workers[t].index = t;
+        workers[t].threadCount = threadCount;
+        workers[t].enabled = enabled;
+        workers[t].stats = stats + t * ACCURACY_CHECK_COUNT;
+    }
+
+    const double start = ChizlNowMs();
+    if (enabledCount != 0)
+        RunWorkers(workers, threadCount);
+    const double seconds = (ChizlNowMs() - start) / 1000.0;
+
+    for (size_t t = 0; t < threadCount; t++)
+    {
+        if (workers[t].failed)
+        {
+            fprintf(stderr, "Out of memory.\n");
+            return 1;
+        }
+    }
+
+    printf("Chizl.Colors %s accuracy sweep, %u colors x %zu check(s), %zu thread(s), %.1f s\n\n",
+        CHIZL_COLORS_VERSION, 256u * 256u * 256u, enabledCount, threadCount, seconds);
+    if (enabledCount != 0)
+        printf("%-22s %-7s %12s %12s %10s  %-8s %s\n", "Check", "Unit", "Max error", "Tolerance", "Failures", "Worst", "Histogram");
+
+    size_t failedChecks = 0;
+    for (size_t c = 0; c < ACCURACY_CHECK_COUNT; c++)
+    {
+        if (!enabled[c])
+            continue;
+
+        const AccuracyCheck* check = &s_checks[c];
+        const CheckKindInfo* kind = &s_kinds[check->kind];
+        CheckStats total;
+        MergeStats(&total, workers, threadCount, c);
+
+        printf("%-22s %-7s %12.4g %12.4g %10zu  #%02X%02X%02X ", check->name, kind->unit, total.maxError, check->tolerance,
+            total.failures, total.worst.red, total.worst.green, total.worst.blue);
+        for (size_t b = 0; b <= kind->edgeCount; b++)
+            printf(" %s:%zu", kind->labels[b], total.histogram[b]);
+        printf("\n");
+
+        if (total.failures == 0)
+            continue;
+
+        failedChecks++;
+        for (size_t i = 0; i < total.listedCount && i < listLimit; i++)
+        {
+            const FailedColor* f = &total.listed[i];
+            printf("    FAIL #%02X%02X%02X  error %.6g\n", f->color.red, f->color.green, f->color.blue, f->error);
+        }
+    }
+
+    if (scenarioCount != 0)
+    {
+        printf("%s%-22s %-7s %12s %12s %10s %10s  %s\n", (enabledCount != 0) ? "\n" : "",
+            "Scenario", "Unit", "Max error", "Tolerance", "Failures", "Cases", "Worst");
+        for (size_t c = 0; c < ACCURACY_SCENARIO_COUNT; c++)
+        {
+            if (!scenarioEnabled[c])
+                continue;
+
+            const ScenarioCheck* check = &s_scenarios[c];
+            ScenarioStats total;
+            memset(&total, 0, sizeof(total));
+            check->fn(&total, check->tolerance);
+
+            printf("%-22s %-7s %12.4g %12.4g %10zu %10zu  %s\n", check->name, check->unit, total.maxError, check->tolerance,
+                total.failures, total.cases, total.worst);
+            failedChecks += (total.failures != 0);
+        }
+    }
+
+    printf("\n%zu of %zu check(s) failed.\n", failedChecks, enabledCount + scenarioCount);
+
+    ConversionPlanFree(s_planRgbToLab);
+    ConversionPlanFree(s_planRgbToLchD50);
+    ConversionPlanFree(s_planLchD50ToRgb);
+    free(stats);
+    free(workers);
+    return (failedChecks == 0) ? 0 : 1;
+}
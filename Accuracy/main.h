@@ -0,0 +1,21 @@
+// main.h
+#pragma once
+
+// Every public header with a conversion the sweep checks.
+#include "color_support.h"
+#include "rgb_color.h"
+#include "hsl_space.h"
+#include "hsv_space.h"
+#include "xyz_space.h"
+#include "cmyk_space.h"
+#include "lch_space.h"
+#include "luv_space.h"
+#include "oklab_space.h"
+#include "chromatic_adaptation.h"
+#include "conversion_plan.h"
+#include "planar.h"
+#include "parallel.h"
+#include "gamut_map.h"
+#include "quantize.h"
+#include "dither.h"
+#include "gradient.h"
@@ -0,0 +1,1508 @@
+#include <stdio.h>      // printf, fprintf, snprintf
+#include <stdlib.h>     // malloc, free, strtoul
+#include <string.h>     // strcmp, strstr
+#include <math.h>       // sin, sqrt
+#include <time.h>       // time, gmtime_s / gmtime_r
+#include "chizl_clock.h"    // ChizlNowMs
+#include "main.h"
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+  #include <intrin.h>       // __rdtsc
+  #define BENCH_HAS_TSC 1
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+  #include <x86intrin.h>    // __rdtsc
+  #define BENCH_HAS_TSC 1
+#else
+  #define BENCH_HAS_TSC 0
+#endif
+
+// Times every exported conversion, single call and batch, and the palette, gamut mapping, gradient and
+// ANSI functions over two data sets:
+//   cube  - all 16,777,216 24-bit colors in order (every branch of every conversion is hit)
+//   image - a 1920x1080 photo-like frame (smooth gradients, soft edges, noise), or a P6 .ppm via --image
+//
+// Each data set is fed through the function in chunks of BENCH_CHUNK colors (BENCH_PARALLEL_CHUNK for
+// the parallel functions) into one reused output buffer, so the numbers are the conversion and not page
+// faults.  Inputs in another space are made from the RGB chunk before the clock starts.  The best of
+// --reps runs is reported as ns/color, colors/sec and cycles/color (TSC, reference cycles, x86 only).
+// --json writes the same results as JSON for tracking runs over time.
+
+#define BENCH_CHUNK 4096
+#define BENCH_PARALLEL_CHUNK (1024 * 1024)
+#define BENCH_MAX_COLOR_SIZE 32                 // Largest bytes per color of any input or output below
+#define BENCH_CUBE_COLORS (256u * 256u * 256u)
+#define BENCH_IMAGE_WIDTH 1920
+#define BENCH_IMAGE_HEIGHT 1080
+#define BENCH_DEC_SIZE 12                       // "16777215" plus padding, per color
+#define BENCH_PALETTE_SIZE 256                  // Fixed palette for the palette cases, a 6x7x6 cube plus 4 grays
+#define BENCH_ANSI_IMAGE_SIZE 64                // AnsiImage frames are 64x64 pixels, one BENCH_CHUNK
+
+typedef enum {
+    KIND_SINGLE,
+    KIND_BATCH,
+    KIND_PARALLEL
+} BenchKind;
+
+static const char* const s_kindNames[] = { "single", "batch", "parallel" };
+
+typedef struct BenchCase BenchCase;
+
+// Builds a chunk of input from RGB, outside the timing.
+typedef void (*BenchPrepFn)(const RgbColor* rgb, void* in, size_t count);
+// The timed part, converts 'count' colors from in to out.
+typedef void (*BenchRunFn)(const BenchCase* bench, const void* in, void* out, size_t count);
+
+struct BenchCase {
+    const char* name;
+    BenchKind kind;
+    size_t inSize;              // Bytes per color
+    size_t outSize;
+    BenchPrepFn prep;           // NULL when the input is the RGB chunk itself
+    BenchRunFn run;
+    ConversionPlan** plan;      // Plan cases only
+};
+
+typedef struct {
+    const char* name;
+    char source[260];
+    RgbColor* rgb;
+    size_t count;
+} BenchDataset;
+
+typedef struct {
+    const BenchCase* bench;
+    const BenchDataset* data;
+    double bestNs;              // Per color
+    double meanNs;
+    double cycles;              // Per color, best run
+} BenchResult;
+
+static unsigned char* s_scratch = NULL;         // Temporary for two step preps
+
+static ConversionPlan* s_planRgbToLab = NULL;
+static ConversionPlan* s_planHsvToLab = NULL;
+static ConversionPlan* s_planRgbToLabD50 = NULL;
+static ConversionPlan* s_planLabToLch = NULL;
+
+static RgbColor s_palette[BENCH_PALETTE_SIZE];
+static RgbColor s_quantized[QUANTIZE_MAX_COLORS];  // QuantizeImage output palette, overwritten each chunk
+static RgbColor s_gradientAnchors[4];
+static GradientLut* s_gradientLut = NULL;
+static LabSpace s_paletteLabs[BENCH_PALETTE_SIZE];
+static PaletteIndex* s_paletteIndex = NULL;
+static PaletteCache* s_paletteCacheFull = NULL;
+static PaletteCache* s_paletteCacheReduced = NULL;
+static AnsiBuffer* s_ansiBuffer = NULL;
+static AnsiImage* s_ansiImage = NULL;
+
+static inline unsigned long long ReadCycles(void)
+{
+#if BENCH_HAS_TSC
+    return (unsigned long long)__rdtsc();
+#else
+    return 0;
+#endif
+}
+
+// --- Case wrappers ---
+
+#define SINGLE(fn, InT, OutT) \
+    static void Run_##fn(const BenchCase* bench, const void* in, void* out, size_t count) \
+    { \
+        const InT* src = (const InT*)in; \
+        OutT* dst = (OutT*)out; \
+        (void)bench; \
+        for (size_t i = 0; i < count; i++) \
+            dst[i] = fn(src[i]); \
+    }
+
+#define SINGLE_ARGS(fn, InT, OutT, ...) \
+    static void Run_##fn(const BenchCase* bench, const void* in, void* out, size_t count) \
+    { \
+        const InT* src = (const InT*)in; \
+        OutT* dst = (OutT*)out; \
+        (void)bench; \
+        for (size_t i = 0; i < count; i++) \
+            dst[i] = fn(src[i], __VA_ARGS__); \
+    }
+
+#define BATCH(fn, InT, OutT) \
+    static void Run_##fn(const BenchCase* bench, const void* in, void* out, size_t count) \
+    { \
+        (void)bench; \
+        fn((const InT*)in, (OutT*)out, count, 0); \
+    }
+
+#define BATCH_ARGS(fn, InT, OutT, ...) \
+    static void Run_##fn(const BenchCase* bench, const void* in, void* out, size_t count) \
+    { \
+        (void)bench; \
+        fn((const InT*)in, (OutT*)out, count, 0, __VA_ARGS__); \
+    }
+
+#define PREP(fn, OutT) \
+    static void Prep_##fn(const RgbColor* rgb, void* in, size_t count) { fn(rgb, (OutT*)in, count, 0); }
+
+PREP(RgbToHsvBatch, HsvSpace)
+PREP(RgbToHslBatch, HslSpace)
+PREP(RgbToCmykBatch, CmykSpace)
+PREP(RgbToXyzBatch, XyzSpace)
+PREP(RgbToLabBatch, LabSpace)
+PREP(RgbToLuvBatch, LuvSpace)
+PREP(RgbToLchBatch, LchSpace)
+PREP(RgbToOkLabBatch, OkLabSpace)
+PREP(RgbToOkLchBatch, OkLchSpace)
+PREP(RgbToHsvFBatch, HsvSpaceF)
+PREP(RgbToHslFBatch, HslSpaceF)
+PREP(RgbToCmykFBatch, CmykSpaceF)
+PREP(RgbToXyzFBatch, XyzSpaceF)
+PREP(RgbToLabFBatch, LabSpaceF)
+PREP(RgbToLuvFBatch, LuvSpaceF)
+PREP(RgbToLchFBatch, LchSpaceF)
+PREP(RgbToHsvU16Batch, HsvSpaceU16)
+PREP(RgbToHslU16Batch, HslSpaceU16)
+PREP(RgbToCmykU16Batch, CmykSpaceU16)
+
+static void Prep_LabD50(const RgbColor* rgb, void* in, size_t count)
+{
+    RgbToLabExBatch(rgb, (LabSpace*)in, count, 0, WPID_D50, CAT_BRADFORD);
+}
+
+static void Prep_RgbDec(const RgbColor* rgb, void* in, size_t count)
+{
+    chizl_color32* dst = (chizl_color32*)in;
+    for (size_t i = 0; i < count; i++)
+        dst[i] = RgbToRgbDec(rgb[i]);
+}
+
+static void Prep_ArgbDec(const RgbColor* rgb, void* in, size_t count)
+{
+    chizl_color32* dst = (chizl_color32*)in;
+    for (size_t i = 0; i < count; i++)
+        dst[i] = RgbToArgbDec(rgb[i]);
+}
+
+static void Prep_DecStrings(const RgbColor* rgb, void* in, size_t count)
+{
+    char* dst = (char*)in;
+    for (size_t i = 0; i < count; i++)
+        snprintf(dst + i * BENCH_DEC_SIZE, BENCH_DEC_SIZE, "%u", (unsigned int)RgbToRgbDec(rgb[i]));
+}
+
+// One null terminated "#RRGGBB" per CHIZL_RGB_HEX_SIZE chars.
+static void Prep_HexStrings(const RgbColor* rgb, void* in, size_t count)
+{
+    RgbToRgbHexBatch(rgb, (char*)in, count, 0, '\0');
+}
+
+// "#RRGGBB,#RRGGBB,...", count * CHIZL_RGB_HEX_SIZE - 1 chars.
+static void Prep_HexList(const RgbColor* rgb, void* in, size_t count)
+{
+    RgbToRgbHexBatch(rgb, (char*)in, count, 0, ',');
+}
+
+// Planes r, g, b, a of 'count' bytes each.
+static void Prep_RgbPlanes(const RgbColor* rgb, void* in, size_t count)
+{
+    unsigned char* p = (unsigned char*)in;
+    RgbDeinterleave(rgb, p, p + count, p + 2 * count, p + 3 * count, count);
+}
+
+// Planes l, a, b of 'count' doubles each.
+static void Prep_LabPlanes(const RgbColor* rgb, void* in, size_t count)
+{
+    double* p = (double*)in;
+    RgbToLabBatch(rgb, (LabSpace*)s_scratch, count, 0);
+    LabDeinterleave((const LabSpace*)s_scratch, p, p + count, p + 2 * count, count);
+}
+
+// RGB to ...
+SINGLE(RgbToHsv, RgbColor, HsvSpace)
+SINGLE(RgbToHsl, RgbColor, HslSpace)
+SINGLE(RgbToCmyk, RgbColor, CmykSpace)
+SINGLE(RgbToXyz, RgbColor, XyzSpace)
+SINGLE(RgbToLab, RgbColor, LabSpace)
+SINGLE(RgbToLuv, RgbColor, LuvSpace)
+SINGLE(RgbToLch, RgbColor, LchSpace)
+SINGLE(RgbToOkLab, RgbColor, OkLabSpace)
+SINGLE(RgbToOkLch, RgbColor, OkLchSpace)
+SINGLE(RgbToHsvF, RgbColor, HsvSpaceF)
+SINGLE(RgbToHslF, RgbColor, HslSpaceF)
+SINGLE(RgbToCmykF, RgbColor, CmykSpaceF)
+SINGLE(RgbToXyzF, RgbColor, XyzSpaceF)
+SINGLE(RgbToLabF, RgbColor, LabSpaceF)
+SINGLE(RgbToLuvF, RgbColor, LuvSpaceF)
+SINGLE(RgbToLchF, RgbColor, LchSpaceF)
+SINGLE(RgbToHsvU16, RgbColor, HsvSpaceU16)
+SINGLE(RgbToHslU16, RgbColor, HslSpaceU16)
+SINGLE(RgbToCmykU16, RgbColor, CmykSpaceU16)
+SINGLE(RgbToRgbDec, RgbColor, chizl_color32)
+SINGLE(RgbToArgbDec, RgbColor, chizl_color32)
+SINGLE_ARGS(RgbToLabEx, RgbColor, LabSpace, WPID_D50, CAT_BRADFORD)
+
+// ... to RGB
+SINGLE(HsvToRgb, HsvSpace, RgbColor)
+SINGLE(HslToRgb, HslSpace, RgbColor)
+SINGLE(CmykToRgb, CmykSpace, RgbColor)
+SINGLE(XyzToRgb, XyzSpace, RgbColor)
+SINGLE(LabToRgb, LabSpace, RgbColor)
+SINGLE(LuvToRgb, LuvSpace, RgbColor)
+SINGLE(LchToRgb, LchSpace, RgbColor)
+SINGLE(OkLabToRgb, OkLabSpace, RgbColor)
+SINGLE(OkLchToRgb, OkLchSpace, RgbColor)
+SINGLE(HsvFToRgb, HsvSpaceF, RgbColor)
+SINGLE(HslFToRgb, HslSpaceF, RgbColor)
+SINGLE(CmykFToRgb, CmykSpaceF, RgbColor)
+SINGLE(XyzFToRgb, XyzSpaceF, RgbColor)
+SINGLE(LabFToRgb, LabSpaceF, RgbColor)
+SINGLE(LuvFToRgb, LuvSpaceF, RgbColor)
+SINGLE(LchFToRgb, LchSpaceF, RgbColor)
+SINGLE(HsvU16ToRgb, HsvSpaceU16, RgbColor)
+SINGLE(HslU16ToRgb, HslSpaceU16, RgbColor)
+SINGLE(CmykU16ToRgb, CmykSpaceU16, RgbColor)
+SINGLE(RgbFromRgbDec, chizl_color32, RgbColor)
+SINGLE(RgbFromArgbDec, chizl_color32, RgbColor)
+SINGLE_ARGS(LabToRgbEx, LabSpace, RgbColor, WPID_D50, CAT_BRADFORD)
+
+// Between the CIE spaces
+SINGLE(XyzToLab, XyzSpace, LabSpace)
+SINGLE(LabToXyz, LabSpace, XyzSpace)
+SINGLE(XyzToLuv, XyzSpace, LuvSpace)
+SINGLE(LuvToXyz, LuvSpace, XyzSpace)
+SINGLE(LabToLch, LabSpace, LchSpace)
+SINGLE(LchToLab, LchSpace, LabSpace)
+SINGLE(OkLabToOkLch, OkLabSpace, OkLchSpace)
+SINGLE(OkLchToOkLab, OkLchSpace, OkLabSpace)
+SINGLE_ARGS(XyzToLabEx, XyzSpace, LabSpace, WPID_D50)
+SINGLE_ARGS(LabToXyzEx, LabSpace, XyzSpace, WPID_D50)
+SINGLE_ARGS(XyzToLuvEx, XyzSpace, LuvSpace, WPID_D50)
+SINGLE_ARGS(LuvToXyzEx, LuvSpace, XyzSpace, WPID_D50)
+SINGLE_ARGS(XyzAdapt, XyzSpace, XyzSpace, WPID_D65_FULL, WPID_D50, CAT_BRADFORD)
+
+// Text
+static void Run_RgbToRgbHexInto(const BenchCase* bench, const void* in, void* out, size_t count)
+{
+    const RgbColor* src = (const RgbColor*)in;
+    char* dst = (char*)out;
+    (void)bench;
+    for (size_t i = 0; i < count; i++)
+        RgbToRgbHexInto(src[i], 0, dst + i * CHIZL_RGB_HEX_SIZE, CHIZL_RGB_HEX_SIZE);
+}
+
+static void Run_RgbFromHex(const BenchCase* bench, const void* in, void* out, size_t count)
+{
+    const char* src = (const char*)in;
+    RgbColor* dst = (RgbColor*)out;
+    (void)bench;
+    for (size_t i = 0; i < count; i++)
+        RgbFromHex(src + i * CHIZL_RGB_HEX_SIZE, &dst[i]);
+}
+
+static void Run_RgbFromDecString(const BenchCase* bench, const void* in, void* out, size_t count)
+{
+    const char* src = (const char*)in;
+    RgbColor* dst = (RgbColor*)out;
+    (void)bench;
+    for (size_t i = 0; i < count; i++)
+        RgbFromDecString(src + i * BENCH_DEC_SIZE, 0, &dst[i]);
+}
+
+static void Run_RgbToRgbHexBatch(const BenchCase* bench, const void* in, void* out, size_t count)
+{
+    (void)bench;
+    RgbToRgbHexBatch((const RgbColor*)in, (char*)out, count, 0, ',');
+}
+
+static void Run_RgbFromHexBatch(const BenchCase* bench, const void* in, void* out, size_t count)
+{
+    (void)bench;
+    RgbFromHexBatch((const char*)in, count * CHIZL_RGB_HEX_SIZE - 1, (RgbColor*)out, count, NULL);
+}
+
+// Batch
+BATCH(RgbToHsvBatch, RgbColor, HsvSpace)
+BATCH(RgbToHslBatch, RgbColor, HslSpace)
+BATCH(RgbToCmykBatch, RgbColor, CmykSpace)
+BATCH(RgbToXyzBatch, RgbColor, XyzSpace)
+BATCH(RgbToLabBatch, RgbColor, LabSpace)
+BATCH(RgbToLuvBatch, RgbColor, LuvSpace)
+BATCH(RgbToLchBatch, RgbColor, LchSpace)
+BATCH(RgbToOkLabBatch, RgbColor, OkLabSpace)
+BATCH(RgbToOkLchBatch, RgbColor, OkLchSpace)
+BATCH(RgbToHsvFBatch, RgbColor, HsvSpaceF)
+BATCH(RgbToHslFBatch, RgbColor, HslSpaceF)
+BATCH(RgbToCmykFBatch, RgbColor, CmykSpaceF)
+BATCH(RgbToXyzFBatch, RgbColor, XyzSpaceF)
+BATCH(RgbToLabFBatch, RgbColor, LabSpaceF)
+BATCH(RgbToLuvFBatch, RgbColor, LuvSpaceF)
+BATCH(RgbToLchFBatch, RgbColor, LchSpaceF)
+BATCH(RgbToHsvU16Batch, RgbColor, HsvSpaceU16)
+BATCH(RgbToHslU16Batch, RgbColor, HslSpaceU16)
+BATCH(RgbToCmykU16Batch, RgbColor, CmykSpaceU16)
+BATCH_ARGS(RgbToLabExBatch, RgbColor, LabSpace, WPID_D50, CAT_BRADFORD)
+BATCH(XyzToRgbBatch, XyzSpace, RgbColor)
+BATCH(LabToRgbBatch, LabSpace, RgbColor)
+BATCH(LuvToRgbBatch, LuvSpace, RgbColor)
+BATCH(LchToRgbBatch, LchSpace, RgbColor)
+BATCH(OkLabToRgbBatch, OkLabSpace, RgbColor)
+BATCH(OkLchToRgbBatch, OkLchSpace, RgbColor)
+BATCH(HsvFToRgbBatch, HsvSpaceF, RgbColor)
+BATCH(HslFToRgbBatch, HslSpaceF, RgbColor)
+BATCH(CmykFToRgbBatch, CmykSpaceF, RgbColor)
+BATCH(XyzFToRgbBatch, XyzSpaceF, RgbColor)
+BATCH(LabFToRgbBatch, LabSpaceF, RgbColor)
+BATCH(LuvFToRgbBatch, LuvSpaceF, RgbColor)
+BATCH(LchFToRgbBatch, LchSpaceF, RgbColor)
+BATCH(HsvU16ToRgbBatch, HsvSpaceU16, RgbColor)
+BATCH(HslU16ToRgbBatch, HslSpaceU16, RgbColor)
+BATCH(CmykU16ToRgbBatch, CmykSpaceU16, RgbColor)
+BATCH_ARGS(LabToRgbExBatch, LabSpace, RgbColor, WPID_D50, CAT_BRADFORD)
+BATCH_ARGS(XyzAdaptBatch, XyzSpace, XyzSpace, WPID_D65_FULL, WPID_D50, CAT_BRADFORD)
+
+// Parallel
+BATCH(RgbToHsvParallel, RgbColor, HsvSpace)
+BATCH(RgbToHslParallel, RgbColor, HslSpace)
+BATCH(RgbToCmykParallel, RgbColor, CmykSpace)
+BATCH(RgbToXyzParallel, RgbColor, XyzSpace)
+BATCH(RgbToLabParallel, RgbColor, LabSpace)
+BATCH(RgbToLuvParallel, RgbColor, LuvSpace)
+BATCH(RgbToLchParallel, RgbColor, LchSpace)
+
+// Planar, planes laid out one after the other in the chunk buffers
+static void Run_RgbDeinterleave(const BenchCase* bench, const void* in, void* out, size_t count)
+{
+    unsigned char* p = (unsigned char*)out;
+    (void)bench;
+    RgbDeinterleave((const RgbColor*)in, p, p + count, p + 2 * count, p + 3 * count, count);
+}
+
+static void Run_RgbInterleave(const BenchCase* bench, const void* in, void* out, size_t count)
+{
+    const unsigned char* p = (const unsigned char*)in;
+    (void)bench;
+    RgbInterleave(p, p + count, p + 2 * count, p + 3 * count, (RgbColor*)out, count);
+}
+
+static void Run_LabDeinterleave(const BenchCase* bench, const void* in, void* out, size_t count)
+{
+    double* p = (double*)out;
+    (void)bench;
+    LabDeinterleave((const LabSpace*)in, p, p + count, p + 2 * count, count);
+}
+
+static void Run_LabInterleave(const BenchCase* bench, const void* in, void* out, size_t count)
+{
+    const double* p = (const double*)in;
+    (void)bench;
+    LabInterleave(p, p + count, p + 2 * count, (LabSpace*)out, count);
+}
+
+static void Run_RgbPlanarToLabPlanar(const BenchCase* bench, const void* in, void* out, size_t count)
+{
+    const unsigned char* s = (const unsigned char*)in;
+    double* d = (double*)out;
+    (void)bench;
+    RgbPlanarToLabPlanar(s, s + count, s + 2 * count, d, d + count, d + 2 * count, count);
+}
+
+static void Run_RgbPlanarToLabPlanarF(const BenchCase* bench, const void* in, void* out, size_t count)
+{
+    const unsigned char* s = (const unsigned char*)in;
+    float* d = (float*)out;
+    (void)bench;
+    RgbPlanarToLabPlanarF(s, s + count, s + 2 * count, d, d + count, d + 2 * count, count);
+}
+
+static void Run_LabPlanarToRgbPlanar(const BenchCase* bench, const void* in, void* out, size_t count)
+{
+    const double* s = (const double*)in;
+    unsigned char* d = (unsigned char*)out;
+    (void)bench;
+    LabPlanarToRgbPlanar(s, s + count, s + 2 * count, d, d + count, d + 2 * count, count);
+}
+
+// Gradient positions 0.0 - 1.0, the 24-bit value of each color scaled.
+static void Prep_GradientT(const RgbColor* rgb, void* in, size_t count)
+{
+    double* dst = (double*)in;
+    for (size_t i = 0; i < count; i++)
+        dst[i] = (double)RgbToRgbDec(rgb[i]) / 16777215.0;
+}
+
+// Gradients, through the four fixed anchors in LCH
+static void Run_GradientFill(const BenchCase* bench, const void* in, void* out, size_t count)
+{
+    (void)bench;
+    (void)in;
+    GradientFill(s_gradientAnchors, NULL, 4, (RgbColor*)out, count, 0, GRADIENT_LCH);
+}
+
+static void Run_GradientLutSample(const BenchCase* bench, const void* in, void* out, size_t count)
+{
+    const double* src = (const double*)in;
+    RgbColor* dst = (RgbColor*)out;
+    (void)bench;
+    for (size_t i = 0; i < count; i++)
+        dst[i] = GradientLutSample(s_gradientLut, src[i]);
+}
+
+static void Run_GradientLutSampleBatch(const BenchCase* bench, const void* in, void* out, size_t count)
+{
+    (void)bench;
+    GradientLutSampleBatch(s_gradientLut, (const double*)in, (RgbColor*)out, count, 0);
+}
+
+// Delta-E over pairs from the same Lab chunk: each color of the first half against the color half a chunk
+// later, so the pairs are unrelated colors.  One-to-many compares the chunk against a fixed mid gray.
+static const LabSpace s_deltaERef = { 53.39, 0.0, 0.0 };
+
+#define DELTAE_SINGLE(fn) \
+    static void Run_##fn(const BenchCase* bench, const void* in, void* out, size_t count) \
+    { \
+        const LabSpace* src = (const LabSpace*)in; \
+        double* dst = (double*)out; \
+        const size_t half = count / 2; \
+        (void)bench; \
+        for (size_t i = 0; i < count; i++) \
+            dst[i] = fn(src[i], src[(i < half) ? i + half : i - half]); \
+    }
+
+#define DELTAE_BATCH(name, type) \
+    static void Run_##name(const BenchCase* bench, const void* in, void* out, size_t count) \
+    { \
+        const LabSpace* src = (const LabSpace*)in; \
+        double* dst = (double*)out; \
+        const size_t half = count / 2; \
+        (void)bench; \
+        DeltaEPairs(src, src + half, dst, half, type); \
+        DeltaEPairs(src + half, src, dst + half, count - half, type); \
+    } \
+    static void Run_##name##OneToMany(const BenchCase* bench, const void* in, void* out, size_t count) \
+    { \
+        (void)bench; \
+        DeltaEOneToMany(s_deltaERef, (const LabSpace*)in, (double*)out, count, type); \
+    }
+
+DELTAE_SINGLE(DeltaE76)
+DELTAE_SINGLE(DeltaE94)
+DELTAE_SINGLE(DeltaE2000)
+DELTAE_BATCH(DeltaEPairs76, DELTAE_CIE76)
+DELTAE_BATCH(DeltaEPairs94, DELTAE_CIE94)
+DELTAE_BATCH(DeltaEPairs2000, DELTAE_CIEDE2000)
+
+// DeltaE with the formula picked at run time, the dispatch cost over DeltaE2000.
+static void Run_DeltaE(const BenchCase* bench, const void* in, void* out, size_t count)
+{
+    const LabSpace* src = (const LabSpace*)in;
+    double* dst = (double*)out;
+    const size_t half = count / 2;
+    (void)bench;
+    for (size_t i = 0; i < count; i++)
+        dst[i] = DeltaE(src[i], src[(i < half) ? i + half : i - half], DELTAE_CIEDE2000);
+}
+
+// Gamut mapping, LCH from the chunk with chroma raised so most colors are outside sRGB.
+static void Prep_LchOutOfGamut(const RgbColor* rgb, void* in, size_t count)
+{
+    LchSpace* lch = (LchSpace*)in;
+    RgbToLchBatch(rgb, lch, count, 0);
+    for (size_t i = 0; i < count; i++)
+        lch[i].c = lch[i].c * 1.5 + 20.0;
+}
+
+static void Run_LchMaxChroma(const BenchCase* bench, const void* in, void* out, size_t count)
+{
+    const LchSpace* src = (const LchSpace*)in;
+    double* dst = (double*)out;
+    (void)bench;
+    for (size_t i = 0; i < count; i++)
+        dst[i] = LchMaxChroma(src[i].l, src[i].h);
+}
+
+SINGLE_ARGS(LchToRgbMapped, LchSpace, RgbColor, GAMUT_MAP_CSS)
+
+static void Run_LchToRgbMappedTable(const BenchCase* bench, const void* in, void* out, size_t count)
+{
+    const LchSpace* src = (const LchSpace*)in;
+    RgbColor* dst = (RgbColor*)out;
+    (void)bench;
+    for (size_t i = 0; i < count; i++)
+        dst[i] = LchToRgbMapped(src[i], GAMUT_MAP_TABLE);
+}
+
+BATCH_ARGS(LchToRgbMappedBatch, LchSpace, RgbColor, GAMUT_MAP_CSS)
+
+static void Run_LchToRgbMappedBatchTable(const BenchCase* bench, const void* in, void* out, size_t count)
+{
+    (void)bench;
+    LchToRgbMappedBatch((const LchSpace*)in, (RgbColor*)out, count, 0, GAMUT_MAP_TABLE);
+}
+
+// Nearest palette color, by linear DeltaENearest scan, by PaletteIndex search and by PaletteCache table.
+// The Lab inputs use CIE76, the scan against the tree with the same formula.
+static void Run_DeltaENearest(const BenchCase* bench, const void* in, void* out, size_t count)
+{
+    const LabSpace* src = (const LabSpace*)in;
+    size_t* dst = (size_t*)out;
+    (void)bench;
+    for (size_t i = 0; i < count; i++)
+        dst[i] = DeltaENearest(src[i], s_paletteLabs, BENCH_PALETTE_SIZE, DELTAE_CIE76, NULL);
+}
+
+static void Run_PaletteIndexNearestLab(const BenchCase* bench, const void* in, void* out, size_t count)
+{
+    const LabSpace* src = (const LabSpace*)in;
+    size_t* dst = (size_t*)out;
+    (void)bench;
+    for (size_t i = 0; i < count; i++)
+        dst[i] = PaletteIndexNearestLab(s_paletteIndex, src[i], DELTAE_CIE76, NULL);
+}
+
+static void Run_PaletteIndexNearest76(const BenchCase* bench, const void* in, void* out, size_t count)
+{
+    const RgbColor* src = (const RgbColor*)in;
+    size_t* dst = (size_t*)out;
+    (void)bench;
+    for (size_t i = 0; i < count; i++)
+        dst[i] = PaletteIndexNearest(s_paletteIndex, src[i], DELTAE_CIE76, NULL);
+}
+
+static void Run_PaletteIndexNearest2000(const BenchCase* bench, const void* in, void* out, size_t count)
+{
+    const RgbColor* src = (const RgbColor*)in;
+    size_t* dst = (size_t*)out;
+    (void)bench;
+    for (size_t i = 0; i < count; i++)
+        dst[i] = PaletteIndexNearest(s_paletteIndex, src[i], DELTAE_CIEDE2000, NULL);
+}
+
+static void Run_PaletteIndexNearestBatch76(const BenchCase* bench, const void* in, void* out, size_t count)
+{
+    (void)bench;
+    PaletteIndexNearestBatch(s_paletteIndex, (const RgbColor*)in, (size_t*)out, NULL, count, DELTAE_CIE76);
+}
+
+static void Run_PaletteIndexNearestBatch2000(const BenchCase* bench, const void* in, void* out, size_t count)
+{
+    (void)bench;
+    PaletteIndexNearestBatch(s_paletteIndex, (const RgbColor*)in, (size_t*)out, NULL, count, DELTAE_CIEDE2000);
+}
+
+static void Run_PaletteCacheLookup(const BenchCase* bench, const void* in, void* out, size_t count)
+{
+    const RgbColor* src = (const RgbColor*)in;
+    size_t* dst = (size_t*)out;
+    (void)bench;
+    for (size_t i = 0; i < count; i++)
+        dst[i] = PaletteCacheLookup(s_paletteCacheFull, src[i]);
+}
+
+static void Run_PaletteCacheLookupBatch(const BenchCase* bench, const void* in, void* out, size_t count)
+{
+    (void)bench;
+    PaletteCacheLookupBatch(s_paletteCacheFull, (const RgbColor*)in, (size_t*)out, count);
+}
+
+static void Run_PaletteCacheLookupBatchReduced(const BenchCase* bench, const void* in, void* out, size_t count)
+{
+    (void)bench;
+    PaletteCacheLookupBatch(s_paletteCacheReduced, (const RgbColor*)in, (size_t*)out, count);
+}
+
+// ANSI console output.  Sequences go to the chunk buffer, AnsiBuffer and AnsiImage output is dropped
+// with AnsiBufferClear at the end of each chunk instead of being written to the console.
+SINGLE(AnsiNearest256, RgbColor, unsigned char)
+SINGLE(AnsiNearest16, RgbColor, unsigned char)
+
+static void Run_AnsiSgrColor(const BenchCase* bench, const void* in, void* out, size_t count)
+{
+    const RgbColor* src = (const RgbColor*)in;
+    char* dst = (char*)out;
+    (void)bench;
+    for (size_t i = 0; i < count; i++)
+        AnsiSgrColor(src[i], 0, ANSI_COLOR_24BIT, dst + i * CHIZL_SGR_SIZE, CHIZL_SGR_SIZE);
+}
+
+static void Run_AnsiSgrColor256(const BenchCase* bench, const void* in, void* out, size_t count)
+{
+    const RgbColor* src = (const RgbColor*)in;
+    char* dst = (char*)out;
+    (void)bench;
+    for (size_t i = 0; i < count; i++)
+        AnsiSgrColor(src[i], 0, ANSI_COLOR_256, dst + i * CHIZL_SGR_SIZE, CHIZL_SGR_SIZE);
+}
+
+// One colored character per color, the way a text renderer writes cells.
+static void Run_AnsiBufferSetFg(const BenchCase* bench, const void* in, void* out, size_t count)
+{
+    const RgbColor* src = (const RgbColor*)in;
+    (void)bench;
+    (void)out;
+    for (size_t i = 0; i < count; i++)
+    {
+        AnsiBufferSetFg(s_ansiBuffer, src[i]);
+        AnsiBufferWrite(s_ansiBuffer, "#", 1);
+    }
+    AnsiBufferClear(s_ansiBuffer);
+}
+
+// A full 64x64 frame per chunk, padded by Prep_AnsiFrame when the last chunk is short.  Consecutive
+// chunks are different frames, so this is close to a full repaint each time.
+static void Prep_AnsiFrame(const RgbColor* rgb, void* in, size_t count)
+{
+    RgbColor* dst = (RgbColor*)in;
+    for (size_t i = 0; i < BENCH_ANSI_IMAGE_SIZE * BENCH_ANSI_IMAGE_SIZE; i++)
+        dst[i] = rgb[i % count];
+}
+
+static void Run_AnsiImageRender(const BenchCase* bench, const void* in, void* out, size_t count)
+{
+    (void)bench;
+    (void)out;
+    (void)count;
+    AnsiImageRender(s_ansiImage, (const RgbColor*)in, 0, 1, 1, s_ansiBuffer);
+    AnsiBufferClear(s_ansiBuffer);
+}
+
+// Quantization, every chunk is quantized as one image into 8-bit indexes
+static void Run_QuantizeMedianCut(const BenchCase* bench, const void* in, void* out, size_t count)
+{
+    (void)bench;
+    QuantizeImage((const RgbColor*)in, count, s_quantized, QUANTIZE_MAX_COLORS, (unsigned char*)out, QUANTIZE_MEDIAN_CUT);
+}
+
+static void Run_QuantizeKMeans(const BenchCase* bench, const void* in, void* out, size_t count)
+{
+    (void)bench;
+    QuantizeImage((const RgbColor*)in, count, s_quantized, QUANTIZE_MAX_COLORS, (unsigned char*)out, QUANTIZE_KMEANS);
+}
+
+static void Run_QuantizeRemap(const BenchCase* bench, const void* in, void* out, size_t count)
+{
+    (void)bench;
+    QuantizeRemap((const RgbColor*)in, count, s_palette, BENCH_PALETTE_SIZE, (unsigned char*)out);
+}
+
+// Dithering onto the fixed palette.  A chunk is dithered as rows of 64 pixels for batch cases (a 64x64
+// image) and 1024 for parallel ones (1024x1024), the pixels past the last full row as one short row.
+static void DitherChunk(const BenchCase* bench, const void* in, void* out, size_t count, DitherMethod method, DitherScan scan)
+{
+    const RgbColor* src = (const RgbColor*)in;
+    unsigned char* dst = (unsigned char*)out;
+    const size_t width = (bench->kind == KIND_PARALLEL) ? 1024 : 64;
+    const size_t rows = count / width;
+
+    if (rows != 0)
+        DitherImage(src, width, rows, 0, s_palette, BENCH_PALETTE_SIZE, dst, NULL, method, scan);
+    if (count > rows * width)
+        DitherImage(src + rows * width, count - rows * width, 1, 0, s_palette, BENCH_PALETTE_SIZE, dst + rows * width, NULL, method, scan);
+}
+
+static void Run_DitherFloydSteinberg(const BenchCase* bench, const void* in, void* out, size_t count)
+{
+    DitherChunk(bench, in, out, count, DITHER_FLOYD_STEINBERG, (bench->kind == KIND_PARALLEL) ? DITHER_SCAN_WAVEFRONT : DITHER_SCAN_RASTER);
+}
+
+static void Run_DitherAtkinson(const BenchCase* bench, const void* in, void* out, size_t count)
+{
+    DitherChunk(bench, in, out, count, DITHER_ATKINSON, (bench->kind == KIND_PARALLEL) ? DITHER_SCAN_WAVEFRONT : DITHER_SCAN_RASTER);
+}
+
+static void Run_DitherBayer(const BenchCase* bench, const void* in, void* out, size_t count)
+{
+    DitherChunk(bench, in, out, count, DITHER_BAYER, DITHER_SCAN_RASTER);
+}
+
+// Conversion plans
+static void Run_PlanSingle(const BenchCase* bench, const void* in, void* out, size_t count)
+{
+    const unsigned char* src = (const unsigned char*)in;
+    unsigned char* dst = (unsigned char*)out;
+    for (size_t i = 0; i < count; i++)
+        ConversionPlanConvert(*bench->plan, src + i * bench->inSize, dst + i * bench->outSize);
+}
+
+static void Run_PlanBatch(const BenchCase* bench, const void* in, void* out, size_t count)
+{
+    ConversionPlanConvertBatch(*bench->plan, in, out, count, 0);
+}
+
+#define CASE(fn, kind, InT, OutT, prep) { #fn, kind, sizeof(InT), sizeof(OutT), prep, Run_##fn, NULL }
+#define CASE_SIZED(fn, kind, inSize, outSize, prep) { #fn, kind, inSize, outSize, prep, Run_##fn, NULL }
+#define CASE_NAMED(name, kind, InT, OutT, prep, run) { name, kind, sizeof(InT), sizeof(OutT), prep, run, NULL }
+#define CASE_PLAN(name, kind, InT, OutT, prep, run, plan) { name, kind, sizeof(InT), sizeof(OutT), prep, run, &plan }
+
+static const BenchCase s_cases[] = {
+    CASE(RgbToHsv, KIND_SINGLE, RgbColor, HsvSpace, NULL),
+    CASE(RgbToHsl, KIND_SINGLE, RgbColor, HslSpace, NULL),
+    CASE(RgbToCmyk, KIND_SINGLE, RgbColor, CmykSpace, NULL),
+    CASE(RgbToXyz, KIND_SINGLE, RgbColor, XyzSpace, NULL),
+    CASE(RgbToLab, KIND_SINGLE, RgbColor, LabSpace, NULL),
+    CASE(RgbToLuv, KIND_SINGLE, RgbColor, LuvSpace, NULL),
+    CASE(RgbToLch, KIND_SINGLE, RgbColor, LchSpace, NULL),
+    CASE(RgbToOkLab, KIND_SINGLE, RgbColor, OkLabSpace, NULL),
+    CASE(RgbToOkLch, KIND_SINGLE, RgbColor, OkLchSpace, NULL),
+    CASE(RgbToHsvF, KIND_SINGLE, RgbColor, HsvSpaceF, NULL),
+    CASE(RgbToHslF, KIND_SINGLE, RgbColor, HslSpaceF, NULL),
+    CASE(RgbToCmykF, KIND_SINGLE, RgbColor, CmykSpaceF, NULL),
+    CASE(RgbToXyzF, KIND_SINGLE, RgbColor, XyzSpaceF, NULL),
+    CASE(RgbToLabF, KIND_SINGLE, RgbColor, LabSpaceF, NULL),
+    CASE(RgbToLuvF, KIND_SINGLE, RgbColor, LuvSpaceF, NULL),
+    CASE(RgbToLchF, KIND_SINGLE, RgbColor, LchSpaceF, NULL),
+    CASE(RgbToHsvU16, KIND_SINGLE, RgbColor, HsvSpaceU16, NULL),
+    CASE(RgbToHslU16, KIND_SINGLE, RgbColor, HslSpaceU16, NULL),
+    CASE(RgbToCmykU16, KIND_SINGLE, RgbColor, CmykSpaceU16, NULL),
+    CASE(RgbToRgbDec, KIND_SINGLE, RgbColor, chizl_color32, NULL),
+    CASE(RgbToArgbDec, KIND_SINGLE, RgbColor, chizl_color32, NULL),
+    CASE_SIZED(RgbToRgbHexInto, KIND_SINGLE, sizeof(RgbColor), CHIZL_RGB_HEX_SIZE, NULL),
+    CASE(RgbToLabEx, KIND_SINGLE, RgbColor, LabSpace, NULL),
+
+    CASE(HsvToRgb, KIND_SINGLE, HsvSpace, RgbColor, Prep_RgbToHsvBatch),
+    CASE(HslToRgb, KIND_SINGLE, HslSpace, RgbColor, Prep_RgbToHslBatch),
+    CASE(CmykToRgb, KIND_SINGLE, CmykSpace, RgbColor, Prep_RgbToCmykBatch),
+    CASE(XyzToRgb, KIND_SINGLE, XyzSpace, RgbColor, Prep_RgbToXyzBatch),
+    CASE(LabToRgb, KIND_SINGLE, LabSpace, RgbColor, Prep_RgbToLabBatch),
+    CASE(LuvToRgb, KIND_SINGLE, LuvSpace, RgbColor, Prep_RgbToLuvBatch),
+    CASE(LchToRgb, KIND_SINGLE, LchSpace, RgbColor, Prep_RgbToLchBatch),
+    CASE(OkLabToRgb, KIND_SINGLE, OkLabSpace, RgbColor, Prep_RgbToOkLabBatch),
+    CASE(OkLchToRgb, KIND_SINGLE, OkLchSpace, RgbColor, Prep_RgbToOkLchBatch),
+    CASE(HsvFToRgb, KIND_SINGLE, HsvSpaceF, RgbColor, Prep_RgbToHsvFBatch),
+    CASE(HslFToRgb, KIND_SINGLE, HslSpaceF, RgbColor, Prep_RgbToHslFBatch),
+    CASE(CmykFToRgb, KIND_SINGLE, CmykSpaceF, RgbColor, Prep_RgbToCmykFBatch),
+    CASE(XyzFToRgb, KIND_SINGLE, XyzSpaceF, RgbColor, Prep_RgbToXyzFBatch),
+    CASE(LabFToRgb, KIND_SINGLE, LabSpaceF, RgbColor, Prep_RgbToLabFBatch),
+    CASE(LuvFToRgb, KIND_SINGLE, LuvSpaceF, RgbColor, Prep_RgbToLuvFBatch),
+    CASE(LchFToRgb, KIND_SINGLE, LchSpaceF, RgbColor, Prep_RgbToLchFBatch),
+    CASE(HsvU16ToRgb, KIND_SINGLE, HsvSpaceU16, RgbColor, Prep_RgbToHsvU16Batch),
+    CASE(HslU16ToRgb, KIND_SINGLE, HslSpaceU16, RgbColor, Prep_RgbToHslU16Batch),
+    CASE(CmykU16ToRgb, KIND_SINGLE, CmykSpaceU16, RgbColor, Prep_RgbToCmykU16Batch),
+    CASE(RgbFromRgbDec, KIND_SINGLE, chizl_color32, RgbColor, Prep_RgbDec),
+    CASE(RgbFromArgbDec, KIND_SINGLE, chizl_color32, RgbColor, Prep_ArgbDec),
+    CASE_SIZED(RgbFromHex, KIND_SINGLE, CHIZL_RGB_HEX_SIZE, sizeof(RgbColor), Prep_HexStrings),
+    CASE_SIZED(RgbFromDecString, KIND_SINGLE, BENCH_DEC_SIZE, sizeof(RgbColor), Prep_DecStrings),
+    CASE(LabToRgbEx, KIND_SINGLE, LabSpace, RgbColor, Prep_LabD50),
+
+    CASE(XyzToLab, KIND_SINGLE, XyzSpace, LabSpace, Prep_RgbToXyzBatch),
+    CASE(LabToXyz, KIND_SINGLE, LabSpace, XyzSpace, Prep_RgbToLabBatch),
+    CASE(XyzToLuv, KIND_SINGLE, XyzSpace, LuvSpace, Prep_RgbToXyzBatch),
+    CASE(LuvToXyz, KIND_SINGLE, LuvSpace, XyzSpace, Prep_RgbToLuvBatch),
+    CASE(LabToLch, KIND_SINGLE, LabSpace, LchSpace, Prep_RgbToLabBatch),
+    CASE(LchToLab, KIND_SINGLE, LchSpace, LabSpace, Prep_RgbToLchBatch),
+    CASE(OkLabToOkLch, KIND_SINGLE, OkLabSpace, OkLchSpace, Prep_RgbToOkLabBatch),
+    CASE(OkLchToOkLab, KIND_SINGLE, OkLchSpace, OkLabSpace, Prep_RgbToOkLchBatch),
+    CASE(XyzToLabEx, KIND_SINGLE, XyzSpace, LabSpace, Prep_RgbToXyzBatch),
+    CASE(LabToXyzEx, KIND_SINGLE, LabSpace, XyzSpace, Prep_LabD50),
+    CASE(XyzToLuvEx, KIND_SINGLE, XyzSpace, LuvSpace, Prep_RgbToXyzBatch),
+    CASE(LuvToXyzEx, KIND_SINGLE, LuvSpace, XyzSpace, Prep_RgbToLuvBatch),
+    CASE(XyzAdapt, KIND_SINGLE, XyzSpace, XyzSpace, Prep_RgbToXyzBatch),
+
+    CASE(RgbToHsvBatch, KIND_BATCH, RgbColor, HsvSpace, NULL),
+    CASE(RgbToHslBatch, KIND_BATCH, RgbColor, HslSpace, NULL),
+    CASE(RgbToCmykBatch, KIND_BATCH, RgbColor, CmykSpace, NULL),
+    CASE(RgbToXyzBatch, KIND_BATCH, RgbColor, XyzSpace, NULL),
+    CASE(RgbToLabBatch, KIND_BATCH, RgbColor, LabSpace, NULL),
+    CASE(RgbToLuvBatch, KIND_BATCH, RgbColor, LuvSpace, NULL),
+    CASE(RgbToLchBatch, KIND_BATCH, RgbColor, LchSpace, NULL),
+    CASE(RgbToOkLabBatch, KIND_BATCH, RgbColor, OkLabSpace, NULL),
+    CASE(RgbToOkLchBatch, KIND_BATCH, RgbColor, OkLchSpace, NULL),
+    CASE(RgbToHsvFBatch, KIND_BATCH, RgbColor, HsvSpaceF, NULL),
+    CASE(RgbToHslFBatch, KIND_BATCH, RgbColor, HslSpaceF, NULL),
+    CASE(RgbToCmykFBatch, KIND_BATCH, RgbColor, CmykSpaceF, NULL),
+    CASE(RgbToXyzFBatch, KIND_BATCH, RgbColor, XyzSpaceF, NULL),
+    CASE(RgbToLabFBatch, KIND_BATCH, RgbColor, LabSpaceF, NULL),
+    CASE(RgbToLuvFBatch, KIND_BATCH, RgbColor, LuvSpaceF, NULL),
+    CASE(RgbToLchFBatch, KIND_BATCH, RgbColor, LchSpaceF, NULL),
+    CASE(RgbToHsvU16Batch, KIND_BATCH, RgbColor, HsvSpaceU16, NULL),
+    CASE(RgbToHslU16Batch, KIND_BATCH, RgbColor, HslSpaceU16, NULL),
+    CASE(RgbToCmykU16Batch, KIND_BATCH, RgbColor, CmykSpaceU16, NULL),
+    CASE(RgbToLabExBatch, KIND_BATCH, RgbColor, LabSpace, NULL),
+    CASE_SIZED(RgbToRgbHexBatch, KIND_BATCH, sizeof(RgbColor), CHIZL_RGB_HEX_SIZE, NULL),
+
+    CASE(XyzToRgbBatch, KIND_BATCH, XyzSpace, RgbColor, Prep_RgbToXyzBatch),
+    CASE(LabToRgbBatch, KIND_BATCH, LabSpace, RgbColor, Prep_RgbToLabBatch),
+    CASE(LuvToRgbBatch, KIND_BATCH, LuvSpace, RgbColor, Prep_RgbToLuvBatch),
+    CASE(LchToRgbBatch, KIND_BATCH, LchSpace, RgbColor, Prep_RgbToLchBatch),
+    CASE(OkLabToRgbBatch, KIND_BATCH, OkLabSpace, RgbColor, Prep_RgbToOkLabBatch),
+    CASE(OkLchToRgbBatch, KIND_BATCH, OkLchSpace, RgbColor, Prep_RgbToOkLchBatch),
+    CASE(HsvFToRgbBatch, KIND_BATCH, HsvSpaceF, RgbColor, Prep_RgbToHsvFBatch),
+    CASE(HslFToRgbBatch, KIND_BATCH, HslSpaceF, RgbColor, Prep_RgbToHslFBatch),
+    CASE(CmykFToRgbBatch, KIND_BATCH, CmykSpaceF, RgbColor, Prep_RgbToCmykFBatch),
+    CASE(XyzFToRgbBatch, KIND_BATCH, XyzSpaceF, RgbColor, Prep_RgbToXyzFBatch),
+    CASE(LabFToRgbBatch, KIND_BATCH, LabSpaceF, RgbColor, Prep_RgbToLabFBatch),
+    CASE(LuvFToRgbBatch, KIND_BATCH, LuvSpaceF, RgbColor, Prep_RgbToLuvFBatch),
+    CASE(LchFToRgbBatch, KIND_BATCH, LchSpaceF, RgbColor, Prep_RgbToLchFBatch),
+    CASE(HsvU16ToRgbBatch, KIND_BATCH, HsvSpaceU16, RgbColor, Prep_RgbToHsvU16Batch),
+    CASE(HslU16ToRgbBatch, KIND_BATCH, HslSpaceU16, RgbColor, Prep_RgbToHslU16Batch),
+    CASE(CmykU16ToRgbBatch, KIND_BATCH, CmykSpaceU16, RgbColor, Prep_RgbToCmykU16Batch),
+    CASE(LabToRgbExBatch, KIND_BATCH, LabSpace, RgbColor, Prep_LabD50),
+    CASE(XyzAdaptBatch, KIND_BATCH, XyzSpace, XyzSpace, Prep_RgbToXyzBatch),
+    CASE_SIZED(RgbFromHexBatch, KIND_BATCH, CHIZL_RGB_HEX_SIZE, sizeof(RgbColor), Prep_HexList),
+
+    CASE_SIZED(RgbDeinterleave, KIND_BATCH, sizeof(RgbColor), 4, NULL),
+    CASE_SIZED(RgbInterleave, KIND_BATCH, 4, sizeof(RgbColor), Prep_RgbPlanes),
+    CASE_SIZED(LabDeinterleave, KIND_BATCH, sizeof(LabSpace), 3 * sizeof(double), Prep_RgbToLabBatch),
+    CASE_SIZED(LabInterleave, KIND_BATCH, 3 * sizeof(double), sizeof(LabSpace), Prep_LabPlanes),
+    CASE_SIZED(RgbPlanarToLabPlanar, KIND_BATCH, 4, 3 * sizeof(double), Prep_RgbPlanes),
+    CASE_SIZED(RgbPlanarToLabPlanarF, KIND_BATCH, 4, 3 * sizeof(float), Prep_RgbPlanes),
+    CASE_SIZED(LabPlanarToRgbPlanar, KIND_BATCH, 3 * sizeof(double), 3, Prep_LabPlanes),
+
+    CASE_PLAN("Plan RGB->LAB", KIND_SINGLE, RgbColor, LabSpace, NULL, Run_PlanSingle, s_planRgbToLab),
+    CASE_PLAN("Plan HSV->LAB", KIND_SINGLE, HsvSpace, LabSpace, Prep_RgbToHsvBatch, Run_PlanSingle, s_planHsvToLab),
+    CASE_PLAN("Plan RGB->LAB D50", KIND_SINGLE, RgbColor, LabSpace, NULL, Run_PlanSingle, s_planRgbToLabD50),
+    CASE_PLAN("Plan LAB->LCH", KIND_SINGLE, LabSpace, LchSpace, Prep_RgbToLabBatch, Run_PlanSingle, s_planLabToLch),
+    CASE_PLAN("Plan RGB->LAB", KIND_BATCH, RgbColor, LabSpace, NULL, Run_PlanBatch, s_planRgbToLab),
+    CASE_PLAN("Plan HSV->LAB", KIND_BATCH, HsvSpace, LabSpace, Prep_RgbToHsvBatch, Run_PlanBatch, s_planHsvToLab),
+    CASE_PLAN("Plan RGB->LAB D50", KIND_BATCH, RgbColor, LabSpace, NULL, Run_PlanBatch, s_planRgbToLabD50),
+    CASE_PLAN("Plan LAB->LCH", KIND_BATCH, LabSpace, LchSpace, Prep_RgbToLabBatch, Run_PlanBatch, s_planLabToLch),
+
+    CASE(RgbToHsvParallel, KIND_PARALLEL, RgbColor, HsvSpace, NULL),
+    CASE(RgbToHslParallel, KIND_PARALLEL, RgbColor, HslSpace, NULL),
+    CASE(RgbToCmykParallel, KIND_PARALLEL, RgbColor, CmykSpace, NULL),
+    CASE(RgbToXyzParallel, KIND_PARALLEL, RgbColor, XyzSpace, NULL),
+    CASE(RgbToLabParallel, KIND_PARALLEL, RgbColor, LabSpace, NULL),
+    CASE(RgbToLuvParallel, KIND_PARALLEL, RgbColor, LuvSpace, NULL),
+    CASE(RgbToLchParallel, KIND_PARALLEL, RgbColor, LchSpace, NULL),
+
+    CASE(DeltaE76, KIND_SINGLE, LabSpace, double, Prep_RgbToLabBatch),
+    CASE(DeltaE94, KIND_SINGLE, LabSpace, double, Prep_RgbToLabBatch),
+    CASE(DeltaE2000, KIND_SINGLE, LabSpace, double, Prep_RgbToLabBatch),
+    CASE(DeltaE, KIND_SINGLE, LabSpace, double, Prep_RgbToLabBatch),
+    CASE_NAMED("DeltaEPairs 76", KIND_BATCH, LabSpace, double, Prep_RgbToLabBatch, Run_DeltaEPairs76),
+    CASE_NAMED("DeltaEPairs 94", KIND_BATCH, LabSpace, double, Prep_RgbToLabBatch, Run_DeltaEPairs94),
+    CASE_NAMED("DeltaEPairs 2000", KIND_BATCH, LabSpace, double, Prep_RgbToLabBatch, Run_DeltaEPairs2000),
+    CASE_NAMED("DeltaEOneToMany 76", KIND_BATCH, LabSpace, double, Prep_RgbToLabBatch, Run_DeltaEPairs76OneToMany),
+    CASE_NAMED("DeltaEOneToMany 94", KIND_BATCH, LabSpace, double, Prep_RgbToLabBatch, Run_DeltaEPairs94OneToMany),
+    CASE_NAMED("DeltaEOneToMany 2000", KIND_BATCH, LabSpace, double, Prep_RgbToLabBatch, Run_DeltaEPairs2000OneToMany),
+
+    CASE(DeltaENearest, KIND_SINGLE, LabSpace, size_t, Prep_RgbToLabBatch),
+    CASE(PaletteIndexNearestLab, KIND_SINGLE, LabSpace, size_t, Prep_RgbToLabBatch),
+    CASE_NAMED("PaletteIndexNearest 76", KIND_SINGLE, RgbColor, size_t, NULL, Run_PaletteIndexNearest76),
+    CASE_NAMED("PaletteIndexNearest 2000", KIND_SINGLE, RgbColor, size_t, NULL, Run_PaletteIndexNearest2000),
+    CASE_NAMED("PaletteIndexNearest 76", KIND_BATCH, RgbColor, size_t, NULL, Run_PaletteIndexNearestBatch76),
+    CASE_NAMED("PaletteIndexNearest 2000", KIND_BATCH, RgbColor, size_t, NULL, Run_PaletteIndexNearestBatch2000),
+    CASE(PaletteCacheLookup, KIND_SINGLE, RgbColor, size_t, NULL),
+    CASE(PaletteCacheLookupBatch, KIND_BATCH, RgbColor, size_t, NULL),
+    CASE_NAMED("PaletteCacheLookup Reduced", KIND_BATCH, RgbColor, size_t, NULL, Run_PaletteCacheLookupBatchReduced),
+
+    CASE_SIZED(AnsiSgrColor, KIND_SINGLE, sizeof(RgbColor), CHIZL_SGR_SIZE, NULL),
+    CASE_SIZED(AnsiSgrColor256, KIND_SINGLE, sizeof(RgbColor), CHIZL_SGR_SIZE, NULL),
+    CASE(AnsiNearest256, KIND_SINGLE, RgbColor, unsigned char, NULL),
+    CASE(AnsiNearest16, KIND_SINGLE, RgbColor, unsigned char, NULL),
+    CASE(AnsiBufferSetFg, KIND_SINGLE, RgbColor, unsigned char, NULL),
+    CASE(AnsiImageRender, KIND_BATCH, RgbColor, unsigned char, Prep_AnsiFrame),
+
+    CASE(LchMaxChroma, KIND_SINGLE, LchSpace, double, Prep_LchOutOfGamut),
+    CASE_NAMED("LchToRgbMapped CSS", KIND_SINGLE, LchSpace, RgbColor, Prep_LchOutOfGamut, Run_LchToRgbMapped),
+    CASE_NAMED("LchToRgbMapped Table", KIND_SINGLE, LchSpace, RgbColor, Prep_LchOutOfGamut, Run_LchToRgbMappedTable),
+    CASE_NAMED("LchToRgbMappedBatch CSS", KIND_BATCH, LchSpace, RgbColor, Prep_LchOutOfGamut, Run_LchToRgbMappedBatch),
+    CASE_NAMED("LchToRgbMappedBatch Table", KIND_BATCH, LchSpace, RgbColor, Prep_LchOutOfGamut, Run_LchToRgbMappedBatchTable),
+
+    CASE(GradientLutSample, KIND_SINGLE, double, RgbColor, Prep_GradientT),
+    CASE(GradientLutSampleBatch, KIND_BATCH, double, RgbColor, Prep_GradientT),
+    CASE(GradientFill, KIND_BATCH, RgbColor, RgbColor, NULL),
+
+    CASE_NAMED("QuantizeImage MedianCut", KIND_PARALLEL, RgbColor, unsigned char, NULL, Run_QuantizeMedianCut),
+    CASE_NAMED("QuantizeImage KMeans", KIND_PARALLEL, RgbColor, unsigned char, NULL, Run_QuantizeKMeans),
+    CASE(QuantizeRemap, KIND_PARALLEL, RgbColor, unsigned char, NULL),
+
+    CASE_NAMED("DitherImage FS", KIND_BATCH, RgbColor, unsigned char, NULL, Run_DitherFloydSteinberg),
+    CASE_NAMED("DitherImage Atkinson", KIND_BATCH, RgbColor, unsigned char, NULL, Run_DitherAtkinson),
+    CASE_NAMED("DitherImage FS", KIND_PARALLEL, RgbColor, unsigned char, NULL, Run_DitherFloydSteinberg),
+    CASE_NAMED("DitherImage Atkinson", KIND_PARALLEL, RgbColor, unsigned char, NULL, Run_DitherAtkinson),
+    CASE_NAMED("DitherImage Bayer", KIND_PARALLEL, RgbColor, unsigned char, NULL, Run_DitherBayer),
+};
+
+#define BENCH_CASE_COUNT (sizeof(s_cases) / sizeof(s_cases[0]))
+
+// --- Data sets ---
+
+static RgbColor* BuildCube(size_t step, size_t* count)
+{
+    const size_t n = (BENCH_CUBE_COLORS + step - 1) / step;
+    RgbColor* rgb = (RgbColor*)malloc(n * sizeof(RgbColor));
+    if (rgb == NULL)
+        return NULL;
+
+    for (size_t i = 0; i < n; i++)
+    {
+        const size_t v = i * step;
+        rgb[i].alpha = 255;
+        rgb[i].red = (unsigned char)(v >> 16);
+        rgb[i].green = (unsigned char)(v >> 8);
+        rgb[i].blue = (unsigned char)v;
+    }
+    *count = n;
+    return rgb;
+}
+
+static unsigned char ClampByte(double v)
+{
+    return (unsigned char)((v <= 0.0) ? 0 : ((v >= 255.0) ? 255 : (int)(v + 0.5)));
+}
+
+/// <summary>
+/// A stand in for a photo: sky gradient over textured ground, three soft edged saturated objects and
+/// a little sensor noise.  Mostly smooth areas with many near repeats, plus a few strong colors.
+/// </summary>
+static RgbColor* BuildSyntheticImage(size_t width, size_t height, size_t* count)
+{
+    static const struct { double x, y, radius, r, g, b; } discs[3] = {
+        { 0.25, 0.62, 0.10, 200,  30,  35 },
+        { 0.55, 0.70, 0.07, 240, 190,  20 },
+        { 0.80, 0.25, 0.05, 255, 250, 225 }
+    };
+
+    RgbColor* rgb = (RgbColor*)malloc(width * height * sizeof(RgbColor));
+    if (rgb == NULL)
+        return NULL;
+
+    unsigned int seed = 0x9E3779B9u;
+    for (size_t y = 0; y < height; y++)
+    {
+        const double fy = (double)y / (double)(height - 1);
+        for (size_t x = 0; x < width; x++)
+        {
+            const double fx = (double)x / (double)(width - 1);
+            double r, g, b;
+
+            if (fy < 0.4)
+            {
+                const double t = fy / 0.4;
+                r = 70.0 + 110.0 * t;
+                g = 130.0 + 90.0 * t;
+                b = 220.0 + 25.0 * t;
+            }
+            else
+            {
+                const double t = (fy - 0.4) / 0.6;
+                const double texture = 18.0 * sin((double)x * 0.05) * sin((double)y * 0.07);
+                r = 95.0 - 45.0 * t + texture;
+                g = 115.0 - 55.0 * t + texture;
+                b = 50.0 - 20.0 * t + texture * 0.5;
+            }
+
+            for (int d = 0; d < 3; d++)
+            {
+                const double dx = (fx - discs[d].x) * (double)width;
+                const double dy = (fy - discs[d].y) * (double)height;
+                const double edge = discs[d].radius * (double)height - sqrt(dx * dx + dy * dy);
+                if (edge > 0.0)
+                {
+                    const double mix = (edge > 6.0) ? 1.0 : edge / 6.0;
+                    r += (discs[d].r - r) * mix;
+                    g += (discs[d].g - g) * mix;
+                    b += (discs[d].b - b) * mix;
+                }
+            }
+
+            // xorshift32, +-3 per channel.
+            seed ^= seed << 13;
+            seed ^= seed >> 17;
+            seed ^= seed << 5;
+            RgbColor* px = &rgb[y * width + x];
+            px->alpha = 255;
+            px->red = ClampByte(r + (double)((int)(seed & 7) - 3));
+            px->green = ClampByte(g + (double)((int)((seed >> 3) & 7) - 3));
+            px->blue = ClampByte(b + (double)((int)((seed >> 6) & 7) - 3));
+        }
+    }
+    *count = width * height;
+    return rgb;
+}
+
+static FILE* OpenFile(const char* path, const char* mode)
+{
+#if defined(_WIN32) || defined(_WIN64)
+    FILE* f = NULL;
+    return (fopen_s(&f, path, mode) == 0) ? f : NULL;
+#else
+    return fopen(path, mode);
+#endif
+}
+
+/// <summary>
+/// Reads the next header number of a .ppm, skipping whitespace and # comments.  Returns 0 on a bad header.
+/// </summary>
+static size_t ReadPpmNumber(FILE* f)
+{
+    int c = fgetc(f);
+    while (c == '#' || c == ' ' || c == '\t' || c == '\r' || c == '\n')
+    {
+        if (c == '#')
+            while (c != '\n' && c != EOF)
+                c = fgetc(f);
+        c = fgetc(f);
+    }
+
+    size_t v = 0;
+    for (; c >= '0' && c <= '9'; c = fgetc(f))
+        v = v * 10 + (size_t)(c - '0');
+    return v;
+}
+
+/// <summary>
+/// Loads a binary (P6) 8-bit .ppm, which most image tools can export.
+/// </summary>
+static RgbColor* LoadPpm(const char* path, size_t* count)
+{
+    FILE* f = OpenFile(path, "rb");
+    if (f == NULL)
+        return NULL;
+
+    RgbColor* rgb = NULL;
+    if (fgetc(f) == 'P' && fgetc(f) == '6')
+    {
+        const size_t width = ReadPpmNumber(f);
+        const size_t height = ReadPpmNumber(f);
+        const size_t maxValue = ReadPpmNumber(f);
+        const size_t n = width * height;
+        unsigned char* bytes = (n > 0 && maxValue == 255) ? (unsigned char*)malloc(n * 3) : NULL;
+
+        if (bytes != NULL && fread(bytes, 3, n, f) == n)
+        {
+            rgb = (RgbColor*)malloc(n * sizeof(RgbColor));
+            for (size_t i = 0; rgb != NULL && i < n; i++)
+            {
+                rgb[i].alpha = 255;
+                rgb[i].red = bytes[i * 3];
+                rgb[i].green = bytes[i * 3 + 1];
+                rgb[i].blue = bytes[i * 3 + 2];
+            }
+            *count = n;
+        }
+        free(bytes);
+    }
+    fclose(f);
+    return rgb;
+}
+
+// --- Timing ---
+
+/// <summary>
+/// One pass over the data set.  Only the run call is inside the clock, preps and chunk handling are not.
+/// </summary>
+static void TimePass(const BenchCase* bench, const BenchDataset* data, size_t limit, void* in, void* out, double* ms, unsigned long long* cycles)
+{
+    const size_t chunk = (bench->kind == KIND_PARALLEL) ? BENCH_PARALLEL_CHUNK : BENCH_CHUNK;
+    const size_t total = (limit < data->count) ? limit : data->count;
+
+    *ms = 0.0;
+    *cycles = 0;
+    for (size_t begin = 0; begin < total; begin += chunk)
+    {
+        const size_t n = (total - begin < chunk) ? total - begin : chunk;
+        const RgbColor* rgb = data->rgb + begin;
+        const void* src = rgb;
+
+        if (bench->prep != NULL)
+        {
+            bench->prep(rgb, in, n);
+            src = in;
+        }
+
+        const double t0 = ChizlNowMs();
+        const unsigned long long c0 = ReadCycles();
+        bench->run(bench, src, out, n);
+        const unsigned long long c1 = ReadCycles();
+        const double t1 = ChizlNowMs();
+
+        *ms += t1 - t0;
+        *cycles += c1 - c0;
+    }
+}
+
+static BenchResult RunCase(const BenchCase* bench, const BenchDataset* data, unsigned int reps, void* in, void* out)
+{
+    BenchResult result = { bench, data, 0.0, 0.0, 0.0 };
+    double best = -1.0, sum = 0.0, ms = 0.0;
+    unsigned long long bestCycles = 0, cycles = 0;
+
+    // Warm up: lazy tables, caches and the thread pool are built outside the timed runs.
+    TimePass(bench, data, BENCH_CHUNK, in, out, &ms, &cycles);
+
+    for (unsigned int r = 0; r < reps; r++)
+    {
+        TimePass(bench, data, data->count, in, out, &ms, &cycles);
+        sum += ms;
+        if (best < 0.0 || ms < best)
+        {
+            best = ms;
+            bestCycles = cycles;
+        }
+    }
+
+    result.bestNs = best * 1.0e6 / (double)data->count;
+    result.meanNs = sum * 1.0e6 / ((double)data->count * reps);
+    result.cycles = (double)bestCycles / (double)data->count;
+    return result;
+}
+
+// --- Output ---
+
+static void WriteJsonString(FILE* f, const char* text)
+{
+    fputc('"', f);
+    for (const unsigned char* p = (const unsigned char*)text; *p != '\0'; p++)
+    {
+        if (*p == '"' || *p == '\\')
+            fprintf(f, "\\%c", *p);
+        else if (*p < 0x20)
+            fprintf(f, "\\u%04x", *p);
+        else
+            fputc(*p, f);
+    }
+    fputc('"', f);
+}
+
+static const char* PlatformName(void)
+{
+#if defined(_WIN64)
+    return "windows-x64";
+#elif defined(_WIN32)
+    return "windows-x86";
+#elif defined(__APPLE__)
+    return "macos";
+#elif defined(__linux__)
+    return "linux";
+#else
+    return "unknown";
+#endif
+}
+
+static const char* CompilerName(void)
+{
+#if defined(_MSC_VER)
+    return "msvc " TOSTRING(_MSC_VER);
+#elif defined(__clang__)
+    return "clang " __clang_version__;
+#elif defined(__GNUC__)
+    return "gcc " __VERSION__;
+#else
+    return "unknown";
+#endif
+}
+
+static void WriteJson(FILE* f, const BenchResult* results, size_t resultCount, const BenchDataset* datasets, size_t datasetCount, unsigned int reps)
+{
+    char stamp[32] = "";
+    const time_t now = time(NULL);
+    struct tm utc;
+#if defined(_WIN32) || defined(_WIN64)
+    if (gmtime_s(&utc, &now) == 0)
+#else
+    if (gmtime_r(&now, &utc) != NULL)
+#endif
+        strftime(stamp, sizeof(stamp), "%Y-%m-%dT%H:%M:%SZ", &utc);
+
+    fprintf(f, "{\n");
+    fprintf(f, "  \"library\": \"Chizl.Colors\",\n");
+    fprintf(f, "  \"version\": \"%s\",\n", CHIZL_COLORS_VERSION);
+    fprintf(f, "  \"timestamp\": \"%s\",\n", stamp);
+    fprintf(f, "  \"platform\": \"%s\",\n", PlatformName());
+    fprintf(f, "  \"compiler\": ");
+    WriteJsonString(f, CompilerName());
+    fprintf(f, ",\n");
+    fprintf(f, "  \"threads\": %zu,\n", ChizlGetThreadCount());
+    fprintf(f, "  \"reps\": %u,\n", reps);
+    fprintf(f, "  \"chunk\": %d,\n", BENCH_CHUNK);
+    fprintf(f, "  \"cycle_counter\": %s,\n", BENCH_HAS_TSC ? "\"tsc\"" : "null");
+
+    fprintf(f, "  \"datasets\": [\n");
+    for (size_t i = 0; i < datasetCount; i++)
+    {
+        fprintf(f, "    { \"name\": \"%s\", \"colors\": %zu, \"source\": ", datasets[i].name, datasets[i].count);
+        WriteJsonString(f, datasets[i].source);
+        fprintf(f, " }%s\n", (i + 1 < datasetCount) ? "," : "");
+    }
+    fprintf(f, "  ],\n");
+
+    fprintf(f, "  \"results\": [\n");
+    for (size_t i = 0; i < resultCount; i++)
+    {
+        const BenchResult* r = &results[i];
+        fprintf(f, "    { \"name\": \"%s\", \"kind\": \"%s\", \"dataset\": \"%s\", \"colors\": %zu, "
+            "\"ns_per_color\": %.3f, \"mean_ns_per_color\": %.3f, \"colors_per_sec\": %.0f, ",
+            r->bench->name, s_kindNames[r->bench->kind], r->data->name, r->data->count,
+            r->bestNs, r->meanNs, (r->bestNs > 0.0) ? 1.0e9 / r->bestNs : 0.0);
+        if (BENCH_HAS_TSC)
+            fprintf(f, "\"cycles_per_color\": %.2f }", r->cycles);
+        else
+            fprintf(f, "\"cycles_per_color\": null }");
+        fprintf(f, "%s\n", (i + 1 < resultCount) ? "," : "");
+    }
+    fprintf(f, "  ]\n");
+    fprintf(f, "}\n");
+}
+
+static void Usage(void)
+{
+    printf("Usage: C_Benchmark [options]\n"
+        "  --reps N          Timed runs per function and data set, best is reported (default 3)\n"
+        "  --dataset NAME    cube, image or all (default all)\n"
+        "  --cube-step N     Use every Nth color of the RGB cube, 1 is all 16,777,216 (default 1)\n"
+        "  --image FILE      Binary (P6) .ppm to use as the image data set instead of the synthetic one\n"
+        "  --filter TEXT     Only functions whose name contains TEXT\n"
+        "  --threads N       Thread count for the parallel functions, 0 for all cores (default 0)\n"
+        "  --json FILE       Also write the results as JSON, '-' for stdout (the table then goes to stderr)\n");
+}
+
+/// <summary>
+/// The palette the palette cases map onto: 6 red x 7 green x 6 blue levels plus 4 grays between the cube's.
+/// </summary>
+static void BuildPalette(void)
+{
+    size_t n = 0;
+    for (int r = 0; r < 6; r++)
+        for (int g = 0; g < 7; g++)
+            for (int b = 0; b < 6; b++)
+            {
+                RgbColor* c = &s_palette[n++];
+                c->alpha = 255;
+                c->red = (unsigned char)(r * 51);
+                c->green = (unsigned char)(g * 255 / 6);
+                c->blue = (unsigned char)(b * 51);
+            }
+    for (int k = 1; k <= 4; k++)
+    {
+        RgbColor* c = &s_palette[n++];
+        c->alpha = 255;
+        c->red = c->green = c->blue = (unsigned char)(k * 50 + 3);
+    }
+}
+
+/// <summary>
+/// True when --filter leaves a case whose name starts with 'prefix'.
+/// </summary>
+static int WantCases(const char* prefix, const char* filter)
+{
+    for (size_t c = 0; c < BENCH_CASE_COUNT; c++)
+    {
+        if (strncmp(s_cases[c].name, prefix, strlen(prefix)) == 0 && (filter == NULL || strstr(s_cases[c].name, filter) != NULL))
+            return 1;
+    }
+    return 0;
+}
+
+/// <summary>
+/// Plans, palette, tables and buffers the cases run against, built once before any timing.  A plan that
+/// fails to build skips its cases, returns 0 if anything else could not be built.  The palette caches
+/// take seconds to fill, they are only built when a PaletteCache case is going to run.
+/// </summary>
+static int CreateFixtures(const char* filter)
+{
+    s_planRgbToLab = ConversionPlanCreate(COLOR_SPACE_RGB, COLOR_SPACE_LAB, WPID_D65_FULL, CAT_BRADFORD);
+    s_planHsvToLab = ConversionPlanCreate(COLOR_SPACE_HSV, COLOR_SPACE_LAB, WPID_D65_FULL, CAT_BRADFORD);
+    s_planRgbToLabD50 = ConversionPlanCreate(COLOR_SPACE_RGB, COLOR_SPACE_LAB, WPID_D50, CAT_BRADFORD);
+    s_planLabToLch = ConversionPlanCreate(COLOR_SPACE_LAB, COLOR_SPACE_LCH, WPID_D65_FULL, CAT_BRADFORD);
+
+    BuildPalette();
+
+    // Dark blue, orange, white and a mid gray: hue turns, a gray end and unequal lightness steps.
+    const unsigned char anchors[4][3] = { { 20, 40, 120 }, { 250, 140, 20 }, { 255, 255, 255 }, { 128, 128, 128 } };
+    for (int i = 0; i < 4; i++)
+    {
+        s_gradientAnchors[i].alpha = 255;
+        s_gradientAnchors[i].red = anchors[i][0];
+        s_gradientAnchors[i].green = anchors[i][1];
+        s_gradientAnchors[i].blue = anchors[i][2];
+    }
+    s_gradientLut = GradientLutCreate(s_gradientAnchors, NULL, 4, 0, GRADIENT_LCH);
+
+    RgbToLabBatch(s_palette, s_paletteLabs, BENCH_PALETTE_SIZE, 0);
+    s_paletteIndex = PaletteIndexCreate(s_palette, BENCH_PALETTE_SIZE);
+    const int wantCache = WantCases("PaletteCache", filter);
+    if (wantCache)
+    {
+        s_paletteCacheFull = PaletteCacheCreate(s_palette, BENCH_PALETTE_SIZE, DELTAE_CIE76, PCACHE_FULL);
+        s_paletteCacheReduced = PaletteCacheCreate(s_palette, BENCH_PALETTE_SIZE, DELTAE_CIE76, PCACHE_REDUCED);
+    }
+    s_ansiBuffer = AnsiBufferCreate(0);
+    s_ansiImage = AnsiImageCreate(BENCH_ANSI_IMAGE_SIZE, BENCH_ANSI_IMAGE_SIZE);
+
+    return s_gradientLut != NULL && s_paletteIndex != NULL && s_ansiBuffer != NULL && s_ansiImage != NULL
+        && (!wantCache || (s_paletteCacheFull != NULL && s_paletteCacheReduced != NULL));
+}
+
+static void FreeFixtures(void)
+{
+    AnsiImageFree(s_ansiImage);
+    AnsiBufferFree(s_ansiBuffer);
+    PaletteCacheFree(s_paletteCacheReduced);
+    PaletteCacheFree(s_paletteCacheFull);
+    PaletteIndexFree(s_paletteIndex);
+    GradientLutFree(s_gradientLut);
+    ConversionPlanFree(s_planRgbToLab);
+    ConversionPlanFree(s_planHsvToLab);
+    ConversionPlanFree(s_planRgbToLabD50);
+    ConversionPlanFree(s_planLabToLch);
+}
+
+int main(int argc, char* argv[])
+{
+    unsigned int reps = 3;
+    size_t cubeStep = 1;
+    size_t threads = 0;
+    const char* dataset = "all";
+    const char* imagePath = NULL;
+    const char* filter = NULL;
+    const char* jsonPath = NULL;
+
+    for (int i = 1; i < argc; i++)
+    {
+        const char* arg = argv[i];
+        const char* value = (i + 1 < argc) ? argv[i + 1] : NULL;
+
+        if (strcmp(arg, "--help") == 0 || strcmp(arg, "-h") == 0)
+        {
+            Usage();
+            return 0;
+        }
+        if (value == NULL)
+        {
+            fprintf(stderr, "Unknown or incomplete option: %s\n", arg);
+            Usage();
+            return 1;
+        }
+
+        if (strcmp(arg, "--reps") == 0)
+            reps = (unsigned int)strtoul(value, NULL, 10);
+        else if (strcmp(arg, "--dataset") == 0)
+            dataset = value;
+        else if (strcmp(arg, "--cube-step") == 0)
+            cubeStep = (size_t)strtoul(value, NULL, 10);
+        else if (strcmp(arg, "--image") == 0)
+            imagePath = value;
+        else if (strcmp(arg, "--filter") == 0)
+            filter = value;
+        else if (strcmp(arg, "--threads") == 0)
+            threads = (size_t)strtoul(value, NULL, 10);
+        else if (strcmp(arg, "--json") == 0)
+            jsonPath = value;
+        else
+        {
+            fprintf(stderr, "Unknown option: %s\n", arg);
+            Usage();
+            return 1;
+        }
+        i++;
+    }
+
+    const int wantCube = strcmp(dataset, "all") == 0 || strcmp(dataset, "cube") == 0;
+    const int wantImage = strcmp(dataset, "all") == 0 || strcmp(dataset, "image") == 0;
+    if (reps == 0 || cubeStep == 0 || (!wantCube && !wantImage))
+    {
+        Usage();
+        return 1;
+    }
+
+    const int jsonToStdout = jsonPath != NULL && strcmp(jsonPath, "-") == 0;
+    FILE* table = jsonToStdout ? stderr : stdout;
+
+    BenchDataset datasets[2];
+    size_t datasetCount = 0;
+    if (wantCube)
+    {
+        BenchDataset* d = &datasets[datasetCount];
+        d->name = "cube";
+        snprintf(d->source, sizeof(d->source), "RGB cube, every %zu color(s)", cubeStep);
+        d->rgb = BuildCube(cubeStep, &d->count);
+        if (d->rgb == NULL)
+        {
+            fprintf(stderr, "Out of memory building the RGB cube.\n");
+            return 1;
+        }
+        datasetCount++;
+    }
+    if (wantImage)
+    {
+        BenchDataset* d = &datasets[datasetCount];
+        d->name = "image";
+        if (imagePath != NULL)
+        {
+            snprintf(d->source, sizeof(d->source), "%s", imagePath);
+            d->rgb = LoadPpm(imagePath, &d->count);
+        }
+        else
+        {
+            snprintf(d->source, sizeof(d->source), "synthetic %dx%d", BENCH_IMAGE_WIDTH, BENCH_IMAGE_HEIGHT);
+            d->rgb = BuildSyntheticImage(BENCH_IMAGE_WIDTH, BENCH_IMAGE_HEIGHT, &d->count);
+        }
+        if (d->rgb == NULL)
+        {
+            fprintf(stderr, "Could not load image data: %s\n", d->source);
+            return 1;
+        }
+        datasetCount++;
+    }
+
+    const size_t bufferSize = BENCH_PARALLEL_CHUNK * (size_t)BENCH_MAX_COLOR_SIZE;
+    void* in = malloc(bufferSize);
+    void* out = malloc(bufferSize);
+    s_scratch = (unsigned char*)malloc(bufferSize);
+    BenchResult* results = (BenchResult*)malloc(BENCH_CASE_COUNT * datasetCount * sizeof(BenchResult));
+    if (in == NULL || out == NULL || s_scratch == NULL || results == NULL)
+    {
+        fprintf(stderr, "Out of memory.\n");
+        return 1;
+    }
+
+    ChizlSetThreadCount(threads);
+    if (!CreateFixtures(filter))
+    {
+        fprintf(stderr, "Out of memory.\n");
+        return 1;
+    }
+
+    fprintf(table, "Chizl.Colors %s benchmark, %zu thread(s), best of %u\n", CHIZL_COLORS_VERSION, ChizlGetThreadCount(), reps);
+    fprintf(table, "%-26s %-9s %-8s %12s %14s %12s\n", "Function", "Kind", "Data", "ns/color", "Mcolors/sec", "cycles/color");
+
+    size_t resultCount = 0;
+    for (size_t d = 0; d < datasetCount; d++)
+    {
+        for (size_t c = 0; c < BENCH_CASE_COUNT; c++)
+        {
+            const BenchCase* bench = &s_cases[c];
+            if (filter != NULL && strstr(bench->name, filter) == NULL)
+                continue;
+            if (bench->plan != NULL && *bench->plan == NULL)
+                continue;
+
+            const BenchResult r = RunCase(bench, &datasets[d], reps, in, out);
+            results[resultCount++] = r;
+
+            fprintf(table, "%-26s %-9s %-8s %12.3f %14.2f ", bench->name, s_kindNames[bench->kind], datasets[d].name,
+                r.bestNs, (r.bestNs > 0.0) ? 1.0e3 / r.bestNs : 0.0);
+            if (BENCH_HAS_TSC)
+                fprintf(table, "%12.2f\n", r.cycles);
+            else
+                fprintf(table, "%12s\n", "-");
+            fflush(table);
+        }
+    }
+
+    int status = 0;
+    if (jsonPath != NULL)
+    {
+        FILE* f = jsonToStdout ? stdout : OpenFile(jsonPath, "w");
+        if (f == NULL)
+        {
+            fprintf(stderr, "Could not write %s\n", jsonPath);
+            status = 1;
+        }
+        else
+        {
+            WriteJson(f, results, resultCount, datasets, datasetCount, reps);
+            if (!jsonToStdout)
+                fclose(f);
+        }
+    }
+
+    FreeFixtures();
+    free(results);
+    free(s_scratch);
+    free(out);
+    free(in);
+    for (size_t d = 0; d < datasetCount; d++)
+        free(datasets[d].rgb);
+    return status;
+}
@@ -0,0 +1,27 @@
+// main.h
+#pragma once
+
+// Every public header with a conversion the benchmark times.
+#include "color_support.h"
+#include "rgb_color.h"
+#include "hsl_space.h"
+#include "hsv_space.h"
+#include "xyz_space.h"
+#include "cmyk_space.h"
+#include "lch_space.h"
+#include "luv_space.h"
+#include "oklab_space.h"
+#include "chromatic_adaptation.h"
+#include "conversion_plan.h"
+#include "planar.h"
+#include "parallel.h"
+#include "gamut_map.h"
+#include "quantize.h"
+#include "dither.h"
+#include "gradient.h"
+#include "delta_e.h"
+#include "palette_index.h"
+#include "palette_cache.h"
+#include "ansi_sgr.h"
+#include "ansi_buffer.h"
+#include "ansi_image.h"
@@ -31,6 +31,7 @@ const char* welcomeToDemo = " Welcome to the C Console Color Demo! ";
 
 static void ColorConversionDemo(void);
 static void ConsoleColorPrintDemo(void);
+static void HalfBlockImageDemo(void);
 static void ShowColorInfo(RgbColor bgColor, RgbColor fgColor, char* title);
 static void AnyKey(const char* msg, const RgbColor* fg);
 static void FormatStringV(char* buffer, size_t size, const char* fmt, va_list args);
@@ -54,6 +55,7 @@ int main(void)
     }
     ConsoleColorPrintDemo();
     ColorConversionDemo();
+    HalfBlockImageDemo();
 
     // with color, use NULL instead for no color.
     AnyKey("Press any key to exit...\n\n", &rgbRed);
@@ -158,6 +160,102 @@ static void ShowColorInfo(RgbColor bgColor, RgbColor fgColor, char* title) {
 	ChizlFree(hex);
 }
 
+/// <summary>
+/// Fills a test frame: a fixed gradient with a ball bouncing across it, so most cells stay the same between frames.
+/// </summary>
+static void DrawDemoFrame(RgbColor* pixels, int width, int height, int frame)
+{
+    const int ballX = (frame * 2) % (width * 2) < width ? (frame * 2) % width : width - 1 - (frame * 2) % width;
+    const int ballY = height / 2;
+
+    for (int y = 0; y < height; y++)
+    {
+        for (int x = 0; x < width; x++)
+        {
+            const int dx = x - ballX, dy = y - ballY;
+            RgbColor* p = &pixels[y * width + x];
+            p->alpha = 255;
+
+            if (dx * dx + dy * dy <= 36)
+            {
+                p->red = 255; p->green = 200; p->blue = 40;
+            }
+            else
+            {
+                p->red = (unsigned char)(x * 255 / width);
+                p->green = (unsigned char)(y * 255 / height);
+                p->blue = 128;
+            }
+        }
+    }
+}
+
+/// <summary>
+/// Renders an animation with AnsiImage (two pixels per cell) and reports frame time and bytes written,
+/// first with diff based repaint, then repainting every frame in full for comparison.
+/// </summary>
+static void HalfBlockImageDemo(void)
+{
+    enum { width = 64, height = 40, frames = 120 };
+    RgbColor* pixels = malloc(sizeof(RgbColor) * width * height);
+    AnsiBuffer* out = AnsiBufferCreate(0);
+    LARGE_INTEGER freq, t0, t1;
+    double ms[2] = { 0 };
+    unsigned long long bytes[2] = { 0 };
+
+    if (pixels == NULL || out == NULL)
+    {
+        free(pixels);
+        AnsiBufferFree(out);
+        return;
+    }
+
+    // The half block glyph is UTF-8.
+    const UINT oldCp = GetConsoleOutputCP();
+    SetConsoleOutputCP(CP_UTF8);
+    QueryPerformanceFrequency(&freq);
+
+    for (int pass = 0; pass < 2; pass++)
+    {
+        AnsiImage* image = AnsiImageCreate(width, height);
+        if (image == NULL)
+            break;
+
+        ClearBuffer();
+        QueryPerformanceCounter(&t0);
+        for (int f = 0; f < frames; f++)
+        {
+            DrawDemoFrame(pixels, width, height, f);
+            if (pass == 1)
+                AnsiImageInvalidate(image);     // Full repaint every frame
+            AnsiImageRender(image, pixels, 0, 1, 1, out);
+            AnsiBufferFlush(out);
+        }
+        QueryPerformanceCounter(&t1);
+
+        AnsiImageStats stats;
+        AnsiImageGetStats(image, &stats);
+        ms[pass] = (double)(t1.QuadPart - t0.QuadPart) * 1000.0 / (double)freq.QuadPart;
+        bytes[pass] = stats.totalBytes;
+        AnsiImageFree(image);
+    }
+
+    SetConsoleOutputCP(oldCp);
+    AnsiBufferMoveTo(out, (height / 2) + 2, 1);
+    AnsiBufferFlush(out);
+
+    for (int pass = 0; pass < 2; pass++)
+    {
+        printf("%-14s %d frames, %8.2f ms/frame, %7.1f fps, %8llu bytes/frame\n",
+            pass == 0 ? "Diff repaint:" : "Full repaint:", frames,
+            ms[pass] / frames, frames * 1000.0 / ms[pass], bytes[pass] / frames);
+    }
+
+    free(pixels);
+    AnsiBufferFree(out);
+    AnyKey("\nPress any key to continue...", &rgbYellow);
+}
+
 static void ConsoleColorPrintDemo(void) {
     // Set no color.
     WriteLine(NULL, NULL, " - showing default color - ");
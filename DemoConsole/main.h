@@ -4,6 +4,9 @@
 // We include this here so that any .c file that includes main.h
 // automatically gets the DLL functions, too. Good!
 #include "ansi_printing.h"
+#include "ansi_sgr.h"
+#include "ansi_buffer.h"
+#include "ansi_image.h"
 #include "color_support.h"
 #include "rgb_color.h"
 #include "hsl_space.h"
@@ -12,6 +15,18 @@
 #include "cmyk_space.h"
 #include "lch_space.h"
 #include "luv_space.h"
+#include "oklab_space.h"
+#include "chromatic_adaptation.h"
+#include "conversion_plan.h"
+#include "delta_e.h"
+#include "planar.h"
+#include "parallel.h"
+#include "palette_index.h"
+#include "palette_cache.h"
+#include "quantize.h"
+#include "dither.h"
+#include "gamut_map.h"
+#include "gradient.h"
 
 // --- DECLARATIONS ---
 // We "declare" the variables with 'extern'.
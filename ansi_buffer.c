@@ -0,0 +1,268 @@
+// ansi_buffer.c
+#include "ansi_buffer.h"
+#include "ansi_sgr_core.h"      // For AnsiColorKey, AnsiSgrAppendKey
+#include <stdio.h>              // For fflush
+#include <stdlib.h>             // For malloc, realloc, free
+#include <string.h>             // For memcpy, strlen
+
+#if defined(_WIN32) || defined(_WIN64)
+  #ifndef WIN32_LEAN_AND_MEAN
+    #define WIN32_LEAN_AND_MEAN
+  #endif
+  #include <windows.h>          // For GetStdHandle, WriteFile
+#else
+  #include <errno.h>            // For EINTR
+  #include <unistd.h>           // For write
+#endif
+
+// Console render buffer.  Output is appended to one growable block and handed to the OS in a single
+// write, and the last foreground / background set is tracked so repeated colors cost nothing.  A frame
+// of a few thousand cells becomes one syscall instead of thousands of printf + fflush pairs.
+
+#define ANSI_BUFFER_DEFAULT_CAPACITY (64 * 1024)
+
+// Longest sequence built here: "\x1b[38;2;255;255;255;48;2;255;255;255m" (36 bytes), plus the
+// 2 bytes of slack AnsiSgrAppendKey needs.
+#define ANSI_SGR_MAX 40
+
+struct AnsiBuffer {
+    char* data;
+    size_t length;
+    size_t capacity;
+    AnsiColorMode mode;
+    uint32_t fg;                // AnsiColorKey of the active colors
+    uint32_t bg;
+    int fgKnown;                // fg is what the console currently has
+    int bgKnown;
+    int isDefault;              // Last color change was a reset
+};
+
+static int Reserve(AnsiBuffer* buffer, size_t extra)
+{
+    if (buffer->capacity - buffer->length >= extra)
+        return 1;
+
+    size_t capacity = buffer->capacity * 2;
+    if (capacity - buffer->length < extra)
+        capacity = buffer->length + extra;
+
+    char* data = (char*)realloc(buffer->data, capacity);
+    if (data == NULL)
+        return 0;
+
+    buffer->data = data;
+    buffer->capacity = capacity;
+    return 1;
+}
+
+/// <summary>
+/// Adds one SGR sequence for whichever of fg / bg differ from the console's current colors.
+/// </summary>
+static int SetColors(AnsiBuffer* buffer, const RgbColor* bg, const RgbColor* fg)
+{
+    // Compared by key, so in 256 / 16 color mode two colors with the same palette entry are a repeat too.
+    const uint32_t fgKey = (fg != NULL) ? AnsiColorKey(*fg, buffer->mode) : 0;
+    const uint32_t bgKey = (bg != NULL) ? AnsiColorKey(*bg, buffer->mode) : 0;
+    const int setFg = fg != NULL && !(buffer->fgKnown && buffer->fg == fgKey);
+    const int setBg = bg != NULL && !(buffer->bgKnown && buffer->bg == bgKey);
+
+    if (!setFg && !setBg)
+        return 1;
+    if (!Reserve(buffer, ANSI_SGR_MAX))
+        return 0;
+
+    char* p = buffer->data + buffer->length;
+    *p++ = '\x1b';
+    *p++ = '[';
+    if (setFg)
+    {
+        p = AnsiSgrAppendKey(p, fgKey, 0);
+        buffer->fg = fgKey;
+        buffer->fgKnown = 1;
+    }
+    if (setBg)
+    {
+        if (setFg)
+            *p++ = ';';
+        p = AnsiSgrAppendKey(p, bgKey, 1);
+        buffer->bg = bgKey;
+        buffer->bgKnown = 1;
+    }
+    *p++ = 'm';
+
+    buffer->length = (size_t)(p - buffer->data);
+    buffer->isDefault = 0;
+    return 1;
+}
+
+CHIZL_COLORS_API AnsiBuffer* AnsiBufferCreate(size_t capacity)
+{
+    AnsiBuffer* buffer = (AnsiBuffer*)calloc(1, sizeof(AnsiBuffer));
+    if (buffer == NULL)
+        return NULL;
+
+    buffer->capacity = capacity ? capacity : ANSI_BUFFER_DEFAULT_CAPACITY;
+    buffer->data = (char*)malloc(buffer->capacity);
+    if (buffer->data == NULL)
+    {
+        free(buffer);
+        return NULL;
+    }
+    return buffer;
+}
+
+CHIZL_COLORS_API void AnsiBufferFree(AnsiBuffer* buffer)
+{
+    if (buffer == NULL)
+        return;
+
+    free(buffer->data);
+    free(buffer);
+}
+
+CHIZL_COLORS_API int AnsiBufferSetColorMode(AnsiBuffer* buffer, AnsiColorMode mode)
+{
+    if (buffer == NULL || mode < ANSI_COLOR_24BIT || mode > ANSI_COLOR_16)
+        return 0;
+
+    buffer->mode = mode;
+    return 1;
+}
+
+CHIZL_COLORS_API int AnsiBufferSetFg(AnsiBuffer* buffer, RgbColor fg)
+{
+    return buffer != NULL && SetColors(buffer, NULL, &fg);
+}
+
+CHIZL_COLORS_API int AnsiBufferSetBg(AnsiBuffer* buffer, RgbColor bg)
+{
+    return buffer != NULL && SetColors(buffer, &bg, NULL);
+}
+
+CHIZL_COLORS_API int AnsiBufferSetColors(AnsiBuffer* buffer, RgbColor bg, RgbColor fg)
+{
+    return buffer != NULL && SetColors(buffer, &bg, &fg);
+}
+
+CHIZL_COLORS_API int AnsiBufferResetColor(AnsiBuffer* buffer)
+{
+    if (buffer == NULL)
+        return 0;
+    if (buffer->isDefault)
+        return 1;
+    if (!AnsiBufferWrite(buffer, "\x1b[0m", 4))
+        return 0;
+
+    buffer->fgKnown = 0;
+    buffer->bgKnown = 0;
+    buffer->isDefault = 1;
+    return 1;
+}
+
+CHIZL_COLORS_API int AnsiBufferWrite(AnsiBuffer* buffer, const char* text, size_t length)
+{
+    if (buffer == NULL || text == NULL)
+        return 0;
+    if (!Reserve(buffer, length))
+        return 0;
+
+    memcpy(buffer->data + buffer->length, text, length);
+    buffer->length += length;
+    return 1;
+}
+
+CHIZL_COLORS_API int AnsiBufferPuts(AnsiBuffer* buffer, const char* text)
+{
+    return text != NULL && AnsiBufferWrite(buffer, text, strlen(text));
+}
+
+CHIZL_COLORS_API int AnsiBufferMoveTo(AnsiBuffer* buffer, unsigned int row, unsigned int column)
+{
+    if (buffer == NULL)
+        return 0;
+
+    // "\x1b[row;columnH", each number up to 10 digits.
+    char code[32];
+    char* p = code;
+    char digits[10];
+    int n;
+
+    *p++ = '\x1b';
+    *p++ = '[';
+    n = 0;
+    do { digits[n++] = (char)('0' + row % 10); row /= 10; } while (row != 0);
+    while (n > 0) *p++ = digits[--n];
+    *p++ = ';';
+    do { digits[n++] = (char)('0' + column % 10); column /= 10; } while (column != 0);
+    while (n > 0) *p++ = digits[--n];
+    *p++ = 'H';
+
+    return AnsiBufferWrite(buffer, code, (size_t)(p - code));
+}
+
+CHIZL_COLORS_API int AnsiBufferFlush(AnsiBuffer* buffer)
+{
+    if (buffer == NULL)
+        return 0;
+    if (buffer->length == 0)
+        return 1;
+
+    // Anything printed through stdio before this must reach the console first.
+    fflush(stdout);
+
+    int ok = 1;
+    const char* p = buffer->data;
+    size_t left = buffer->length;
+
+#if defined(_WIN32) || defined(_WIN64)
+    const HANDLE out = GetStdHandle(STD_OUTPUT_HANDLE);
+    while (left > 0)
+    {
+        const DWORD chunk = (left > 0x40000000) ? 0x40000000 : (DWORD)left;
+        DWORD written = 0;
+        if (out == NULL || out == INVALID_HANDLE_VALUE || !WriteFile(out, p, chunk, &written, NULL) || written == 0)
+        {
+            ok = 0;
+            break;
+        }
+        p += written;
+        left -= written;
+    }
+#else
+    // One write() unless the OS takes it in parts (pipes, signals).
+    while (left > 0)
+    {
+        const ssize_t written = write(STDOUT_FILENO, p, left);
+        if (written < 0 && errno == EINTR)
+            continue;
+        if (written <= 0)
+        {
+            ok = 0;
+            break;
+        }
+        p += written;
+        left -= (size_t)written;
+    }
+#endif
+
+    buffer->length = 0;
+    return ok;
+}
+
+CHIZL_COLORS_API void AnsiBufferClear(AnsiBuffer* buffer)
+{
+    if (buffer == NULL)
+        return;
+
+    buffer->length = 0;
+    buffer->fgKnown = 0;
+    buffer->bgKnown = 0;
+    buffer->isDefault = 0;
+}
+
+CHIZL_COLORS_API const char* AnsiBufferData(const AnsiBuffer* buffer, size_t* length)
+{
+    if (length != NULL)
+        *length = (buffer != NULL) ? buffer->length : 0;
+    return (buffer != NULL) ? buffer->data : NULL;
+}
@@ -0,0 +1,139 @@
+// ansi_buffer.h
+
+#pragma once
+
+#ifndef ANSI_BUFFER_H
+#define ANSI_BUFFER_H
+
+// --- Start of "extern C" block ---
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "import_exports.h"
+#include "chizl_colors_types.h"
+#include "ansi_sgr.h"           // For AnsiColorMode
+#include <stddef.h>             // For size_t
+
+/// <summary>
+/// Opaque render buffer for console output.  Text, cursor moves and color changes are collected in memory
+/// and sent to the console with one write by AnsiBufferFlush, instead of the printf + fflush per change
+/// that SetFgColor / SetBgColor do.<br/>
+/// The buffer remembers the colors it last set, so setting the color that is already active writes nothing.
+/// Not thread safe, use one buffer per thread.
+/// </summary>
+typedef struct AnsiBuffer AnsiBuffer;
+
+/// <summary>
+/// Creates an empty render buffer.  It grows as needed, a capacity that fits a full frame avoids regrowing.
+/// </summary>
+/// <param name="capacity">Initial size in bytes, 0 for a default (64 KB).</param>
+/// <returns>The new buffer, or NULL when out of memory.  Release with AnsiBufferFree.</returns>
+CHIZL_COLORS_API AnsiBuffer* AnsiBufferCreate(size_t capacity);
+
+/// <summary>
+/// Releases a buffer from AnsiBufferCreate without flushing it.  NULL is ignored.
+/// </summary>
+/// <param name="buffer">Buffer to free.</param>
+/// <returns>This function does not return a value.</returns>
+CHIZL_COLORS_API void AnsiBufferFree(AnsiBuffer* buffer);
+
+/// <summary>
+/// Sets the color depth for the colors set from now on, for terminals without 24-bit color.  In 256 and 16
+/// color mode each color is replaced by its nearest palette entry (AnsiNearest256 / AnsiNearest16), which
+/// also makes the sequences shorter.  New buffers use ANSI_COLOR_24BIT.
+/// </summary>
+/// <param name="buffer">Render buffer.</param>
+/// <param name="mode">Color depth.</param>
+/// <returns>1 on success, 0 if buffer is NULL or mode is unknown.</returns>
+CHIZL_COLORS_API int AnsiBufferSetColorMode(AnsiBuffer* buffer, AnsiColorMode mode);
+
+/// <summary>
+/// Sets the foreground (text) color, nothing is added if it is already the active foreground.  Alpha is ignored.
+/// </summary>
+/// <param name="buffer">Render buffer.</param>
+/// <param name="fg">Foreground color.</param>
+/// <returns>1 on success, 0 if buffer is NULL or out of memory.</returns>
+CHIZL_COLORS_API int AnsiBufferSetFg(AnsiBuffer* buffer, RgbColor fg);
+
+/// <summary>
+/// Sets the background color, nothing is added if it is already the active background.  Alpha is ignored.
+/// </summary>
+/// <param name="buffer">Render buffer.</param>
+/// <param name="bg">Background color.</param>
+/// <returns>1 on success, 0 if buffer is NULL or out of memory.</returns>
+CHIZL_COLORS_API int AnsiBufferSetBg(AnsiBuffer* buffer, RgbColor bg);
+
+/// <summary>
+/// Sets both colors (same argument order as SetColorsEx).  When both change they go out as a single sequence.
+/// </summary>
+/// <param name="buffer">Render buffer.</param>
+/// <param name="bg">Background color.</param>
+/// <param name="fg">Foreground color.</param>
+/// <returns>1 on success, 0 if buffer is NULL or out of memory.</returns>
+CHIZL_COLORS_API int AnsiBufferSetColors(AnsiBuffer* buffer, RgbColor bg, RgbColor fg);
+
+/// <summary>
+/// Adds a reset to the console's default colors (as ResetColor does), unless the defaults are already active.
+/// </summary>
+/// <param name="buffer">Render buffer.</param>
+/// <returns>1 on success, 0 if buffer is NULL or out of memory.</returns>
+CHIZL_COLORS_API int AnsiBufferResetColor(AnsiBuffer* buffer);
+
+/// <summary>
+/// Adds text in the current colors.  The text is copied as is, it should not contain escape sequences
+/// that change colors or the buffer's record of the active colors will be wrong.
+/// </summary>
+/// <param name="buffer">Render buffer.</param>
+/// <param name="text">Text to add, does not need to be null terminated.</param>
+/// <param name="length">Number of bytes to add.</param>
+/// <returns>1 on success, 0 if a pointer is NULL or out of memory.</returns>
+CHIZL_COLORS_API int AnsiBufferWrite(AnsiBuffer* buffer, const char* text, size_t length);
+
+/// <summary>
+/// AnsiBufferWrite for a null terminated string.
+/// </summary>
+/// <param name="buffer">Render buffer.</param>
+/// <param name="text">Null terminated text to add.</param>
+/// <returns>1 on success, 0 if a pointer is NULL or out of memory.</returns>
+CHIZL_COLORS_API int AnsiBufferPuts(AnsiBuffer* buffer, const char* text);
+
+/// <summary>
+/// Adds a cursor move, so a frame can repaint in place instead of scrolling.
+/// </summary>
+/// <param name="buffer">Render buffer.</param>
+/// <param name="row">Row, 1 is the top line.</param>
+/// <param name="column">Column, 1 is the left edge.</param>
+/// <returns>1 on success, 0 if buffer is NULL or out of memory.</returns>
+CHIZL_COLORS_API int AnsiBufferMoveTo(AnsiBuffer* buffer, unsigned int row, unsigned int column);
+
+/// <summary>
+/// Writes everything collected so far to stdout with a single write call (stdio's own buffer is flushed
+/// first so output stays in order), then empties the buffer.  The active colors are still remembered.
+/// </summary>
+/// <param name="buffer">Render buffer.</param>
+/// <returns>1 on success, 0 if buffer is NULL or the write failed (the contents are dropped either way).</returns>
+CHIZL_COLORS_API int AnsiBufferFlush(AnsiBuffer* buffer);
+
+/// <summary>
+/// Drops the collected output without writing it and forgets the active colors, so the next color set
+/// is always written.  Also use this after anything else has printed colors to the console.
+/// </summary>
+/// <param name="buffer">Render buffer.</param>
+/// <returns>This function does not return a value.</returns>
+CHIZL_COLORS_API void AnsiBufferClear(AnsiBuffer* buffer);
+
+/// <summary>
+/// Returns the collected output, for sending somewhere other than stdout (a file, socket or log).
+/// Valid until the next call that changes the buffer.
+/// </summary>
+/// <param name="buffer">Render buffer.</param>
+/// <param name="length">Receives the number of bytes, may be NULL.</param>
+/// <returns>Pointer to the bytes (not null terminated), NULL if buffer is NULL.</returns>
+CHIZL_COLORS_API const char* AnsiBufferData(const AnsiBuffer* buffer, size_t* length);
+
+// --- End of "extern C" block ---
+#ifdef __cplusplus
+}
+#endif
+#endif
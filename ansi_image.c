@@ -0,0 +1,162 @@
+// ansi_image.c
+#include "ansi_image.h"
+#include "chizl_clock.h"        // For ChizlNowMs
+#include <stdint.h>             // For uint32_t
+#include <stdlib.h>             // For malloc, calloc, free
+
+// Half block image rendering with frame to frame diffing.
+//
+// Every cell is a pair of packed 0xRRGGBB values (top, bottom), kept from the frame before.  Unchanged
+// cells are skipped, and the cursor is only moved at the start of each run of changed cells, since
+// writing a cell advances it by one column on its own.  Colors go through the AnsiBuffer, which drops
+// repeats, so flat areas cost the glyph bytes alone.  A cell with the same color top and bottom is
+// written as a space on that background (1 byte instead of 3, and no text color change).
+
+#define ANSI_IMAGE_NO_PIXEL 0xFFFFFFFFu     // Bottom half of the last row when the height is odd
+
+static const char s_upperHalf[] = "\xE2\x96\x80";   // U+2580 in UTF-8
+
+struct AnsiImage {
+    size_t width;
+    size_t height;
+    size_t rows;                // Cell rows, (height + 1) / 2
+    uint32_t* cells;            // rows * width pairs of (top, bottom)
+    int valid;                  // cells holds what is on screen
+    AnsiImageStats stats;
+};
+
+static inline uint32_t PackRgb(RgbColor c)
+{
+    return ((uint32_t)c.red << 16) | ((uint32_t)c.green << 8) | c.blue;
+}
+
+static inline RgbColor UnpackRgb(uint32_t v)
+{
+    RgbColor c = { 255, (unsigned char)(v >> 16), (unsigned char)(v >> 8), (unsigned char)v };
+    return c;
+}
+
+static int WriteCell(AnsiBuffer* out, uint32_t top, uint32_t bottom)
+{
+    if (bottom == ANSI_IMAGE_NO_PIXEL)
+        return AnsiBufferResetColor(out) && AnsiBufferSetFg(out, UnpackRgb(top)) && AnsiBufferWrite(out, s_upperHalf, 3);
+
+    if (top == bottom)
+        return AnsiBufferSetBg(out, UnpackRgb(bottom)) && AnsiBufferWrite(out, " ", 1);
+
+    return AnsiBufferSetColors(out, UnpackRgb(bottom), UnpackRgb(top)) && AnsiBufferWrite(out, s_upperHalf, 3);
+}
+
+CHIZL_COLORS_API AnsiImage* AnsiImageCreate(size_t width, size_t height)
+{
+    if (width == 0 || height == 0)
+        return NULL;
+
+    AnsiImage* image = (AnsiImage*)calloc(1, sizeof(AnsiImage));
+    if (image == NULL)
+        return NULL;
+
+    image->width = width;
+    image->height = height;
+    image->rows = (height + 1) / 2;
+    image->cells = (uint32_t*)malloc(image->rows * width * 2 * sizeof(uint32_t));
+    if (image->cells == NULL)
+    {
+        free(image);
+        return NULL;
+    }
+
+    image->stats.cells = image->rows * width;
+    return image;
+}
+
+CHIZL_COLORS_API void AnsiImageFree(AnsiImage* image)
+{
+    if (image == NULL)
+        return;
+
+    free(image->cells);
+    free(image);
+}
+
+CHIZL_COLORS_API int AnsiImageRender(AnsiImage* image, const RgbColor* pixels, size_t stride, unsigned int row, unsigned int column, AnsiBuffer* out)
+{
+    if (image == NULL || pixels == NULL || out == NULL)
+        return 0;
+
+    const double start = ChizlNowMs();
+    const size_t rowBytes = stride ? stride : image->width * sizeof(RgbColor);
+    const int full = !image->valid;
+    size_t before = 0;
+    size_t changed = 0;
+    int ok = 1;
+
+    AnsiBufferData(out, &before);
+
+    for (size_t y = 0; y < image->rows && ok; y++)
+    {
+        const RgbColor* top = (const RgbColor*)((const unsigned char*)pixels + (2 * y) * rowBytes);
+        const RgbColor* bottom = (2 * y + 1 < image->height) ? (const RgbColor*)((const unsigned char*)top + rowBytes) : NULL;
+        uint32_t* cell = image->cells + (y * image->width * 2);
+        int cursorHere = 0;     // Cursor already sits on cell x
+
+        for (size_t x = 0; x < image->width; x++, cell += 2)
+        {
+            const uint32_t t = PackRgb(top[x]);
+            const uint32_t b = bottom ? PackRgb(bottom[x]) : ANSI_IMAGE_NO_PIXEL;
+
+            if (!full && cell[0] == t && cell[1] == b)
+            {
+                cursorHere = 0;
+                continue;
+            }
+
+            if (!cursorHere && !AnsiBufferMoveTo(out, row + (unsigned int)y, column + (unsigned int)x))
+            {
+                ok = 0;
+                break;
+            }
+            if (!WriteCell(out, t, b))
+            {
+                ok = 0;
+                break;
+            }
+
+            cell[0] = t;
+            cell[1] = b;
+            cursorHere = 1;
+            changed++;
+        }
+    }
+
+    if (ok && changed > 0)
+        ok = AnsiBufferResetColor(out);
+
+    // A partly written frame leaves the screen unknown, repaint everything next time.
+    image->valid = ok;
+
+    size_t after = 0;
+    AnsiBufferData(out, &after);
+
+    image->stats.changedCells = changed;
+    image->stats.bytes = after - before;
+    image->stats.renderMs = ChizlNowMs() - start;
+    image->stats.frames++;
+    image->stats.totalBytes += image->stats.bytes;
+    return ok;
+}
+
+CHIZL_COLORS_API void AnsiImageInvalidate(AnsiImage* image)
+{
+    if (image != NULL)
+        image->valid = 0;
+}
+
+CHIZL_COLORS_API int AnsiImageGetStats(const AnsiImage* image, AnsiImageStats* stats)
+{
+    if (image == NULL || stats == NULL)
+        return 0;
+
+    *stats = image->stats;
+    return 1;
+}
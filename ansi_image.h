@@ -0,0 +1,107 @@
+// ansi_image.h
+
+#pragma once
+
+#ifndef ANSI_IMAGE_H
+#define ANSI_IMAGE_H
+
+// --- Start of "extern C" block ---
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "import_exports.h"
+#include "chizl_colors_types.h"
+#include "ansi_buffer.h"        // For AnsiBuffer
+#include <stddef.h>             // For size_t
+
+/// <summary>
+/// Opaque terminal image renderer.  Each console cell shows two pixels stacked vertically with the upper
+/// half block glyph (U+2580): the top pixel is the text color, the bottom pixel the background color.<br/>
+/// The renderer keeps the last frame it drew, so later frames only write the cells that changed.<br/>
+/// Output is UTF-8, on Windows the console needs SetConsoleOutputCP(CP_UTF8) and virtual terminal processing.
+/// </summary>
+typedef struct AnsiImage AnsiImage;
+
+/// <summary>
+/// Output and timing of an AnsiImage, from AnsiImageGetStats.
+/// </summary>
+typedef struct {
+    /// <summary>
+    /// Console cells the image covers, width * ((height + 1) / 2).
+    /// </summary>
+    size_t cells;
+    /// <summary>
+    /// Cells the last AnsiImageRender wrote (all of them on a full repaint).
+    /// </summary>
+    size_t changedCells;
+    /// <summary>
+    /// Bytes the last AnsiImageRender added to the AnsiBuffer.
+    /// </summary>
+    size_t bytes;
+    /// <summary>
+    /// Milliseconds the last AnsiImageRender took, not including the AnsiBufferFlush.
+    /// </summary>
+    double renderMs;
+    /// <summary>
+    /// Frames rendered since AnsiImageCreate.
+    /// </summary>
+    size_t frames;
+    /// <summary>
+    /// Bytes added over all frames.
+    /// </summary>
+    unsigned long long totalBytes;
+} AnsiImageStats;
+
+/// <summary>
+/// Creates a renderer for images of a fixed size.  An odd height leaves the bottom half of the last
+/// cell row in the console's default background.
+/// </summary>
+/// <param name="width">Image width in pixels (console columns).</param>
+/// <param name="height">Image height in pixels (two per console row).</param>
+/// <returns>The new renderer, or NULL if a size is 0 or out of memory.  Release with AnsiImageFree.</returns>
+CHIZL_COLORS_API AnsiImage* AnsiImageCreate(size_t width, size_t height);
+
+/// <summary>
+/// Releases a renderer from AnsiImageCreate.  NULL is ignored.
+/// </summary>
+/// <param name="image">Renderer to free.</param>
+/// <returns>This function does not return a value.</returns>
+CHIZL_COLORS_API void AnsiImageFree(AnsiImage* image);
+
+/// <summary>
+/// Adds a frame to a render buffer: every cell the first time (or after AnsiImageInvalidate), afterwards
+/// only cells whose two pixels differ from the previous frame, each run of changed cells starting with a
+/// cursor move.  The frame ends with a color reset.  Send it with AnsiBufferFlush.<br/>
+/// Assumes nothing else has drawn over the image area since the last frame, call AnsiImageInvalidate if it has.
+/// </summary>
+/// <param name="image">Renderer.</param>
+/// <param name="pixels">Top row first, width * height colors.  Alpha is ignored.</param>
+/// <param name="stride">Distance in bytes between pixel rows, 0 for width * sizeof(RgbColor).</param>
+/// <param name="row">Console row of the image's top edge, 1 is the top line.</param>
+/// <param name="column">Console column of the image's left edge, 1 is the left edge.</param>
+/// <param name="out">Render buffer that receives the output.</param>
+/// <returns>1 on success, 0 if a pointer is NULL or out of memory (the next frame is then a full repaint).</returns>
+CHIZL_COLORS_API int AnsiImageRender(AnsiImage* image, const RgbColor* pixels, size_t stride, unsigned int row, unsigned int column, AnsiBuffer* out);
+
+/// <summary>
+/// Forgets the previous frame so the next AnsiImageRender repaints every cell, e.g. after the screen was
+/// cleared, scrolled or resized.
+/// </summary>
+/// <param name="image">Renderer.</param>
+/// <returns>This function does not return a value.</returns>
+CHIZL_COLORS_API void AnsiImageInvalidate(AnsiImage* image);
+
+/// <summary>
+/// Reports the bytes written and time taken by the last frame and the totals so far.
+/// </summary>
+/// <param name="image">Renderer.</param>
+/// <param name="stats">Receives the statistics.</param>
+/// <returns>1 on success, 0 if either pointer is NULL.</returns>
+CHIZL_COLORS_API int AnsiImageGetStats(const AnsiImage* image, AnsiImageStats* stats);
+
+// --- End of "extern C" block ---
+#ifdef __cplusplus
+}
+#endif
+#endif
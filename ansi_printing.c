@@ -1,23 +1,36 @@
 // ansi_printing.c
-#include <string.h>             // For strlen, strcpy_s
-#include <stdio.h>              // Required for sprintf
+#include <stdio.h>              // For fwrite, fflush
 #include "ansi_printing.h"
-#include "common.h"
+#include "ansi_sgr_core.h"      // For AnsiColorKey, AnsiSgrAppendKey
+
+static volatile AnsiColorMode s_colorMode = ANSI_COLOR_24BIT;
 
 static void PrintAnsiColor(int isFg, unsigned char r, unsigned char g, unsigned char b)
 {
-    char code[50];
-    
-    sprintf_s(code, sizeof(code), "\x1b[%d;2;%u;%u;%um", 
-        isFg ? 38 : 48, 
-        clampUChr(r, 0, 255), 
-        clampUChr(g, 0, 255), 
-        clampUChr(b, 0, 255));
-
-    printf("%s", code);
+    const RgbColor clr = { 255, r, g, b };
+    char code[CHIZL_SGR_SIZE + 4];
+    char* p = code;
+
+    *p++ = '\x1b';
+    *p++ = '[';
+    p = AnsiSgrAppendKey(p, AnsiColorKey(clr, s_colorMode), !isFg);
+    *p++ = 'm';
+
+    fwrite(code, 1, (size_t)(p - code), stdout);
     fflush(stdout);
 }
 
+CHIZL_COLORS_API void SetConsoleColorMode(AnsiColorMode mode)
+{
+    if (mode >= ANSI_COLOR_24BIT && mode <= ANSI_COLOR_16)
+        s_colorMode = mode;
+}
+
+CHIZL_COLORS_API AnsiColorMode GetConsoleColorMode(void)
+{
+    return s_colorMode;
+}
+
 CHIZL_COLORS_API void SetColorsEx(RgbColor bg, RgbColor fg) 
 { 
     SetBgColorEx(bg); SetFgColorEx(fg); 
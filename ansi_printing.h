@@ -7,6 +7,7 @@
 
 #include "import_exports.h"
 #include "chizl_colors_types.h"
+#include "ansi_sgr.h"           // For AnsiColorMode
 
 // --- Start of "extern C" block ---
 #ifdef __cplusplus
@@ -48,6 +49,18 @@ extern "C" {
     /// <param name="blue">byte (0-255)</param>
     CHIZL_COLORS_API void SetBgColor(unsigned char red, unsigned char green, unsigned char blue);
 
+    /// <summary>
+    /// For Console use only, sets the color depth SetColorsEx / SetFgColor / SetBgColor write, for terminals
+    /// without 24-bit color.  256 and 16 color modes use the nearest palette color.  Default: ANSI_COLOR_24BIT.
+    /// </summary>
+    /// <param name="mode">Color depth, unknown values are ignored.</param>
+    CHIZL_COLORS_API void SetConsoleColorMode(AnsiColorMode mode);
+
+    /// <summary>
+    /// Returns the color depth set with SetConsoleColorMode.
+    /// </summary>
+    CHIZL_COLORS_API AnsiColorMode GetConsoleColorMode(void);
+
     /// <summary>
     /// For Console use only, this will reset both foreground and background color back to console's default colors.
     /// </summary>
@@ -0,0 +1,200 @@
+// ansi_sgr.c
+#include "ansi_sgr_core.h"
+#include "palette_index.h"      // For PaletteIndexCreate, PaletteIndexNearest
+#include "chizl_once.h"
+#include <string.h>             // For memcpy
+
+// SGR color sequences.
+//
+// Numbers come from a table of the decimal text of 0 - 255, each entry padded to 3 chars, so every
+// number is one fixed 3 byte copy plus an advance by its real length (callers leave 2 bytes of slack).
+// Lower color depths map through PaletteIndex (CIE76 in Lab), built once on first use.
+
+typedef struct {
+    char text[3];
+    unsigned char length;
+} DecimalText;
+
+static DecimalText s_decimal[256];
+static ChizlOnce s_decimalOnce = CHIZL_ONCE_INIT;
+
+static PaletteIndex* s_index256 = NULL;     // Entries 16 - 255
+static PaletteIndex* s_index16 = NULL;
+static ChizlOnce s_paletteOnce = CHIZL_ONCE_INIT;
+
+// xterm default system colors, 0 - 7 normal, 8 - 15 bright.
+static const RgbColor s_system16[16] = {
+    { 255,   0,   0,   0 }, { 255, 205,   0,   0 }, { 255,   0, 205,   0 }, { 255, 205, 205,   0 },
+    { 255,   0,   0, 238 }, { 255, 205,   0, 205 }, { 255,   0, 205, 205 }, { 255, 229, 229, 229 },
+    { 255, 127, 127, 127 }, { 255, 255,   0,   0 }, { 255,   0, 255,   0 }, { 255, 255, 255,   0 },
+    { 255,  92,  92, 255 }, { 255, 255,   0, 255 }, { 255,   0, 255, 255 }, { 255, 255, 255, 255 }
+};
+
+static const unsigned char s_cubeLevels[6] = { 0, 95, 135, 175, 215, 255 };
+
+static void BuildDecimalTable(void)
+{
+    for (int i = 0; i < 256; i++)
+    {
+        DecimalText* d = &s_decimal[i];
+        if (i >= 100)
+        {
+            d->text[0] = (char)('0' + i / 100);
+            d->text[1] = (char)('0' + (i / 10) % 10);
+            d->text[2] = (char)('0' + i % 10);
+            d->length = 3;
+        }
+        else if (i >= 10)
+        {
+            d->text[0] = (char)('0' + i / 10);
+            d->text[1] = (char)('0' + i % 10);
+            d->length = 2;
+        }
+        else
+        {
+            d->text[0] = (char)('0' + i);
+            d->length = 1;
+        }
+    }
+}
+
+static void BuildPaletteIndexes(void)
+{
+    RgbColor palette[240];
+    for (int i = 0; i < 240; i++)
+        palette[i] = Ansi256ToRgb((unsigned char)(i + 16));
+
+    // On out of memory the index stays NULL and lookups fall back to a plain scan.
+    s_index256 = PaletteIndexCreate(palette, 240);
+    s_index16 = PaletteIndexCreate(s_system16, 16);
+}
+
+/// <summary>
+/// Nearest of 'count' colors by a full scan, only used if the PaletteIndex could not be built.
+/// </summary>
+static size_t NearestScan(RgbColor clr, RgbColor (*entry)(size_t), size_t count)
+{
+    size_t best = 0;
+    long bestDist = -1;
+    for (size_t i = 0; i < count; i++)
+    {
+        const RgbColor e = entry(i);
+        const long dr = (long)e.red - clr.red, dg = (long)e.green - clr.green, db = (long)e.blue - clr.blue;
+        const long dist = dr * dr + dg * dg + db * db;
+        if (bestDist < 0 || dist < bestDist)
+        {
+            bestDist = dist;
+            best = i;
+        }
+    }
+    return best;
+}
+
+static RgbColor Cube240Entry(size_t i) { return Ansi256ToRgb((unsigned char)(i + 16)); }
+static RgbColor System16Entry(size_t i) { return s_system16[i]; }
+
+static inline char* AppendDecimal(char* p, unsigned int v)
+{
+    const DecimalText* d = &s_decimal[v];
+    memcpy(p, d->text, 3);
+    return p + d->length;
+}
+
+CHIZL_COLORS_API RgbColor Ansi256ToRgb(unsigned char index)
+{
+    if (index < 16)
+        return s_system16[index];
+
+    RgbColor clr = { 255, 0, 0, 0 };
+    if (index >= 232)
+    {
+        const unsigned char gray = (unsigned char)(8 + (index - 232) * 10);
+        clr.red = clr.green = clr.blue = gray;
+    }
+    else
+    {
+        const int cube = index - 16;
+        clr.red = s_cubeLevels[cube / 36];
+        clr.green = s_cubeLevels[(cube / 6) % 6];
+        clr.blue = s_cubeLevels[cube % 6];
+    }
+    return clr;
+}
+
+CHIZL_COLORS_API unsigned char AnsiNearest256(RgbColor clr)
+{
+    ChizlRunOnce(&s_paletteOnce, BuildPaletteIndexes);
+    const size_t i = (s_index256 != NULL) ? PaletteIndexNearest(s_index256, clr, DELTAE_CIE76, NULL) : NearestScan(clr, Cube240Entry, 240);
+    return (unsigned char)(i + 16);
+}
+
+CHIZL_COLORS_API unsigned char AnsiNearest16(RgbColor clr)
+{
+    ChizlRunOnce(&s_paletteOnce, BuildPaletteIndexes);
+    const size_t i = (s_index16 != NULL) ? PaletteIndexNearest(s_index16, clr, DELTAE_CIE76, NULL) : NearestScan(clr, System16Entry, 16);
+    return (unsigned char)i;
+}
+
+uint32_t AnsiColorKey(RgbColor clr, AnsiColorMode mode)
+{
+    switch (mode)
+    {
+    case ANSI_COLOR_256:
+        return ((uint32_t)ANSI_COLOR_256 << 24) | AnsiNearest256(clr);
+    case ANSI_COLOR_16:
+        return ((uint32_t)ANSI_COLOR_16 << 24) | AnsiNearest16(clr);
+    default:
+        return ((uint32_t)clr.red << 16) | ((uint32_t)clr.green << 8) | clr.blue;
+    }
+}
+
+char* AnsiSgrAppendKey(char* p, uint32_t key, int background)
+{
+    ChizlRunOnce(&s_decimalOnce, BuildDecimalTable);
+
+    switch ((AnsiColorMode)(key >> 24))
+    {
+    case ANSI_COLOR_256:
+        memcpy(p, background ? "48;5;" : "38;5;", 5);
+        return AppendDecimal(p + 5, key & 0xFF);
+    case ANSI_COLOR_16:
+    {
+        const unsigned int n = key & 0xFF;
+        const unsigned int code = ((n < 8) ? 30 + n : 90 + (n - 8)) + (background ? 10 : 0);
+        return AppendDecimal(p, code);
+    }
+    default:
+        memcpy(p, background ? "48;2;" : "38;2;", 5);
+        p = AppendDecimal(p + 5, (key >> 16) & 0xFF);
+        *p++ = ';';
+        p = AppendDecimal(p, (key >> 8) & 0xFF);
+        *p++ = ';';
+        return AppendDecimal(p, key & 0xFF);
+    }
+}
+
+CHIZL_COLORS_API size_t AnsiSgrColor(RgbColor clr, unsigned int background, AnsiColorMode mode, char* buffer, size_t bufferSize)
+{
+    if (buffer == NULL || mode < ANSI_COLOR_24BIT || mode > ANSI_COLOR_16)
+        return 0;
+
+    // Built in a scratch buffer with room for the 3 byte number copies, then copied out.
+    char code[CHIZL_SGR_SIZE + 4];
+    char* p = code;
+    *p++ = '\x1b';
+    *p++ = '[';
+    p = AnsiSgrAppendKey(p, AnsiColorKey(clr, mode), background != 0);
+    *p++ = 'm';
+
+    const size_t length = (size_t)(p - code);
+    if (bufferSize <= length)
+    {
+        if (bufferSize > 0)
+            buffer[0] = '\0';
+        return 0;
+    }
+
+    memcpy(buffer, code, length);
+    buffer[length] = '\0';
+    return length;
+}
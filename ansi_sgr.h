@@ -0,0 +1,78 @@
+// ansi_sgr.h
+
+#pragma once
+
+#ifndef ANSI_SGR_H
+#define ANSI_SGR_H
+
+// --- Start of "extern C" block ---
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "import_exports.h"
+#include "chizl_colors_types.h"
+#include <stddef.h>             // For size_t
+
+/// <summary>
+/// Color depth of the SGR (Select Graphic Rendition) sequences written for a color.
+/// </summary>
+typedef enum {
+    /// <summary>
+    /// 24-bit "\x1b[38;2;R;G;Bm", exact color.  Default.
+    /// </summary>
+    ANSI_COLOR_24BIT = 0,
+    /// <summary>
+    /// xterm 256 color "\x1b[38;5;Nm", nearest entry of the 6x6x6 cube and gray ramp (16 - 255) in Lab.
+    /// The 16 system colors are left out, terminals theme them so their look is unknown.
+    /// </summary>
+    ANSI_COLOR_256 = 1,
+    /// <summary>
+    /// 16 color "\x1b[30m" - "\x1b[97m", nearest of the xterm default system colors in Lab.
+    /// </summary>
+    ANSI_COLOR_16 = 2
+} AnsiColorMode;
+
+/// <summary>
+/// Buffer size that fits any sequence from AnsiSgrColor plus the terminating null.
+/// </summary>
+#define CHIZL_SGR_SIZE 20
+
+/// <summary>
+/// Writes the SGR sequence that sets a color, for output that is not sent through SetFgColor or an AnsiBuffer.
+/// Built from a precomputed decimal table, no printf.
+/// </summary>
+/// <param name="clr">Color to set, alpha is ignored.</param>
+/// <param name="background">Non-zero for the background color, zero for the foreground (text) color.</param>
+/// <param name="mode">Color depth, lower depths use the nearest color the terminal has.</param>
+/// <param name="buffer">Receives the null terminated sequence.</param>
+/// <param name="bufferSize">Size of buffer in chars, CHIZL_SGR_SIZE always fits.</param>
+/// <returns>The sequence length, 0 if buffer is NULL, too small or mode is unknown.</returns>
+CHIZL_COLORS_API size_t AnsiSgrColor(RgbColor clr, unsigned int background, AnsiColorMode mode, char* buffer, size_t bufferSize);
+
+/// <summary>
+/// Nearest xterm 256 color palette entry, searched in Lab over the cube and gray ramp (16 - 255).
+/// </summary>
+/// <param name="clr">Color to match, alpha is ignored.</param>
+/// <returns>Palette index, 16 to 255.</returns>
+CHIZL_COLORS_API unsigned char AnsiNearest256(RgbColor clr);
+
+/// <summary>
+/// Nearest of the 16 system colors (xterm defaults), searched in Lab.
+/// </summary>
+/// <param name="clr">Color to match, alpha is ignored.</param>
+/// <returns>Color index, 0 to 15 (8 - 15 are the bright colors).</returns>
+CHIZL_COLORS_API unsigned char AnsiNearest16(RgbColor clr);
+
+/// <summary>
+/// The RGB value of an xterm 256 color palette entry (0 - 15 use the xterm default system colors).
+/// </summary>
+/// <param name="index">Palette index.</param>
+/// <returns>The color, alpha 255.</returns>
+CHIZL_COLORS_API RgbColor Ansi256ToRgb(unsigned char index);
+
+// --- End of "extern C" block ---
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -0,0 +1,31 @@
+// ansi_sgr_core.h
+#pragma once
+
+#ifndef ANSI_SGR_CORE_H
+#define ANSI_SGR_CORE_H
+
+// Internal only, not part of the public API.
+// SGR building blocks shared by ansi_printing.c and ansi_buffer.c.  A color is first reduced to a key
+// for the active mode (the color itself, or its palette index), so callers can compare keys to skip
+// repeated changes and only pay for the nearest color search once per change.
+
+#include "ansi_sgr.h"
+#include <stdint.h>             // For uint32_t
+
+// Longest parameter list from AnsiSgrAppendKey: "38;2;255;255;255" (16 chars).
+#define ANSI_SGR_PARAMS_MAX 16
+
+/// <summary>
+/// Key of a color in a mode: mode in bits 24 - 25, then 0xRRGGBB (24-bit) or the palette index.
+/// Two colors with the same key produce the same sequence.
+/// </summary>
+uint32_t AnsiColorKey(RgbColor clr, AnsiColorMode mode);
+
+/// <summary>
+/// Appends the SGR parameters for a key, without the "\x1b[" prefix or 'm' ("38;2;R;G;B", "48;5;N", "97", ...),
+/// so a foreground and background can share one sequence.  Returns the end of what was written.<br/>
+/// Writes up to ANSI_SGR_PARAMS_MAX chars but may touch 2 more (fixed size number copies), 'p' needs that room.
+/// </summary>
+char* AnsiSgrAppendKey(char* p, uint32_t key, int background);
+
+#endif
@@ -0,0 +1,54 @@
+// chizl_atomic.h
+#pragma once
+
+#ifndef CHIZL_ATOMIC_H
+#define CHIZL_ATOMIC_H
+
+// Internal only, not part of the public API.
+// Minimal atomic counter for jobs whose chunks wait on each other's progress (wavefront dithering).
+// Interlocked functions on Windows, GCC / Clang __atomic builtins everywhere else.
+
+#if defined(_WIN32) || defined(_WIN64)
+  #ifndef WIN32_LEAN_AND_MEAN
+    #define WIN32_LEAN_AND_MEAN
+  #endif
+  #include <windows.h>          // For InterlockedExchange, InterlockedCompareExchange, SwitchToThread
+
+  typedef volatile LONG ChizlAtomic;
+
+  /// <summary>
+  /// Reads the counter.  Writes made before the matching ChizlAtomicStore are visible after it.
+  /// </summary>
+  static inline long ChizlAtomicLoad(ChizlAtomic* a) { return InterlockedCompareExchange(a, 0, 0); }
+
+  /// <summary>
+  /// Sets the counter, publishing every write made before it.
+  /// </summary>
+  static inline void ChizlAtomicStore(ChizlAtomic* a, long v) { InterlockedExchange(a, v); }
+
+  /// <summary>
+  /// Gives the rest of the time slice to another ready thread while spinning.
+  /// </summary>
+  static inline void ChizlYield(void) { SwitchToThread(); }
+#else
+  #include <sched.h>            // For sched_yield
+
+  typedef volatile long ChizlAtomic;
+
+  /// <summary>
+  /// Reads the counter.  Writes made before the matching ChizlAtomicStore are visible after it.
+  /// </summary>
+  static inline long ChizlAtomicLoad(ChizlAtomic* a) { return __atomic_load_n(a, __ATOMIC_ACQUIRE); }
+
+  /// <summary>
+  /// Sets the counter, publishing every write made before it.
+  /// </summary>
+  static inline void ChizlAtomicStore(ChizlAtomic* a, long v) { __atomic_store_n(a, v, __ATOMIC_RELEASE); }
+
+  /// <summary>
+  /// Gives the rest of the time slice to another ready thread while spinning.
+  /// </summary>
+  static inline void ChizlYield(void) { sched_yield(); }
+#endif
+
+#endif
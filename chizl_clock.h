@@ -0,0 +1,37 @@
+// chizl_clock.h
+#pragma once
+
+#ifndef CHIZL_CLOCK_H
+#define CHIZL_CLOCK_H
+
+// Internal only, not part of the public API.
+// Monotonic millisecond clock for the timings the library reports (cache build time, frame time).
+// Uses QueryPerformanceCounter on Windows and clock_gettime(CLOCK_MONOTONIC) everywhere else.
+
+#if defined(_WIN32) || defined(_WIN64)
+  #ifndef WIN32_LEAN_AND_MEAN
+    #define WIN32_LEAN_AND_MEAN
+  #endif
+  #include <windows.h>          // For QueryPerformanceCounter, QueryPerformanceFrequency
+#else
+  #include <time.h>             // For clock_gettime
+#endif
+
+/// <summary>
+/// Milliseconds from an arbitrary fixed start, only differences between two calls are meaningful.
+/// </summary>
+static inline double ChizlNowMs(void)
+{
+#if defined(_WIN32) || defined(_WIN64)
+    LARGE_INTEGER freq, now;
+    QueryPerformanceFrequency(&freq);
+    QueryPerformanceCounter(&now);
+    return (double)now.QuadPart * 1000.0 / (double)freq.QuadPart;
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1000.0 + (double)ts.tv_nsec / 1.0e6;
+#endif
+}
+
+#endif
@@ -237,4 +237,153 @@ typedef struct {
     double h;
 } LchSpace;
 
+/// <summary>
+/// OKLab (Bjrn Ottosson, 2020) is a perceptual color space built straight on linear sRGB: one matrix to cone (LMS)
+/// response, a cube root, and a second matrix.  It predicts perceived lightness, chroma and hue more evenly than CIE Lab
+/// (blues keep their hue as they get lighter) and is the space CSS Color 4 uses for oklab() / oklch() and gamut mapping.
+/// No white point parameter, D65 is built into the matrices.
+/// </summary>
+typedef struct {
+    /// <summary>
+    /// 'L' (Lightness): 0.0 (black) to 1.0 (white).  Note the scale, CIE L* runs 0 to 100.
+    /// </summary>
+    double l;
+    /// <summary>
+    /// 'A' (GreenRed axis): negative toward green, positive toward red.  About -0.24 to 0.28 for sRGB colors.
+    /// </summary>
+    double a;
+    /// <summary>
+    /// 'B' (BlueYellow axis): negative toward blue, positive toward yellow.  About -0.31 to 0.20 for sRGB colors.
+    /// </summary>
+    double b;
+} OkLabSpace;
+
+/// <summary>
+/// OKLCh is the cylindrical form of OKLab, the same relation LchSpace has to LabSpace.  Changing only 'h' keeps
+/// perceived lightness and colorfulness, which makes it the space for hue rotation and palette generation.
+/// </summary>
+typedef struct {
+    /// <summary>
+    /// 'L' (Lightness): 0.0 (black) to 1.0 (white), the same value as OkLabSpace.l.
+    /// </summary>
+    double l;
+    /// <summary>
+    /// 'C' (Chroma): distance from the neutral axis, 0.0 for grays, up to about 0.32 (sRGB blue).
+    /// </summary>
+    double c;
+    /// <summary>
+    /// 'H' (Hue): angle from 0 to 360 degrees, 0 for grays.  Red is near 29, yellow near 110, green near 142 and blue near 264.
+    /// </summary>
+    double h;
+} OkLchSpace;
+
+// --- Single precision (float) variants ---
+// Same fields and ranges as the double structs above, at half the size (HsvSpaceF is 16 bytes instead
+// of 32, LabSpaceF 12 instead of 24).  Meant for large buffers where memory bandwidth is the limit.
+// The conversions still do their math in double and round the result to float once, so each field is
+// within half a float ULP of the double version (about 6e-8 relative: hue within 0.00002 degrees,
+// L* / a* / b* / u* / v* within 0.00001).  Every 24-bit color survives RGB -> float space -> RGB unchanged.
+
+/// <summary>
+/// Float version of CmykSpace.
+/// </summary>
+typedef struct {
+    float cyan;
+    float magenta;
+    float yellow;
+    float key;
+    float raw_key;
+} CmykSpaceF;
+
+/// <summary>
+/// Float version of HsvSpace.
+/// </summary>
+typedef struct {
+    float hue;
+    float saturation;
+    float value;
+    float raw_value;
+} HsvSpaceF;
+
+/// <summary>
+/// Float version of HslSpace.
+/// </summary>
+typedef struct {
+    float hue;
+    float saturation;
+    float lightness;
+    float raw_lightness;
+} HslSpaceF;
+
+/// <summary>
+/// Float version of XyzSpace.
+/// </summary>
+typedef struct {
+    float x;
+    float y;
+    float z;
+} XyzSpaceF;
+
+/// <summary>
+/// Float version of LabSpace.
+/// </summary>
+typedef struct {
+    float l;
+    float a;
+    float b;
+} LabSpaceF;
+
+/// <summary>
+/// Float version of LuvSpace.
+/// </summary>
+typedef struct {
+    float l;
+    float u;
+    float v;
+} LuvSpaceF;
+
+/// <summary>
+/// Float version of LchSpace.
+/// </summary>
+typedef struct {
+    float l;
+    float c;
+    float h;
+} LchSpaceF;
+
+// --- 16-bit fixed point variants ---
+// Integer versions of HSV, HSL and CMYK for 8-bit pipelines and targets without an FPU.  Every field is
+// 0 - 65535: hue 0 - 65535 covers 0 - 360 (65536 would wrap to 0), the percentages map 0 - 100% onto
+// 0 - 65535.  Shift right by 8 for an 8-bit value.  The conversions use integer math only and every field
+// is the exact double result rounded to the nearest step (within 0.5 step: 0.0028 of hue, 0.00077% of a
+// percentage).  Every 24-bit color survives RGB -> fixed point space -> RGB unchanged.
+
+/// <summary>
+/// 16-bit fixed point version of HsvSpace.
+/// </summary>
+typedef struct {
+    unsigned short hue;
+    unsigned short saturation;
+    unsigned short value;
+} HsvSpaceU16;
+
+/// <summary>
+/// 16-bit fixed point version of HslSpace.
+/// </summary>
+typedef struct {
+    unsigned short hue;
+    unsigned short saturation;
+    unsigned short lightness;
+} HslSpaceU16;
+
+/// <summary>
+/// 16-bit fixed point version of CmykSpace.
+/// </summary>
+typedef struct {
+    unsigned short cyan;
+    unsigned short magenta;
+    unsigned short yellow;
+    unsigned short key;
+} CmykSpaceU16;
+
 #endif // CHIZL_COLORS_TYPES_H
\ No newline at end of file
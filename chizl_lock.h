@@ -0,0 +1,34 @@
+// chizl_lock.h
+#pragma once
+
+#ifndef CHIZL_LOCK_H
+#define CHIZL_LOCK_H
+
+// Internal only, not part of the public API.
+// Statically initialized mutex for the library's shared state (worker pool, white point registry,
+// adaptation cache).  SRWLOCK on Windows, pthread mutex everywhere else, no init or destroy calls needed.
+
+#if defined(_WIN32) || defined(_WIN64)
+  #ifndef WIN32_LEAN_AND_MEAN
+    #define WIN32_LEAN_AND_MEAN
+  #endif
+  #include <windows.h>          // For SRWLOCK
+
+  typedef SRWLOCK ChizlMutex;
+  #define CHIZL_MUTEX_INIT SRWLOCK_INIT
+
+  static inline void ChizlLock(ChizlMutex* m) { AcquireSRWLockExclusive(m); }
+  static inline int ChizlTryLock(ChizlMutex* m) { return TryAcquireSRWLockExclusive(m) != 0; }
+  static inline void ChizlUnlock(ChizlMutex* m) { ReleaseSRWLockExclusive(m); }
+#else
+  #include <pthread.h>          // For pthread_mutex_t
+
+  typedef pthread_mutex_t ChizlMutex;
+  #define CHIZL_MUTEX_INIT PTHREAD_MUTEX_INITIALIZER
+
+  static inline void ChizlLock(ChizlMutex* m) { pthread_mutex_lock(m); }
+  static inline int ChizlTryLock(ChizlMutex* m) { return pthread_mutex_trylock(m) == 0; }
+  static inline void ChizlUnlock(ChizlMutex* m) { pthread_mutex_unlock(m); }
+#endif
+
+#endif
@@ -0,0 +1,49 @@
+// chizl_once.h
+#pragma once
+
+#ifndef CHIZL_ONCE_H
+#define CHIZL_ONCE_H
+
+// Internal only, not part of the public API.
+// Thread safe one time initialization for the library's lazily built lookup tables.
+// Uses InitOnceExecuteOnce on Windows and pthread_once everywhere else.
+
+#if defined(_WIN32) || defined(_WIN64)
+  #ifndef WIN32_LEAN_AND_MEAN
+    #define WIN32_LEAN_AND_MEAN
+  #endif
+  #include <windows.h>          // For INIT_ONCE, InitOnceExecuteOnce
+
+  typedef INIT_ONCE ChizlOnce;
+  #define CHIZL_ONCE_INIT INIT_ONCE_STATIC_INIT
+
+  static BOOL CALLBACK ChizlOnce_Invoke(PINIT_ONCE once, PVOID param, PVOID* ctx)
+  {
+      (void)once; (void)ctx;
+      ((void (*)(void))param)();
+      return TRUE;
+  }
+
+  /// <summary>
+  /// Runs 'init' exactly once for the given once flag, all other callers block until it has finished.
+  /// </summary>
+  static inline void ChizlRunOnce(ChizlOnce* once, void (*init)(void))
+  {
+      InitOnceExecuteOnce(once, ChizlOnce_Invoke, (PVOID)init, NULL);
+  }
+#else
+  #include <pthread.h>          // For pthread_once
+
+  typedef pthread_once_t ChizlOnce;
+  #define CHIZL_ONCE_INIT PTHREAD_ONCE_INIT
+
+  /// <summary>
+  /// Runs 'init' exactly once for the given once flag, all other callers block until it has finished.
+  /// </summary>
+  static inline void ChizlRunOnce(ChizlOnce* once, void (*init)(void))
+  {
+      pthread_once(once, init);
+  }
+#endif
+
+#endif
@@ -0,0 +1,287 @@
+// chromatic_adaptation.c
+#include "chromatic_adaptation.h"
+#include "white_points_core.h"  // For WhitePointLookup, WhitePointInfoFromType
+#include "cie_common.h"         // For RgbToXyz_Core, XyzToRgb_Core, XyzToLab_White, LabToXyz_White
+#include "common.h"             // For isPackedStride, stridedAt
+#include "chizl_once.h"
+#include "chizl_lock.h"
+
+// Von Kries style adaptation: XYZ goes into a cone response space, each cone is scaled by the ratio
+// of the two whites' responses, and comes back out.  The three steps fold into one 3x3 matrix,
+//   A = M^-1 * diag(dst / src) * M
+// which only depends on (source, destination, transform).  Every built in pair is worked out once into a
+// read only table, so a conversion costs a lookup and 9 multiply-adds with no lock.  Pairs that involve a
+// registered (custom) white point go through a small direct mapped cache under a lock instead.
+
+#define CAT_COUNT 4
+#define CAT_CACHE_SIZE 64       // Power of 2
+
+typedef struct {
+    int used;
+    WhitePointType source;
+    WhitePointType destination;
+    ChromaticAdaptationType cat;
+    double m[9];
+} CatCacheEntry;
+
+// Cone response matrices (XYZ to LMS), row major, in ChromaticAdaptationType order.
+static const double s_cone[CAT_COUNT][9] = {
+    {  0.8951,  0.2664, -0.1614,            // Bradford
+      -0.7502,  1.7135,  0.0367,
+       0.0389, -0.0685,  1.0296 },
+    {  0.7328,  0.4296, -0.1624,            // CAT02
+      -0.7036,  1.6975,  0.0061,
+       0.0030,  0.0136,  0.9834 },
+    {  0.40024, 0.70760, -0.08081,          // Von Kries (Hunt-Pointer-Estevez)
+      -0.22630, 1.16532,  0.04570,
+       0.0,     0.0,      0.91822 },
+    {  1.0, 0.0, 0.0,                       // XYZ scaling
+       0.0, 1.0, 0.0,
+       0.0, 0.0, 1.0 }
+};
+
+static double s_coneInverse[CAT_COUNT][9];
+static ChizlOnce s_inverseOnce = CHIZL_ONCE_INIT;
+
+static double s_builtin[WPID_BUILTIN_COUNT][WPID_BUILTIN_COUNT][CAT_COUNT][9];
+static ChizlOnce s_builtinOnce = CHIZL_ONCE_INIT;
+
+static CatCacheEntry s_cache[CAT_CACHE_SIZE];
+static ChizlMutex s_cacheLock = CHIZL_MUTEX_INIT;
+
+static void Invert3x3(const double* m, double* inv)
+{
+    const double c0 = m[4] * m[8] - m[5] * m[7];
+    const double c1 = m[5] * m[6] - m[3] * m[8];
+    const double c2 = m[3] * m[7] - m[4] * m[6];
+    const double invDet = 1.0 / (m[0] * c0 + m[1] * c1 + m[2] * c2);
+
+    inv[0] = c0 * invDet;
+    inv[1] = (m[2] * m[7] - m[1] * m[8]) * invDet;
+    inv[2] = (m[1] * m[5] - m[2] * m[4]) * invDet;
+    inv[3] = c1 * invDet;
+    inv[4] = (m[0] * m[8] - m[2] * m[6]) * invDet;
+    inv[5] = (m[2] * m[3] - m[0] * m[5]) * invDet;
+    inv[6] = c2 * invDet;
+    inv[7] = (m[1] * m[6] - m[0] * m[7]) * invDet;
+    inv[8] = (m[0] * m[4] - m[1] * m[3]) * invDet;
+}
+
+static void BuildConeInverses(void)
+{
+    for (int i = 0; i < CAT_COUNT; i++)
+        Invert3x3(s_cone[i], s_coneInverse[i]);
+}
+
+static inline XyzSpace Apply3x3(const double* m, XyzSpace xyz)
+{
+    XyzSpace out = {
+        m[0] * xyz.x + m[1] * xyz.y + m[2] * xyz.z,
+        m[3] * xyz.x + m[4] * xyz.y + m[5] * xyz.z,
+        m[6] * xyz.x + m[7] * xyz.y + m[8] * xyz.z
+    };
+    return out;
+}
+
+static void BuildAdaptMatrix(WhitePoint src, WhitePoint dst, ChromaticAdaptationType cat, double* out)
+{
+    ChizlRunOnce(&s_inverseOnce, BuildConeInverses);
+
+    const double* m = s_cone[cat];
+    const double* inv = s_coneInverse[cat];
+    const XyzSpace srcXyz = { src.x, src.y, src.z };
+    const XyzSpace dstXyz = { dst.x, dst.y, dst.z };
+    const XyzSpace srcCone = Apply3x3(m, srcXyz);
+    const XyzSpace dstCone = Apply3x3(m, dstXyz);
+    const double scale[3] = { dstCone.x / srcCone.x, dstCone.y / srcCone.y, dstCone.z / srcCone.z };
+
+    // out = inv * diag(scale) * m
+    for (int r = 0; r < 3; r++)
+    {
+        for (int c = 0; c < 3; c++)
+        {
+            double sum = 0.0;
+            for (int k = 0; k < 3; k++)
+                sum += inv[r * 3 + k] * scale[k] * m[k * 3 + c];
+            out[r * 3 + c] = sum;
+        }
+    }
+}
+
+static void BuildBuiltinMatrices(void)
+{
+    for (int s = 0; s < WPID_BUILTIN_COUNT; s++)
+    {
+        const WhitePoint src = WhitePointInfoFromType((WhitePointType)s).wp;
+        for (int d = 0; d < WPID_BUILTIN_COUNT; d++)
+        {
+            const WhitePoint dst = WhitePointInfoFromType((WhitePointType)d).wp;
+            for (int c = 0; c < CAT_COUNT; c++)
+                BuildAdaptMatrix(src, dst, (ChromaticAdaptationType)c, s_builtin[s][d][c]);
+        }
+    }
+}
+
+static inline size_t CacheSlot(WhitePointType source, WhitePointType destination, ChromaticAdaptationType cat)
+{
+    const unsigned h = (unsigned)source * 31u + (unsigned)destination * 7u + (unsigned)cat * 131u;
+    return (size_t)(h & (CAT_CACHE_SIZE - 1));
+}
+
+/// <summary>
+/// Adaptation matrix for (source, destination, cat).  Returns 0 for unknown ids or cat.
+/// </summary>
+static int GetAdaptMatrix(WhitePointType source, WhitePointType destination, ChromaticAdaptationType cat, double* out)
+{
+    if ((int)cat < 0 || (int)cat >= CAT_COUNT)
+        return 0;
+
+    if ((unsigned)source < WPID_BUILTIN_COUNT && (unsigned)destination < WPID_BUILTIN_COUNT)
+    {
+        ChizlRunOnce(&s_builtinOnce, BuildBuiltinMatrices);
+
+        const double* m = s_builtin[source][destination][cat];
+        for (int i = 0; i < 9; i++)
+            out[i] = m[i];
+        return 1;
+    }
+
+    const size_t slot = CacheSlot(source, destination, cat);
+    CatCacheEntry* e = &s_cache[slot];
+
+    ChizlLock(&s_cacheLock);
+    if (e->used && e->source == source && e->destination == destination && e->cat == cat)
+    {
+        for (int i = 0; i < 9; i++)
+            out[i] = e->m[i];
+        ChizlUnlock(&s_cacheLock);
+        return 1;
+    }
+    ChizlUnlock(&s_cacheLock);
+
+    // Miss: build outside the lock (registered white points never change, so a racing build gives the same matrix).
+    WhitePointInfo src, dst;
+    if (!WhitePointLookup(source, &src) || !WhitePointLookup(destination, &dst))
+        return 0;
+    BuildAdaptMatrix(src.wp, dst.wp, cat, out);
+
+    ChizlLock(&s_cacheLock);
+    e->used = 1;
+    e->source = source;
+    e->destination = destination;
+    e->cat = cat;
+    for (int i = 0; i < 9; i++)
+        e->m[i] = out[i];
+    ChizlUnlock(&s_cacheLock);
+    return 1;
+}
+
+/// <summary>
+/// White point and sRGB (D65) adaptation matrix for the Lab Ex conversions.  Returns 0 when no adaptation
+/// is needed: D65 targets (the sRGB white) and unknown ids, which fall back to WP_D65 like XyzToLabEx.
+/// </summary>
+static int LabTarget(WhitePointType wp, ChromaticAdaptationType cat, int toRgb, WhitePoint* white, double* m)
+{
+    *white = WhitePointInfoFromType(wp).wp;
+    if (wp == WPID_D65 || wp == WPID_D65_FULL)
+        return 0;
+    if ((int)cat < 0 || (int)cat >= CAT_COUNT)
+        cat = CAT_BRADFORD;
+
+    return toRgb ? GetAdaptMatrix(wp, WPID_D65, cat, m) : GetAdaptMatrix(WPID_D65, wp, cat, m);
+}
+
+CHIZL_COLORS_API int ChromaticAdaptationMatrix(WhitePointType source, WhitePointType destination, ChromaticAdaptationType cat, double matrix[9])
+{
+    return matrix != NULL && GetAdaptMatrix(source, destination, cat, matrix);
+}
+
+CHIZL_COLORS_API XyzSpace XyzAdapt(XyzSpace xyz, WhitePointType source, WhitePointType destination, ChromaticAdaptationType cat)
+{
+    double m[9];
+    return GetAdaptMatrix(source, destination, cat, m) ? Apply3x3(m, xyz) : xyz;
+}
+
+CHIZL_COLORS_API size_t XyzAdaptBatch(const XyzSpace* xyz, XyzSpace* out, size_t count, size_t stride, WhitePointType source, WhitePointType destination, ChromaticAdaptationType cat)
+{
+    double m[9];
+    if (xyz == NULL || out == NULL || !GetAdaptMatrix(source, destination, cat, m))
+        return 0;
+
+    if (isPackedStride(stride, sizeof(XyzSpace)))
+    {
+        for (size_t i = 0; i < count; i++)
+            out[i] = Apply3x3(m, xyz[i]);
+    }
+    else
+    {
+        for (size_t i = 0; i < count; i++)
+            *(XyzSpace*)stridedAt(out, i, stride, sizeof(XyzSpace)) = Apply3x3(m, xyz[i]);
+    }
+
+    return count;
+}
+
+CHIZL_COLORS_API LabSpace RgbToLabEx(RgbColor rgb, WhitePointType wp, ChromaticAdaptationType cat)
+{
+    WhitePoint white;
+    double m[9];
+    XyzSpace xyz = RgbToXyz_Core(rgb, SrgbLinearTable());
+    if (LabTarget(wp, cat, 0, &white, m))
+        xyz = Apply3x3(m, xyz);
+    return XyzToLab_White(xyz, white);
+}
+
+CHIZL_COLORS_API RgbColor LabToRgbEx(LabSpace lab, WhitePointType wp, ChromaticAdaptationType cat)
+{
+    WhitePoint white;
+    double m[9];
+    XyzSpace xyz;
+    if (LabTarget(wp, cat, 1, &white, m))
+        xyz = Apply3x3(m, LabToXyz_White(lab, white));
+    else
+        xyz = LabToXyz_White(lab, white);
+    return XyzToRgb_Core(xyz);
+}
+
+CHIZL_COLORS_API size_t RgbToLabExBatch(const RgbColor* rgb, LabSpace* lab, size_t count, size_t stride, WhitePointType wp, ChromaticAdaptationType cat)
+{
+    if (rgb == NULL || lab == NULL)
+        return 0;
+
+    // Matrix looked up once for the whole array.
+    WhitePoint white;
+    double m[9];
+    const int adapt = LabTarget(wp, cat, 0, &white, m);
+    const double* linear = SrgbLinearTable();
+
+    for (size_t i = 0; i < count; i++)
+    {
+        XyzSpace xyz = RgbToXyz_Core(rgb[i], linear);
+        if (adapt)
+            xyz = Apply3x3(m, xyz);
+        *(LabSpace*)stridedAt(lab, i, stride, sizeof(LabSpace)) = XyzToLab_White(xyz, white);
+    }
+
+    return count;
+}
+
+CHIZL_COLORS_API size_t LabToRgbExBatch(const LabSpace* lab, RgbColor* rgb, size_t count, size_t stride, WhitePointType wp, ChromaticAdaptationType cat)
+{
+    if (lab == NULL || rgb == NULL)
+        return 0;
+
+    WhitePoint white;
+    double m[9];
+    const int adapt = LabTarget(wp, cat, 1, &white, m);
+
+    for (size_t i = 0; i < count; i++)
+    {
+        XyzSpace xyz = LabToXyz_White(lab[i], white);
+        if (adapt)
+            xyz = Apply3x3(m, xyz);
+        *(RgbColor*)stridedAt(rgb, i, stride, sizeof(RgbColor)) = XyzToRgb_Core(xyz);
+    }
+
+    return count;
+}
@@ -0,0 +1,111 @@
+// chromatic_adaptation.h
+
+#pragma once
+
+#ifndef CHROMATIC_ADAPTATION_H
+#define CHROMATIC_ADAPTATION_H
+
+// --- Start of "extern C" block ---
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "import_exports.h"
+#include "chizl_colors_types.h"
+#include "white_points.h"       // For WhitePointType
+#include <stddef.h>             // For size_t
+
+/// <summary>
+/// Chromatic adaptation transform (the cone response space the white points are balanced in).
+/// </summary>
+typedef enum {
+    CAT_BRADFORD = 0,           // ICC / print default
+    CAT_CAT02 = 1,              // CIECAM02
+    CAT_VON_KRIES = 2,          // Hunt-Pointer-Estevez cones
+    CAT_XYZ_SCALING = 3         // Plain per channel XYZ scale, for comparison only
+} ChromaticAdaptationType;
+
+/// <summary>
+/// Gets the 3x3 matrix that adapts XYZ seen under one white point to how it appears under another.
+/// Matrices are built once per (source, destination, transform) and cached, so calling this per color is cheap.
+/// </summary>
+/// <param name="source">White point the colors were measured under.</param>
+/// <param name="destination">White point to adapt to.</param>
+/// <param name="cat">Adaptation transform.</param>
+/// <param name="matrix">Receives the matrix, row major (9 values).  XYZ' = matrix * XYZ.</param>
+/// <returns>1 on success, 0 if matrix is NULL, a white point id is unknown or cat is unknown.</returns>
+CHIZL_COLORS_API int ChromaticAdaptationMatrix(WhitePointType source, WhitePointType destination, ChromaticAdaptationType cat, double matrix[9]);
+
+/// <summary>
+/// Adapts an XYZ color (0 - 100 scale) from one white point to another.
+/// </summary>
+/// <param name="xyz">The color to adapt.</param>
+/// <param name="source">White point the color was measured under.</param>
+/// <param name="destination">White point to adapt to.</param>
+/// <param name="cat">Adaptation transform.</param>
+/// <returns>The adapted color, or xyz unchanged if a white point or cat is unknown.</returns>
+CHIZL_COLORS_API XyzSpace XyzAdapt(XyzSpace xyz, WhitePointType source, WhitePointType destination, ChromaticAdaptationType cat);
+
+/// <summary>
+/// Adapts an array of XYZ colors from one white point to another, looking the matrix up once for the whole array.
+/// </summary>
+/// <param name="xyz">Pointer to the first color to adapt.</param>
+/// <param name="out">Pointer to the first XyzSpace to write, may be the same array as xyz.</param>
+/// <param name="count">Number of colors to adapt.</param>
+/// <param name="stride">Distance in bytes between output elements, 0 for a tightly packed array.</param>
+/// <param name="source">White point the colors were measured under.</param>
+/// <param name="destination">White point to adapt to.</param>
+/// <param name="cat">Adaptation transform.</param>
+/// <returns>The number of colors adapted, 0 if a pointer is NULL, a white point or cat is unknown.</returns>
+CHIZL_COLORS_API size_t XyzAdaptBatch(const XyzSpace* xyz, XyzSpace* out, size_t count, size_t stride, WhitePointType source, WhitePointType destination, ChromaticAdaptationType cat);
+
+/// <summary>
+/// Converts an RGB color to Lab relative to another white point, e.g. WPID_D50 for print and ICC workflows.
+/// The sRGB (D65) XYZ is adapted to the white point first, so white stays at L* 100, a* b* 0.<br/>
+/// WPID_D65 and WPID_D65_FULL need no adaptation and give the same values as XyzToLabEx.
+/// Unknown ids fall back to WP_D65, as XyzToLabEx does, and an unknown cat to CAT_BRADFORD.
+/// </summary>
+/// <param name="rgb">The RGB color to convert.</param>
+/// <param name="wp">White point of the Lab values.</param>
+/// <param name="cat">Adaptation transform.</param>
+/// <returns>The color in Lab relative to wp.</returns>
+CHIZL_COLORS_API LabSpace RgbToLabEx(RgbColor rgb, WhitePointType wp, ChromaticAdaptationType cat);
+
+/// <summary>
+/// Converts Lab relative to a white point back to RGB, the inverse of RgbToLabEx.  Out of gamut values are clamped.
+/// </summary>
+/// <param name="lab">The Lab color to convert.</param>
+/// <param name="wp">White point of the Lab values.</param>
+/// <param name="cat">Adaptation transform.</param>
+/// <returns>The RGB color.</returns>
+CHIZL_COLORS_API RgbColor LabToRgbEx(LabSpace lab, WhitePointType wp, ChromaticAdaptationType cat);
+
+/// <summary>
+/// Converts an array of RGB colors to Lab relative to a white point, see RgbToLabEx.
+/// </summary>
+/// <param name="rgb">Pointer to the first RGB color to convert.</param>
+/// <param name="lab">Pointer to the first LabSpace to write.</param>
+/// <param name="count">Number of colors to convert.</param>
+/// <param name="stride">Distance in bytes between output elements, 0 for a tightly packed array.</param>
+/// <param name="wp">White point of the Lab values.</param>
+/// <param name="cat">Adaptation transform.</param>
+/// <returns>The number of colors converted, 0 if either pointer is NULL.</returns>
+CHIZL_COLORS_API size_t RgbToLabExBatch(const RgbColor* rgb, LabSpace* lab, size_t count, size_t stride, WhitePointType wp, ChromaticAdaptationType cat);
+
+/// <summary>
+/// Converts an array of Lab colors relative to a white point back to RGB, see LabToRgbEx.
+/// </summary>
+/// <param name="lab">Pointer to the first Lab color to convert.</param>
+/// <param name="rgb">Pointer to the first RgbColor to write.</param>
+/// <param name="count">Number of colors to convert.</param>
+/// <param name="stride">Distance in bytes between output elements, 0 for a tightly packed array.</param>
+/// <param name="wp">White point of the Lab values.</param>
+/// <param name="cat">Adaptation transform.</param>
+/// <returns>The number of colors converted, 0 if either pointer is NULL.</returns>
+CHIZL_COLORS_API size_t LabToRgbExBatch(const LabSpace* lab, RgbColor* rgb, size_t count, size_t stride, WhitePointType wp, ChromaticAdaptationType cat);
+
+// --- End of "extern C" block ---
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -0,0 +1,262 @@
+// cie_common.h
+#pragma once
+
+#ifndef CIE_COMMON_H
+#define CIE_COMMON_H
+
+// Internal only, not part of the public API.
+// Shared inline math for the CIE spaces (XYZ, Lab, Luv, Lch).  Kept in a header so
+// the batch loops in xyz_space.c, luv_space.c and lch_space.c can inline the full
+// RGB -> XYZ -> ... chain instead of paying for an exported call per color.
+
+#include "chizl_colors_types.h"
+#include "white_points.h"
+#include "common.h"             // For CHIZL_PI, CHIZL_LCH_CHROMA_EPS, clampDbl
+#include "srgb_linear.h"        // For SrgbLinearTable, LinearToSrgb
+#include <math.h>               // For pow, cbrt, sqrt, atan2, fmod, cos, sin, lround
+
+/// <summary>
+/// Linear sRGB (0.0-1.0) to XYZ (0-100 scale).
+/// </summary>
+static inline XyzSpace LinearRgbToXyz_Core(double r, double g, double b)
+{
+    // Convert linear RGB to XYZ using sRGB-specific transformation matrix
+    // These coefficients are for sRGB with D65 illuminant
+    double x = r * 0.4124564 + g * 0.3575761 + b * 0.1804375;
+    double y = r * 0.2126729 + g * 0.7151522 + b * 0.0721750;
+    double z = r * 0.0193339 + g * 0.1191920 + b * 0.9503041;
+
+    // Scale XYZ to 0-100 range for consistency with common representations
+    // If Y is expected to be 100 for white, then X and Z should be scaled accordingly.
+    // The coefficients already produce values in a range where Y for white is ~1.0,
+    // so multiplying by 100 makes Y for white = 100.
+    XyzSpace xyz = {
+        x * 100.0,
+        y * 100.0,
+        z * 100.0
+    };
+    return xyz;
+}
+
+/// <summary>
+/// RGB to XYZ using the sRGB linearization table from SrgbLinearTable().  Callers converting
+/// many colors fetch the table once and pass it in.
+/// </summary>
+static inline XyzSpace RgbToXyz_Core(RgbColor rgb, const double* linear)
+{
+    // sRGB to linear RGB (0.0-1.0), table holds the gamma expanded value of every 8-bit channel.
+    return LinearRgbToXyz_Core(linear[rgb.red], linear[rgb.green], linear[rgb.blue]);
+}
+
+/// <summary>
+/// XYZ (0-100 scale) to linear sRGB, unclamped.  Components outside 0.0-1.0 mean the color is out of the sRGB gamut.
+/// </summary>
+static inline void XyzToLinearRgb_Core(XyzSpace xyz, double* r, double* g, double* b)
+{
+    const double x = xyz.x / 100.0;
+    const double y = xyz.y / 100.0;
+    const double z = xyz.z / 100.0;
+
+    // Inverse of the sRGB (D65) matrix in LinearRgbToXyz_Core.
+    *r = x * 3.2404548360 + y * -1.5371388501 + z * -0.4985315469;
+    *g = x * -0.9692663899 + y * 1.8760109288 + z * 0.0415560823;
+    *b = x * 0.0556434196 + y * -0.2040258543 + z * 1.0572251625;
+}
+
+/// <summary>
+/// Linear sRGB to 8-bit RGB, components clamped to 0.0-1.0 first.
+/// </summary>
+static inline RgbColor LinearRgbToRgb_Core(double r, double g, double b)
+{
+    // Linear RGB to sRGB, clamped to the displayable range.
+    r = LinearToSrgb(clampDbl(r, 0.0, 1.0));
+    g = LinearToSrgb(clampDbl(g, 0.0, 1.0));
+    b = LinearToSrgb(clampDbl(b, 0.0, 1.0));
+
+    RgbColor rgb = {
+        255,
+        (unsigned char)lround(r * 255.0),
+        (unsigned char)lround(g * 255.0),
+        (unsigned char)lround(b * 255.0)
+    };
+    return rgb;
+}
+
+/// <summary>
+/// XYZ (0-100 scale) back to RGB.  Uses the exact inverse of the RgbToXyz_Core matrix so a
+/// RGB -> XYZ -> RGB round trip returns the original channels.  Out of gamut values are clamped.
+/// </summary>
+static inline RgbColor XyzToRgb_Core(XyzSpace xyz)
+{
+    double r, g, b;
+    XyzToLinearRgb_Core(xyz, &r, &g, &b);
+    return LinearRgbToRgb_Core(r, g, b);
+}
+
+static inline double lab_f(double t)
+{
+    if (t < 0.0) t = 0.0;
+
+    const double delta = 6.0 / 29.0;
+    const double delta2 = delta * delta;
+    const double delta3 = delta2 * delta;
+
+    if (t >= delta3)
+        return cbrt(t);
+
+    const double inv_3delta2 = 1.0 / (3.0 * delta2);
+    return (t * inv_3delta2) + (4.0 / 29.0);
+}
+
+static inline LabSpace XyzToLab_White(XyzSpace xyz, WhitePoint wp)
+{
+    // Normalize XYZ by reference white (XYZ expected 0..100 scale)
+    const double x = xyz.x / wp.x;
+    const double y = xyz.y / wp.y;
+    const double z = xyz.z / wp.z;
+
+    const double fx = lab_f(x);
+    const double fy = lab_f(y);
+    const double fz = lab_f(z);
+
+    LabSpace lab = {
+        (116.0 * fy) - 16.0,
+        500.0 * (fx - fy),
+        200.0 * (fy - fz)
+    };
+
+    return lab;
+}
+
+static inline double lab_f_inv(double t)
+{
+    const double delta = 6.0 / 29.0;
+
+    if (t > delta)
+        return t * t * t;
+
+    return 3.0 * delta * delta * (t - (4.0 / 29.0));
+}
+
+static inline XyzSpace LabToXyz_White(LabSpace lab, WhitePoint wp)
+{
+    const double fy = (lab.l + 16.0) / 116.0;
+    const double fx = fy + (lab.a / 500.0);
+    const double fz = fy - (lab.b / 200.0);
+
+    XyzSpace xyz = {
+        wp.x * lab_f_inv(fx),
+        wp.y * lab_f_inv(fy),
+        wp.z * lab_f_inv(fz)
+    };
+    return xyz;
+}
+
+/// <summary>
+/// XYZ to Luv.  un_prime / vn_prime are the white point chromaticity (u'n, v'n) from
+/// LuvWhiteChromaticity, the same for every color so callers work it out once.
+/// </summary>
+static inline LuvSpace XyzToLuv_White(XyzSpace xyz, WhitePoint wp, double un_prime, double vn_prime)
+{
+    const double wpY = wp.y;
+
+    //// Calculate sample chromaticity coordinates (u', v')
+    double divisor = (xyz.x + (15 * xyz.y) + (3 * xyz.z));
+    double u_prime = (divisor == 0) ? 0 : (4 * xyz.x) / divisor;
+    double v_prime = (divisor == 0) ? 0 : (9 * xyz.y) / divisor;
+
+    //// Calculate L*
+    const double delta = 6.0 / 29.0;
+    const double deltaCubed = (delta * delta * delta); // (6/29)^3
+
+    double l, u, v = 0.0;
+    if ((xyz.y / wpY) > deltaCubed)
+        l = 116 * pow(xyz.y / wpY, 1.0 / 3.0) - 16;
+    else
+        l = (29.0 / 3.0) * (29.0 / 3.0) * (29.0 / 3.0) * (xyz.y / wpY);     // CIE kappa, meets the cube root branch at L* = 8
+
+    //// Calculate u* and v*
+    u = 13 * l * (u_prime - un_prime);
+    v = 13 * l * (v_prime - vn_prime);
+
+    LuvSpace luv = { l, u, v };
+    return luv;
+}
+
+/// <summary>
+/// Luv back to XYZ.  un_prime / vn_prime are the white point chromaticity (u'n, v'n) so batch 
+/// callers can compute them once.
+/// </summary>
+static inline XyzSpace LuvToXyz_White(LuvSpace luv, WhitePoint wp, double un_prime, double vn_prime)
+{
+    XyzSpace xyz = { 0.0, 0.0, 0.0 };
+
+    // L* of 0 is black, u* and v* carry no information.
+    if (luv.l <= 0.0)
+        return xyz;
+
+    //// Y from L*, inverse of the two L* branches in XyzToLuv_White (they meet at L* = 8)
+    if (luv.l > 8.0)
+    {
+        const double f = (luv.l + 16.0) / 116.0;
+        xyz.y = wp.y * f * f * f;
+    }
+    else
+        xyz.y = wp.y * luv.l / ((29.0 / 3.0) * (29.0 / 3.0) * (29.0 / 3.0));
+
+    //// Sample chromaticity (u', v')
+    const double u_prime = luv.u / (13.0 * luv.l) + un_prime;
+    const double v_prime = luv.v / (13.0 * luv.l) + vn_prime;
+
+    if (v_prime == 0.0)
+        return xyz;
+
+    xyz.x = xyz.y * (9.0 * u_prime) / (4.0 * v_prime);
+    xyz.z = xyz.y * (12.0 - (3.0 * u_prime) - (20.0 * v_prime)) / (4.0 * v_prime);
+    return xyz;
+}
+
+/// <summary>
+/// White point chromaticity (u'n, v'n) for the Luv conversions.
+/// </summary>
+static inline void LuvWhiteChromaticity(WhitePoint wp, double* un_prime, double* vn_prime)
+{
+    *un_prime = (4 * wp.x) / (wp.x + (15 * wp.y) + (3 * wp.z));
+    *vn_prime = (9 * wp.y) / (wp.x + (15 * wp.y) + (3 * wp.z));
+}
+
+static inline LabSpace LchToLab_Core(LchSpace lch)
+{
+    const double h = lch.h * (CHIZL_PI / 180.0);
+
+    LabSpace lab = {
+        lch.l,
+        lch.c * cos(h),
+        lch.c * sin(h)
+    };
+    return lab;
+}
+
+static inline LchSpace LabToLch_Core(LabSpace lab)
+{
+    double a = lab.a;
+    double b = lab.b;
+
+    double C = sqrt(a * a + b * b);
+    double H = 0.0;
+
+    if (C < CHIZL_LCH_CHROMA_EPS) {
+        C = 0.0;
+        H = 0.0;
+    }
+    else {
+        H = atan2(b, a) * (180.0 / CHIZL_PI);
+        if (H < 0.0) //H += 360.0;
+            H = fmod(H + 360.0, 360.0);
+    }
+
+    LchSpace lch = { lab.l, C, H };
+    return lch;
+}
+
+#endif
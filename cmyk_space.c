@@ -1,10 +1,11 @@
 // cmyk_conversions.c
 #include "cmyk_space.h"
 #include "common.h"             // For clampInt, clampDbl
+#include "fixed_point.h"        // For FixedDivRound, FixedRatioRecipTable
 #include <string.h>             // For strlen, strcpy_s
 #include <math.h>               // For fmin, fmax, fabs, round, pow
 
-CHIZL_COLORS_API CmykSpace RgbToCmyk(RgbColor rgb)
+static inline CmykSpace RgbToCmyk_Core(RgbColor rgb)
 {
     double r = rgb.red / 255.0;
     double g = rgb.green / 255.0;
@@ -37,7 +38,12 @@ CHIZL_COLORS_API CmykSpace RgbToCmyk(RgbColor rgb)
     return cmyk;
 }
 
-CHIZL_COLORS_API RgbColor CmykToRgb(CmykSpace cmyk)
+CHIZL_COLORS_API CmykSpace RgbToCmyk(RgbColor rgb)
+{
+    return RgbToCmyk_Core(rgb);
+}
+
+static inline RgbColor CmykToRgb_Core(CmykSpace cmyk)
 {
     double c = clampDbl(cmyk.cyan / 100.0, 0.0, 1.0);
     double m = clampDbl(cmyk.magenta / 100.0, 0.0, 1.0);
@@ -66,3 +72,166 @@ CHIZL_COLORS_API RgbColor CmykToRgb(CmykSpace cmyk)
     return rgb;
 }
 
+CHIZL_COLORS_API RgbColor CmykToRgb(CmykSpace cmyk)
+{
+    return CmykToRgb_Core(cmyk);
+}
+
+// Float variants: same math in double, rounded to float once on the way out.
+static inline CmykSpaceF CmykToF(CmykSpace cmyk)
+{
+    CmykSpaceF f = { (float)cmyk.cyan, (float)cmyk.magenta, (float)cmyk.yellow, (float)cmyk.key, (float)cmyk.raw_key };
+    return f;
+}
+
+static inline CmykSpace CmykFromF(CmykSpaceF f)
+{
+    CmykSpace cmyk = { f.cyan, f.magenta, f.yellow, f.key, f.raw_key };
+    return cmyk;
+}
+
+CHIZL_COLORS_API CmykSpaceF RgbToCmykF(RgbColor rgb)
+{
+    return CmykToF(RgbToCmyk_Core(rgb));
+}
+
+CHIZL_COLORS_API RgbColor CmykFToRgb(CmykSpaceF cmyk)
+{
+    return CmykToRgb_Core(CmykFromF(cmyk));
+}
+
+CHIZL_COLORS_API size_t RgbToCmykBatch(const RgbColor* rgb, CmykSpace* cmyk, size_t count, size_t stride)
+{
+    if (rgb == NULL || cmyk == NULL)
+        return 0;
+
+    if (isPackedStride(stride, sizeof(CmykSpace)))
+    {
+        for (size_t i = 0; i < count; i++)
+            cmyk[i] = RgbToCmyk_Core(rgb[i]);
+    }
+    else
+    {
+        for (size_t i = 0; i < count; i++)
+            *(CmykSpace*)stridedAt(cmyk, i, stride, sizeof(CmykSpace)) = RgbToCmyk_Core(rgb[i]);
+    }
+
+    return count;
+}
+
+CHIZL_COLORS_API size_t RgbToCmykFBatch(const RgbColor* rgb, CmykSpaceF* cmyk, size_t count, size_t stride)
+{
+    if (rgb == NULL || cmyk == NULL)
+        return 0;
+
+    if (isPackedStride(stride, sizeof(CmykSpaceF)))
+    {
+        for (size_t i = 0; i < count; i++)
+            cmyk[i] = CmykToF(RgbToCmyk_Core(rgb[i]));
+    }
+    else
+    {
+        for (size_t i = 0; i < count; i++)
+            *(CmykSpaceF*)stridedAt(cmyk, i, stride, sizeof(CmykSpaceF)) = CmykToF(RgbToCmyk_Core(rgb[i]));
+    }
+
+    return count;
+}
+
+CHIZL_COLORS_API size_t CmykFToRgbBatch(const CmykSpaceF* cmyk, RgbColor* rgb, size_t count, size_t stride)
+{
+    if (cmyk == NULL || rgb == NULL)
+        return 0;
+
+    if (isPackedStride(stride, sizeof(RgbColor)))
+    {
+        for (size_t i = 0; i < count; i++)
+            rgb[i] = CmykToRgb_Core(CmykFromF(cmyk[i]));
+    }
+    else
+    {
+        for (size_t i = 0; i < count; i++)
+            *(RgbColor*)stridedAt(rgb, i, stride, sizeof(RgbColor)) = CmykToRgb_Core(CmykFromF(cmyk[i]));
+    }
+
+    return count;
+}
+
+// Fixed point variants: integer only, every division through the fixed_point.h reciprocal tables.
+static inline CmykSpaceU16 RgbToCmykU16_Core(RgbColor rgb, const uint64_t* ratioRecip)
+{
+    const int r = rgb.red, g = rgb.green, b = rgb.blue;
+    const int max = (r > g) ? ((r > b) ? r : b) : ((g > b) ? g : b);
+    const uint64_t recip = ratioRecip[max];     // 0 for black, which zeroes c, m, y like the double version
+
+    CmykSpaceU16 cmyk = {
+        (unsigned short)FixedDivRound((unsigned int)(max - r), recip),
+        (unsigned short)FixedDivRound((unsigned int)(max - g), recip),
+        (unsigned short)FixedDivRound((unsigned int)(max - b), recip),
+        (unsigned short)((255 - max) * 257)
+    };
+    return cmyk;
+}
+
+static inline RgbColor CmykU16ToRgb_Core(CmykSpaceU16 cmyk)
+{
+    const int max = 255 - FixedTo8(cmyk.key);
+
+    RgbColor rgb = {
+        255,
+        (unsigned char)(max - FixedRatioOf(cmyk.cyan, max)),
+        (unsigned char)(max - FixedRatioOf(cmyk.magenta, max)),
+        (unsigned char)(max - FixedRatioOf(cmyk.yellow, max))
+    };
+    return rgb;
+}
+
+CHIZL_COLORS_API CmykSpaceU16 RgbToCmykU16(RgbColor rgb)
+{
+    return RgbToCmykU16_Core(rgb, FixedRatioRecipTable());
+}
+
+CHIZL_COLORS_API RgbColor CmykU16ToRgb(CmykSpaceU16 cmyk)
+{
+    return CmykU16ToRgb_Core(cmyk);
+}
+
+CHIZL_COLORS_API size_t RgbToCmykU16Batch(const RgbColor* rgb, CmykSpaceU16* cmyk, size_t count, size_t stride)
+{
+    if (rgb == NULL || cmyk == NULL)
+        return 0;
+
+    const uint64_t* ratioRecip = FixedRatioRecipTable();
+
+    if (isPackedStride(stride, sizeof(CmykSpaceU16)))
+    {
+        for (size_t i = 0; i < count; i++)
+            cmyk[i] = RgbToCmykU16_Core(rgb[i], ratioRecip);
+    }
+    else
+    {
+        for (size_t i = 0; i < count; i++)
+            *(CmykSpaceU16*)stridedAt(cmyk, i, stride, sizeof(CmykSpaceU16)) = RgbToCmykU16_Core(rgb[i], ratioRecip);
+    }
+
+    return count;
+}
+
+CHIZL_COLORS_API size_t CmykU16ToRgbBatch(const CmykSpaceU16* cmyk, RgbColor* rgb, size_t count, size_t stride)
+{
+    if (cmyk == NULL || rgb == NULL)
+        return 0;
+
+    if (isPackedStride(stride, sizeof(RgbColor)))
+    {
+        for (size_t i = 0; i < count; i++)
+            rgb[i] = CmykU16ToRgb_Core(cmyk[i]);
+    }
+    else
+    {
+        for (size_t i = 0; i < count; i++)
+            *(RgbColor*)stridedAt(rgb, i, stride, sizeof(RgbColor)) = CmykU16ToRgb_Core(cmyk[i]);
+    }
+
+    return count;
+}
@@ -12,6 +12,7 @@ extern "C" {
 
 #include "import_exports.h"
 #include "chizl_colors_types.h"
+#include <stddef.h>             // For size_t
 
 /// <summary>
 /// Converts an RGB color to CMYK color space.
@@ -27,6 +28,88 @@ CHIZL_COLORS_API CmykSpace RgbToCmyk(RgbColor clr);
 /// <returns>The converted RGB color.</returns>
 CHIZL_COLORS_API RgbColor CmykToRgb(CmykSpace cmyk);
 
+/// <summary>
+/// Converts an array of RGB colors to the CMYK color space in a single call.
+/// </summary>
+/// <param name="rgb">Pointer to the first RGB color to convert.</param>
+/// <param name="cmyk">Pointer to the first CmykSpace to write.</param>
+/// <param name="count">Number of colors to convert.</param>
+/// <param name="stride">Distance in bytes between output elements, 0 for a tightly packed array.</param>
+/// <returns>The number of colors converted, 0 if either pointer is NULL.</returns>
+CHIZL_COLORS_API size_t RgbToCmykBatch(const RgbColor* rgb, CmykSpace* cmyk, size_t count, size_t stride);
+
+// --- Float (single precision) variants, see chizl_colors_types.h for accuracy ---
+
+/// <summary>
+/// Float version of RgbToCmyk, the double result rounded to float.
+/// </summary>
+/// <param name="rgb">RGB Color</param>
+/// <returns>CmykSpaceF struct</returns>
+CHIZL_COLORS_API CmykSpaceF RgbToCmykF(RgbColor rgb);
+
+/// <summary>
+/// Float version of CmykToRgb.
+/// </summary>
+/// <param name="cmyk">CmykSpaceF struct</param>
+/// <returns>RGB Color</returns>
+CHIZL_COLORS_API RgbColor CmykFToRgb(CmykSpaceF cmyk);
+
+/// <summary>
+/// Converts an array of RGB colors to CmykSpaceF in a single call.  Half the output memory of RgbToCmykBatch.
+/// </summary>
+/// <param name="rgb">Pointer to the first RGB color to convert.</param>
+/// <param name="cmyk">Pointer to the first CmykSpaceF to write.</param>
+/// <param name="count">Number of colors to convert.</param>
+/// <param name="stride">Distance in bytes between output elements, 0 for a tightly packed array.</param>
+/// <returns>The number of colors converted, 0 if either pointer is NULL.</returns>
+CHIZL_COLORS_API size_t RgbToCmykFBatch(const RgbColor* rgb, CmykSpaceF* cmyk, size_t count, size_t stride);
+
+/// <summary>
+/// Converts an array of CmykSpaceF colors back to RGB in a single call.
+/// </summary>
+/// <param name="cmyk">Pointer to the first CmykSpaceF to convert.</param>
+/// <param name="rgb">Pointer to the first RGB color to write.</param>
+/// <param name="count">Number of colors to convert.</param>
+/// <param name="stride">Distance in bytes between output elements, 0 for a tightly packed array.</param>
+/// <returns>The number of colors converted, 0 if either pointer is NULL.</returns>
+CHIZL_COLORS_API size_t CmykFToRgbBatch(const CmykSpaceF* cmyk, RgbColor* rgb, size_t count, size_t stride);
+
+// --- 16-bit fixed point variants, integer math only, see chizl_colors_types.h for accuracy ---
+
+/// <summary>
+/// Fixed point version of RgbToCmyk, every field 0 - 65535.
+/// </summary>
+/// <param name="rgb">RGB Color</param>
+/// <returns>CmykSpaceU16 struct</returns>
+CHIZL_COLORS_API CmykSpaceU16 RgbToCmykU16(RgbColor rgb);
+
+/// <summary>
+/// Fixed point version of CmykToRgb.  Returns the original color for anything RgbToCmykU16 produced.
+/// </summary>
+/// <param name="cmyk">CmykSpaceU16 struct</param>
+/// <returns>RGB Color</returns>
+CHIZL_COLORS_API RgbColor CmykU16ToRgb(CmykSpaceU16 cmyk);
+
+/// <summary>
+/// Converts an array of RGB colors to CmykSpaceU16 in a single call.
+/// </summary>
+/// <param name="rgb">Pointer to the first RGB color to convert.</param>
+/// <param name="cmyk">Pointer to the first CmykSpaceU16 to write.</param>
+/// <param name="count">Number of colors to convert.</param>
+/// <param name="stride">Distance in bytes between output elements, 0 for a tightly packed array.</param>
+/// <returns>The number of colors converted, 0 if either pointer is NULL.</returns>
+CHIZL_COLORS_API size_t RgbToCmykU16Batch(const RgbColor* rgb, CmykSpaceU16* cmyk, size_t count, size_t stride);
+
+/// <summary>
+/// Converts an array of CmykSpaceU16 colors back to RGB in a single call.
+/// </summary>
+/// <param name="cmyk">Pointer to the first CmykSpaceU16 to convert.</param>
+/// <param name="rgb">Pointer to the first RGB color to write.</param>
+/// <param name="count">Number of colors to convert.</param>
+/// <param name="stride">Distance in bytes between output elements, 0 for a tightly packed array.</param>
+/// <returns>The number of colors converted, 0 if either pointer is NULL.</returns>
+CHIZL_COLORS_API size_t CmykU16ToRgbBatch(const CmykSpaceU16* cmyk, RgbColor* rgb, size_t count, size_t stride);
+
 // --- End of "extern C" block ---
 #ifdef __cplusplus
 }
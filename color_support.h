@@ -11,6 +11,7 @@ extern "C" {
 #endif
 
 #include "import_exports.h"
+#include <stddef.h>             // For size_t
 
 /// <summary>
 /// Frees memory that was previously allocated.
@@ -19,6 +20,55 @@ extern "C" {
 /// <returns>This function does not return a value.</returns>
 CHIZL_COLORS_API void ChizlFree(void* p);
 
+/// <summary>
+/// Instruction set levels the vectorized batch kernels can run with.
+/// </summary>
+typedef enum {
+    SIMD_NONE = 0,
+    SIMD_SSE41 = 1,
+    SIMD_AVX2 = 2
+} SimdLevel;
+
+/// <summary>
+/// Returns the instruction set level the batch kernels (e.g. RgbToLabBatch) currently use.<br/>
+/// Detected once from the CPU and OS, then capped by ChizlSetSimdLevel().
+/// </summary>
+/// <returns>The active SimdLevel.</returns>
+CHIZL_COLORS_API SimdLevel ChizlGetSimdLevel(void);
+
+/// <summary>
+/// Caps the instruction set level used by the batch kernels.  Levels above what the CPU supports are ignored.<br/>
+/// Mainly for benchmarking and verifying the vector paths against SIMD_NONE (scalar).
+/// </summary>
+/// <param name="maxLevel">Highest level the kernels may use.</param>
+/// <returns>The SimdLevel that will actually be used.</returns>
+CHIZL_COLORS_API SimdLevel ChizlSetSimdLevel(SimdLevel maxLevel);
+
+/// <summary>
+/// Returns the number of threads the *Parallel functions (e.g. RgbToLabParallel) split work across,
+/// including the calling thread.  Defaults to the number of logical processors.
+/// </summary>
+/// <returns>The thread count.</returns>
+CHIZL_COLORS_API size_t ChizlGetThreadCount(void);
+
+/// <summary>
+/// Sets the number of threads the *Parallel functions use, including the calling thread.  Worker threads
+/// are started on the next parallel call and then kept (sleeping) for later calls.<br/>
+/// 1 stops the workers and runs everything on the calling thread.  Waits for a parallel call in progress to finish first.
+/// </summary>
+/// <param name="threadCount">Thread count, 0 for the number of logical processors.  Capped at 256.</param>
+/// <returns>The thread count that will be used.</returns>
+CHIZL_COLORS_API size_t ChizlSetThreadCount(size_t threadCount);
+
+/// <summary>
+/// Stops the worker threads and waits for them to exit, the thread count is kept and the next parallel
+/// call starts a new set.  Waits for a parallel call in progress to finish first.<br/>
+/// Call it before FreeLibrary: each worker holds a reference on the DLL, so it can't unload while they run.
+/// dlclose and process exit stop the workers on their own.
+/// </summary>
+/// <returns>This function does not return a value.</returns>
+CHIZL_COLORS_API void ChizlStopThreads(void);
+
 // --- End of "extern C" block ---
 #ifdef __cplusplus
 }
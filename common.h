@@ -4,6 +4,8 @@
 #ifndef COMMON_H
 #define COMMON_H
 
+#include <stddef.h>             // For size_t
+
 //#define TRUE 1
 //#define FALSE 0
 //#define BOOL int
@@ -14,6 +16,7 @@ static const double CHIZL_PI_L = 3.14159265358979323846264338327950288L;	// long
 static const double CHIZL_LCH_CHROMA_EPS = 0.003;							// 1e-6 - A small epsilon value to treat very low chroma as zero in LCH conversions. 
 																			// Perceptual stability: treat near-neutral colors as neutral.
 																			// 0.003 clamps your observed D65Full gray drift (C=0.002).
+static const double CHIZL_OKLCH_CHROMA_EPS = 0.00003;						// The LCH epsilon on the OKLab scale (L 0-1 instead of 0-100).
 
 static inline unsigned char clampUChr(unsigned char v, unsigned char min, unsigned char max) { return v < min ? min : (v > max ? max : v); }
 static inline int clampInt(int v, int min, int max) { return v < min ? min : (v > max ? max : v); }
@@ -41,4 +44,19 @@ static inline double chkDbleClamp(double v, double min, double max, double div)
 	return clampDbl(v, min, max);
 }
 
+/// <summary>
+/// Returns the address of element 'index' in a caller supplied batch output buffer.
+/// A stride of 0 means the buffer is a tightly packed array of 'size' byte elements.
+/// </summary>
+static inline void* stridedAt(void* base, size_t index, size_t stride, size_t size)
+{
+	return (unsigned char*)base + (index * (stride ? stride : size));
+}
+
+/// <summary>
+/// True when the batch output stride describes a tightly packed array, which lets batch 
+/// loops index the output directly and keeps them simple enough for the compiler to vectorize.
+/// </summary>
+static inline int isPackedStride(size_t stride, size_t size) { return stride == 0 || stride == size; }
+
 #endif
\ No newline at end of file
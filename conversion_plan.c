@@ -0,0 +1,358 @@
+// conversion_plan.c
+#include "conversion_plan.h"
+#include "rgb_color.h"
+#include "hsv_space.h"          // For RgbToHsv, HsvToRgb, RgbToHsvBatch
+#include "hsl_space.h"          // For RgbToHsl, HslToRgb, RgbToHslBatch
+#include "cmyk_space.h"         // For RgbToCmyk, CmykToRgb, RgbToCmykBatch
+#include "xyz_space.h"          // For RgbToXyzBatch, RgbToLabBatch, XyzToRgbBatch, LabToRgbBatch
+#include "luv_space.h"          // For RgbToLuvBatch, LuvToRgbBatch
+#include "lch_space.h"          // For RgbToLchBatch, LchToRgbBatch
+#include "white_points_core.h"  // For WhitePointLookup
+#include "cie_common.h"         // For RgbToXyz_Core, XyzToRgb_Core, XyzToLab_White, LabToLch_Core, ...
+#include "common.h"             // For stridedAt
+#include <stdlib.h>             // For malloc, free
+#include <string.h>             // For memcpy
+
+// A plan picks one route at creation:
+//   PLAN_COPY     same space on both sides
+//   PLAN_BATCH    RGB to / from a space that already has a batch function (D65 full white point)
+//   PLAN_LAB_LCH  Lab <-> Lch, polar <-> rectangular only
+//   PLAN_RGB      between RGB, HSV, HSL and CMYK, through RgbColor
+//   PLAN_XYZ      everything else, through XyzSpace with at most one adaptation matrix
+// Chained routes run a chunk at a time: the whole chunk is decoded into a small stack buffer, adapted
+// if needed, then encoded, so each loop has one fixed step and the setup is paid once per plan.
+
+#define PLAN_CHUNK 256
+#define COLOR_SPACE_COUNT 8
+
+typedef enum {
+    PLAN_COPY,
+    PLAN_BATCH,
+    PLAN_LAB_LCH,
+    PLAN_RGB,
+    PLAN_XYZ
+} PlanRoute;
+
+struct ConversionPlan {
+    ColorSpaceType source;
+    ColorSpaceType destination;
+    PlanRoute route;
+    size_t sourceSize;
+    size_t destinationSize;
+    WhitePoint white;
+    double un_prime;            // Luv chromaticity of white
+    double vn_prime;
+    int adapt;                  // Apply matrix between decode and encode
+    double matrix[9];
+    const double* linear;
+};
+
+static const size_t s_spaceSize[COLOR_SPACE_COUNT] = {
+    sizeof(RgbColor), sizeof(HsvSpace), sizeof(HslSpace), sizeof(CmykSpace),
+    sizeof(XyzSpace), sizeof(LabSpace), sizeof(LuvSpace), sizeof(LchSpace)
+};
+
+static inline int IsRgbFamily(ColorSpaceType space) { return space <= COLOR_SPACE_CMYK; }
+static inline int IsWhiteRelative(ColorSpaceType space) { return space >= COLOR_SPACE_LAB; }
+
+static inline XyzSpace Apply3x3(const double* m, XyzSpace xyz)
+{
+    XyzSpace out = {
+        m[0] * xyz.x + m[1] * xyz.y + m[2] * xyz.z,
+        m[3] * xyz.x + m[4] * xyz.y + m[5] * xyz.z,
+        m[6] * xyz.x + m[7] * xyz.y + m[8] * xyz.z
+    };
+    return out;
+}
+
+/// <summary>
+/// True when RGB to / from the other side of the plan has an exported batch function to hand off to.
+/// </summary>
+static int HasBatchRoute(ColorSpaceType source, ColorSpaceType destination, WhitePointType wp)
+{
+    if (source == COLOR_SPACE_RGB)
+        return destination == COLOR_SPACE_XYZ || IsRgbFamily(destination) || wp == WPID_D65_FULL;
+    if (destination == COLOR_SPACE_RGB)
+        return source == COLOR_SPACE_XYZ || (IsWhiteRelative(source) && wp == WPID_D65_FULL);
+    return 0;
+}
+
+static size_t RunBatch(const ConversionPlan* plan, const void* in, void* out, size_t count, size_t stride)
+{
+    if (plan->source == COLOR_SPACE_RGB)
+    {
+        const RgbColor* rgb = (const RgbColor*)in;
+        switch (plan->destination)
+        {
+        case COLOR_SPACE_HSV: return RgbToHsvBatch(rgb, (HsvSpace*)out, count, stride);
+        case COLOR_SPACE_HSL: return RgbToHslBatch(rgb, (HslSpace*)out, count, stride);
+        case COLOR_SPACE_CMYK: return RgbToCmykBatch(rgb, (CmykSpace*)out, count, stride);
+        case COLOR_SPACE_XYZ: return RgbToXyzBatch(rgb, (XyzSpace*)out, count, stride);
+        case COLOR_SPACE_LAB: return RgbToLabBatch(rgb, (LabSpace*)out, count, stride);
+        case COLOR_SPACE_LUV: return RgbToLuvBatch(rgb, (LuvSpace*)out, count, stride);
+        case COLOR_SPACE_LCH: return RgbToLchBatch(rgb, (LchSpace*)out, count, stride);
+        default: return 0;
+        }
+    }
+
+    RgbColor* rgb = (RgbColor*)out;
+    switch (plan->source)
+    {
+    case COLOR_SPACE_XYZ: return XyzToRgbBatch((const XyzSpace*)in, rgb, count, stride);
+    case COLOR_SPACE_LAB: return LabToRgbBatch((const LabSpace*)in, rgb, count, stride);
+    case COLOR_SPACE_LUV: return LuvToRgbBatch((const LuvSpace*)in, rgb, count, stride);
+    case COLOR_SPACE_LCH: return LchToRgbBatch((const LchSpace*)in, rgb, count, stride);
+    default: return 0;
+    }
+}
+
+static void DecodeRgb(ColorSpaceType source, const void* in, size_t n, RgbColor* hub)
+{
+    switch (source)
+    {
+    case COLOR_SPACE_HSV:
+        for (size_t i = 0; i < n; i++)
+            hub[i] = HsvToRgb(((const HsvSpace*)in)[i]);
+        break;
+    case COLOR_SPACE_HSL:
+        for (size_t i = 0; i < n; i++)
+            hub[i] = HslToRgb(((const HslSpace*)in)[i]);
+        break;
+    case COLOR_SPACE_CMYK:
+        for (size_t i = 0; i < n; i++)
+            hub[i] = CmykToRgb(((const CmykSpace*)in)[i]);
+        break;
+    default:
+        memcpy(hub, in, n * sizeof(RgbColor));
+        break;
+    }
+}
+
+static void EncodeRgb(ColorSpaceType destination, const RgbColor* hub, size_t n, void* out, size_t stride)
+{
+    switch (destination)
+    {
+    case COLOR_SPACE_HSV:
+        for (size_t i = 0; i < n; i++)
+            *(HsvSpace*)stridedAt(out, i, stride, sizeof(HsvSpace)) = RgbToHsv(hub[i]);
+        break;
+    case COLOR_SPACE_HSL:
+        for (size_t i = 0; i < n; i++)
+            *(HslSpace*)stridedAt(out, i, stride, sizeof(HslSpace)) = RgbToHsl(hub[i]);
+        break;
+    case COLOR_SPACE_CMYK:
+        for (size_t i = 0; i < n; i++)
+            *(CmykSpace*)stridedAt(out, i, stride, sizeof(CmykSpace)) = RgbToCmyk(hub[i]);
+        break;
+    default:
+        for (size_t i = 0; i < n; i++)
+            *(RgbColor*)stridedAt(out, i, stride, sizeof(RgbColor)) = hub[i];
+        break;
+    }
+}
+
+static void DecodeXyz(const ConversionPlan* plan, const void* in, size_t n, XyzSpace* hub)
+{
+    const WhitePoint wp = plan->white;
+
+    switch (plan->source)
+    {
+    case COLOR_SPACE_XYZ:
+        memcpy(hub, in, n * sizeof(XyzSpace));
+        break;
+    case COLOR_SPACE_LAB:
+        for (size_t i = 0; i < n; i++)
+            hub[i] = LabToXyz_White(((const LabSpace*)in)[i], wp);
+        break;
+    case COLOR_SPACE_LUV:
+        for (size_t i = 0; i < n; i++)
+            hub[i] = LuvToXyz_White(((const LuvSpace*)in)[i], wp, plan->un_prime, plan->vn_prime);
+        break;
+    case COLOR_SPACE_LCH:
+        for (size_t i = 0; i < n; i++)
+            hub[i] = LabToXyz_White(LchToLab_Core(((const LchSpace*)in)[i]), wp);
+        break;
+    case COLOR_SPACE_RGB:
+        for (size_t i = 0; i < n; i++)
+            hub[i] = RgbToXyz_Core(((const RgbColor*)in)[i], plan->linear);
+        break;
+    default:
+    {
+        // HSV, HSL, CMYK: through RGB.
+        RgbColor rgb[PLAN_CHUNK];
+        DecodeRgb(plan->source, in, n, rgb);
+        for (size_t i = 0; i < n; i++)
+            hub[i] = RgbToXyz_Core(rgb[i], plan->linear);
+        break;
+    }
+    }
+
+    if (plan->adapt)
+    {
+        for (size_t i = 0; i < n; i++)
+            hub[i] = Apply3x3(plan->matrix, hub[i]);
+    }
+}
+
+static void EncodeXyz(const ConversionPlan* plan, const XyzSpace* hub, size_t n, void* out, size_t stride)
+{
+    const WhitePoint wp = plan->white;
+
+    switch (plan->destination)
+    {
+    case COLOR_SPACE_XYZ:
+        for (size_t i = 0; i < n; i++)
+            *(XyzSpace*)stridedAt(out, i, stride, sizeof(XyzSpace)) = hub[i];
+        break;
+    case COLOR_SPACE_LAB:
+        for (size_t i = 0; i < n; i++)
+            *(LabSpace*)stridedAt(out, i, stride, sizeof(LabSpace)) = XyzToLab_White(hub[i], wp);
+        break;
+    case COLOR_SPACE_LUV:
+        for (size_t i = 0; i < n; i++)
+            *(LuvSpace*)stridedAt(out, i, stride, sizeof(LuvSpace)) = XyzToLuv_White(hub[i], wp, plan->un_prime, plan->vn_prime);
+        break;
+    case COLOR_SPACE_LCH:
+        for (size_t i = 0; i < n; i++)
+            *(LchSpace*)stridedAt(out, i, stride, sizeof(LchSpace)) = LabToLch_Core(XyzToLab_White(hub[i], wp));
+        break;
+    case COLOR_SPACE_RGB:
+        for (size_t i = 0; i < n; i++)
+            *(RgbColor*)stridedAt(out, i, stride, sizeof(RgbColor)) = XyzToRgb_Core(hub[i]);
+        break;
+    default:
+    {
+        RgbColor rgb[PLAN_CHUNK];
+        for (size_t i = 0; i < n; i++)
+            rgb[i] = XyzToRgb_Core(hub[i]);
+        EncodeRgb(plan->destination, rgb, n, out, stride);
+        break;
+    }
+    }
+}
+
+static void RunLabLch(const ConversionPlan* plan, const void* in, void* out, size_t count, size_t stride)
+{
+    if (plan->source == COLOR_SPACE_LAB)
+    {
+        for (size_t i = 0; i < count; i++)
+            *(LchSpace*)stridedAt(out, i, stride, sizeof(LchSpace)) = LabToLch_Core(((const LabSpace*)in)[i]);
+    }
+    else
+    {
+        for (size_t i = 0; i < count; i++)
+            *(LabSpace*)stridedAt(out, i, stride, sizeof(LabSpace)) = LchToLab_Core(((const LchSpace*)in)[i]);
+    }
+}
+
+CHIZL_COLORS_API size_t ColorSpaceSize(ColorSpaceType space)
+{
+    return ((int)space >= 0 && (int)space < COLOR_SPACE_COUNT) ? s_spaceSize[space] : 0;
+}
+
+CHIZL_COLORS_API ConversionPlan* ConversionPlanCreate(ColorSpaceType source, ColorSpaceType destination, WhitePointType wp, ChromaticAdaptationType cat)
+{
+    WhitePointInfo white;
+    if (ColorSpaceSize(source) == 0 || ColorSpaceSize(destination) == 0 || !WhitePointLookup(wp, &white))
+        return NULL;
+    if ((int)cat < CAT_BRADFORD || (int)cat > CAT_XYZ_SCALING)
+        return NULL;
+
+    ConversionPlan* plan = (ConversionPlan*)calloc(1, sizeof(ConversionPlan));
+    if (plan == NULL)
+        return NULL;
+
+    plan->source = source;
+    plan->destination = destination;
+    plan->sourceSize = s_spaceSize[source];
+    plan->destinationSize = s_spaceSize[destination];
+    plan->white = white.wp;
+    plan->un_prime = white.un_prime;
+    plan->vn_prime = white.vn_prime;
+    plan->linear = SrgbLinearTable();
+
+    if (source == destination)
+        plan->route = PLAN_COPY;
+    else if (HasBatchRoute(source, destination, wp))
+        plan->route = PLAN_BATCH;
+    else if ((source == COLOR_SPACE_LAB || source == COLOR_SPACE_LCH) && (destination == COLOR_SPACE_LAB || destination == COLOR_SPACE_LCH))
+        plan->route = PLAN_LAB_LCH;
+    else if (IsRgbFamily(source) && IsRgbFamily(destination))
+        plan->route = PLAN_RGB;
+    else
+    {
+        plan->route = PLAN_XYZ;
+
+        // Only a D65 (sRGB) side to a white relative side needs adapting, once, in the right direction.
+        const int sourceRelative = IsWhiteRelative(source);
+        if (wp != WPID_D65 && wp != WPID_D65_FULL && sourceRelative != IsWhiteRelative(destination))
+        {
+            const int ok = sourceRelative ? ChromaticAdaptationMatrix(wp, WPID_D65, cat, plan->matrix)
+                                          : ChromaticAdaptationMatrix(WPID_D65, wp, cat, plan->matrix);
+            if (!ok)
+            {
+                free(plan);
+                return NULL;
+            }
+            plan->adapt = 1;
+        }
+    }
+
+    return plan;
+}
+
+CHIZL_COLORS_API void ConversionPlanFree(ConversionPlan* plan)
+{
+    free(plan);
+}
+
+CHIZL_COLORS_API int ConversionPlanConvert(const ConversionPlan* plan, const void* in, void* out)
+{
+    return ConversionPlanConvertBatch(plan, in, out, 1, 0) == 1;
+}
+
+CHIZL_COLORS_API size_t ConversionPlanConvertBatch(const ConversionPlan* plan, const void* in, void* out, size_t count, size_t stride)
+{
+    if (plan == NULL || in == NULL || out == NULL)
+        return 0;
+
+    const unsigned char* src = (const unsigned char*)in;
+
+    switch (plan->route)
+    {
+    case PLAN_COPY:
+        for (size_t i = 0; i < count; i++)
+            memcpy(stridedAt(out, i, stride, plan->destinationSize), src + i * plan->sourceSize, plan->destinationSize);
+        return count;
+    case PLAN_BATCH:
+        return RunBatch(plan, in, out, count, stride);
+    case PLAN_LAB_LCH:
+        RunLabLch(plan, in, out, count, stride);
+        return count;
+    default:
+        break;
+    }
+
+    const size_t outStep = stride ? stride : plan->destinationSize;
+    for (size_t done = 0; done < count; done += PLAN_CHUNK)
+    {
+        const size_t n = (count - done < PLAN_CHUNK) ? count - done : PLAN_CHUNK;
+        const void* chunkIn = src + done * plan->sourceSize;
+        void* chunkOut = (unsigned char*)out + done * outStep;
+
+        if (plan->route == PLAN_RGB)
+        {
+            RgbColor hub[PLAN_CHUNK];
+            DecodeRgb(plan->source, chunkIn, n, hub);
+            EncodeRgb(plan->destination, hub, n, chunkOut, stride);
+        }
+        else
+        {
+            XyzSpace hub[PLAN_CHUNK];
+            DecodeXyz(plan, chunkIn, n, hub);
+            EncodeXyz(plan, hub, n, chunkOut, stride);
+        }
+    }
+
+    return count;
+}
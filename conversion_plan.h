@@ -0,0 +1,94 @@
+// conversion_plan.h
+
+#pragma once
+
+#ifndef CONVERSION_PLAN_H
+#define CONVERSION_PLAN_H
+
+// --- Start of "extern C" block ---
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "import_exports.h"
+#include "chizl_colors_types.h"
+#include "white_points.h"           // For WhitePointType
+#include "chromatic_adaptation.h"   // For ChromaticAdaptationType
+#include <stddef.h>                 // For size_t
+
+/// <summary>
+/// Color spaces a ConversionPlan converts between, each one the matching double precision struct.
+/// </summary>
+typedef enum {
+    COLOR_SPACE_RGB = 0,        // RgbColor
+    COLOR_SPACE_HSV = 1,        // HsvSpace
+    COLOR_SPACE_HSL = 2,        // HslSpace
+    COLOR_SPACE_CMYK = 3,       // CmykSpace
+    COLOR_SPACE_XYZ = 4,        // XyzSpace (sRGB, D65)
+    COLOR_SPACE_LAB = 5,        // LabSpace
+    COLOR_SPACE_LUV = 6,        // LuvSpace
+    COLOR_SPACE_LCH = 7         // LchSpace
+} ColorSpaceType;
+
+/// <summary>
+/// Opaque conversion plan from one color space to another.  Everything that only depends on the pair and
+/// the white point (white point values, Luv chromaticity, adaptation matrix, which steps can be skipped)
+/// is worked out once at creation, then each conversion runs the whole chain in one pass.<br/>
+/// Read only after creation, one plan can be used from any number of threads.
+/// </summary>
+typedef struct ConversionPlan ConversionPlan;
+
+/// <summary>
+/// Size in bytes of one color in a space (sizeof(RgbColor), sizeof(LabSpace), ...).
+/// </summary>
+/// <param name="space">Color space.</param>
+/// <returns>The element size, 0 if space is unknown.</returns>
+CHIZL_COLORS_API size_t ColorSpaceSize(ColorSpaceType space);
+
+/// <summary>
+/// Builds a plan for converting colors from source to destination.<br/>
+/// Lab, Luv and Lch values are relative to wp.  RGB and XYZ are always sRGB (D65), so for any other white
+/// point the plan adapts once between the two with cat, the same way RgbToLabEx does.  Lab / Luv / Lch to
+/// each other stay on wp with no adaptation, and Lab to Lch (or back) skips XYZ altogether.<br/>
+/// With WPID_D65_FULL the results match the existing functions (RgbToLch, LuvToRgb, ...).
+/// </summary>
+/// <param name="source">Color space of the input.</param>
+/// <param name="destination">Color space of the output.</param>
+/// <param name="wp">White point for Lab, Luv and Lch.</param>
+/// <param name="cat">Adaptation transform, only used when wp is not D65.</param>
+/// <returns>The new plan, or NULL if a space, wp or cat is unknown or out of memory.  Release with ConversionPlanFree.</returns>
+CHIZL_COLORS_API ConversionPlan* ConversionPlanCreate(ColorSpaceType source, ColorSpaceType destination, WhitePointType wp, ChromaticAdaptationType cat);
+
+/// <summary>
+/// Releases a plan created by ConversionPlanCreate.  NULL is ignored.
+/// </summary>
+/// <param name="plan">Plan to free.</param>
+/// <returns>This function does not return a value.</returns>
+CHIZL_COLORS_API void ConversionPlanFree(ConversionPlan* plan);
+
+/// <summary>
+/// Converts one color.
+/// </summary>
+/// <param name="plan">Conversion plan.</param>
+/// <param name="in">Pointer to the source color (the struct for the plan's source space).</param>
+/// <param name="out">Pointer to the destination color (the struct for the plan's destination space).</param>
+/// <returns>1 on success, 0 if a pointer is NULL.</returns>
+CHIZL_COLORS_API int ConversionPlanConvert(const ConversionPlan* plan, const void* in, void* out);
+
+/// <summary>
+/// Converts an array of colors.  Pairs that have a batch function (RgbToLabBatch, LchToRgbBatch, ...) use it,
+/// so the results match that function.
+/// </summary>
+/// <param name="plan">Conversion plan.</param>
+/// <param name="in">Pointer to the first source color, tightly packed.</param>
+/// <param name="out">Pointer to the first destination color to write.</param>
+/// <param name="count">Number of colors to convert.</param>
+/// <param name="stride">Distance in bytes between output elements, 0 for a tightly packed array.</param>
+/// <returns>The number of colors converted, 0 if a pointer is NULL.</returns>
+CHIZL_COLORS_API size_t ConversionPlanConvertBatch(const ConversionPlan* plan, const void* in, void* out, size_t count, size_t stride);
+
+// --- End of "extern C" block ---
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -0,0 +1,270 @@
+// delta_e.c
+#include "delta_e.h"
+#include <math.h>               // For sqrt, atan2, cos, sin, exp
+
+// CIE76, CIE94 and CIEDE2000 color differences.
+//
+// The cores return the squared difference so nearest searches can compare without a sqrt.
+// Terms that only depend on one color are kept in DeltaERef so the one-to-many paths
+// compute them once for the reference instead of once per sample.
+
+static const double DEG_TO_RAD = 3.14159265358979323846 / 180.0;
+static const double RAD_TO_DEG = 180.0 / 3.14159265358979323846;
+static const double POW25_7 = 6103515625.0;        // 25^7
+
+/// <summary>
+/// Per color terms shared by every comparison against that color.
+/// </summary>
+typedef struct {
+    LabSpace lab;
+    double chroma;      // C*ab = sqrt(a^2 + b^2)
+    double sc94;        // CIE94 chroma weight, 1 + K1 * C (only used when the color is the reference)
+    double sh94;        // CIE94 hue weight, 1 + K2 * C
+} DeltaERef;
+
+static inline DeltaERef MakeRef(LabSpace lab)
+{
+    DeltaERef ref;
+    ref.lab = lab;
+    ref.chroma = sqrt(lab.a * lab.a + lab.b * lab.b);
+    ref.sc94 = 1.0 + 0.045 * ref.chroma;
+    ref.sh94 = 1.0 + 0.015 * ref.chroma;
+    return ref;
+}
+
+static inline double pow7(double v)
+{
+    const double v2 = v * v;
+    return v2 * v2 * v2 * v;
+}
+
+static inline double DeltaE76Sq(LabSpace lab1, LabSpace lab2)
+{
+    const double dl = lab1.l - lab2.l;
+    const double da = lab1.a - lab2.a;
+    const double db = lab1.b - lab2.b;
+    return dl * dl + da * da + db * db;
+}
+
+static inline double DeltaE94Sq(const DeltaERef* ref, LabSpace sample)
+{
+    const double dl = ref->lab.l - sample.l;
+    const double da = ref->lab.a - sample.a;
+    const double db = ref->lab.b - sample.b;
+    const double c2 = sqrt(sample.a * sample.a + sample.b * sample.b);
+    const double dc = ref->chroma - c2;
+
+    // dH^2 = da^2 + db^2 - dC^2, can dip just below 0 from rounding.
+    double dh2 = da * da + db * db - dc * dc;
+    if (dh2 < 0.0)
+        dh2 = 0.0;
+
+    const double tc = dc / ref->sc94;
+    return dl * dl + tc * tc + dh2 / (ref->sh94 * ref->sh94);
+}
+
+// Hue angle in degrees (0-360), 0 for a neutral color.
+static inline double HueDeg(double b, double ap)
+{
+    if (b == 0.0 && ap == 0.0)
+        return 0.0;
+
+    double h = atan2(b, ap) * RAD_TO_DEG;
+    return (h < 0.0) ? h + 360.0 : h;
+}
+
+static inline double DeltaE2000Sq(const DeltaERef* ref, LabSpace lab2, double c2)
+{
+    const LabSpace lab1 = ref->lab;
+    const double c1 = ref->chroma;
+
+    // a' correction, depends on both chromas so it can't be cached per reference.
+    const double cbar7 = pow7((c1 + c2) * 0.5);
+    const double g = 0.5 * (1.0 - sqrt(cbar7 / (cbar7 + POW25_7)));
+
+    const double a1p = (1.0 + g) * lab1.a;
+    const double a2p = (1.0 + g) * lab2.a;
+    const double c1p = sqrt(a1p * a1p + lab1.b * lab1.b);
+    const double c2p = sqrt(a2p * a2p + lab2.b * lab2.b);
+    const double h1p = HueDeg(lab1.b, a1p);
+    const double h2p = HueDeg(lab2.b, a2p);
+
+    const double dlp = lab2.l - lab1.l;
+    const double dcp = c2p - c1p;
+    const double cc = c1p * c2p;
+
+    double dhp = 0.0;
+    double hbarp = h1p + h2p;
+    if (cc != 0.0)
+    {
+        dhp = h2p - h1p;
+        if (dhp > 180.0)
+            dhp -= 360.0;
+        else if (dhp < -180.0)
+            dhp += 360.0;
+
+        if (fabs(h1p - h2p) <= 180.0)
+            hbarp = (h1p + h2p) * 0.5;
+        else if ((h1p + h2p) < 360.0)
+            hbarp = (h1p + h2p + 360.0) * 0.5;
+        else
+            hbarp = (h1p + h2p - 360.0) * 0.5;
+    }
+    const double dHp = 2.0 * sqrt(cc) * sin(dhp * 0.5 * DEG_TO_RAD);
+
+    const double lbarp = (lab1.l + lab2.l) * 0.5;
+    const double cbarp = (c1p + c2p) * 0.5;
+
+    // T = 1 - 0.17cos(h-30) + 0.24cos(2h) + 0.32cos(3h+6) - 0.20cos(4h-63)
+    // The multiple angles come from one cos/sin pair through the double/triple angle identities,
+    // which replaces four cos() calls with one cos() and one sin().
+    const double hr = hbarp * DEG_TO_RAD;
+    const double c1h = cos(hr), s1h = sin(hr);
+    const double c2h = 2.0 * c1h * c1h - 1.0, s2h = 2.0 * s1h * c1h;
+    const double c3h = c1h * c2h - s1h * s2h, s3h = s1h * c2h + c1h * s2h;
+    const double c4h = 2.0 * c2h * c2h - 1.0, s4h = 2.0 * s2h * c2h;
+    const double cos30 = 0.86602540378443865, sin30 = 0.5;
+    const double cos6 = 0.99452189536827334, sin6 = 0.10452846326765347;
+    const double cos63 = 0.45399049973954675, sin63 = 0.89100652418836786;
+    const double t = 1.0
+        - 0.17 * (c1h * cos30 + s1h * sin30)
+        + 0.24 * c2h
+        + 0.32 * (c3h * cos6 - s3h * sin6)
+        - 0.20 * (c4h * cos63 + s4h * sin63);
+
+    const double dTheta = 30.0 * exp(-((hbarp - 275.0) / 25.0) * ((hbarp - 275.0) / 25.0));
+    const double cbarp7 = pow7(cbarp);
+    const double rc = 2.0 * sqrt(cbarp7 / (cbarp7 + POW25_7));
+    const double lm50 = (lbarp - 50.0) * (lbarp - 50.0);
+    const double sl = 1.0 + (0.015 * lm50) / sqrt(20.0 + lm50);
+    const double sc = 1.0 + 0.045 * cbarp;
+    const double sh = 1.0 + 0.015 * cbarp * t;
+    const double rt = -sin(2.0 * dTheta * DEG_TO_RAD) * rc;
+
+    const double tl = dlp / sl;
+    const double tc = dcp / sc;
+    const double th = dHp / sh;
+    return tl * tl + tc * tc + th * th + rt * tc * th;
+}
+
+static inline double DeltaESq(const DeltaERef* ref, LabSpace sample, DeltaEType type)
+{
+    switch (type)
+    {
+    case DELTAE_CIE94:
+        return DeltaE94Sq(ref, sample);
+    case DELTAE_CIEDE2000:
+        return DeltaE2000Sq(ref, sample, sqrt(sample.a * sample.a + sample.b * sample.b));
+    case DELTAE_CIE76:
+    default:
+        return DeltaE76Sq(ref->lab, sample);
+    }
+}
+
+CHIZL_COLORS_API double DeltaE76(LabSpace lab1, LabSpace lab2)
+{
+    return sqrt(DeltaE76Sq(lab1, lab2));
+}
+
+CHIZL_COLORS_API double DeltaE94(LabSpace reference, LabSpace sample)
+{
+    const DeltaERef ref = MakeRef(reference);
+    return sqrt(DeltaE94Sq(&ref, sample));
+}
+
+CHIZL_COLORS_API double DeltaE2000(LabSpace lab1, LabSpace lab2)
+{
+    const DeltaERef ref = MakeRef(lab1);
+    return sqrt(DeltaE2000Sq(&ref, lab2, sqrt(lab2.a * lab2.a + lab2.b * lab2.b)));
+}
+
+CHIZL_COLORS_API double DeltaE(LabSpace lab1, LabSpace lab2, DeltaEType type)
+{
+    const DeltaERef ref = MakeRef(lab1);
+    return sqrt(DeltaESq(&ref, lab2, type));
+}
+
+CHIZL_COLORS_API size_t DeltaEPairs(const LabSpace* lab1, const LabSpace* lab2, double* out, size_t count, DeltaEType type)
+{
+    if (lab1 == NULL || lab2 == NULL || out == NULL)
+        return 0;
+
+    // Formula switch hoisted out of the loops.
+    switch (type)
+    {
+    case DELTAE_CIE94:
+        for (size_t i = 0; i < count; i++)
+        {
+            const DeltaERef ref = MakeRef(lab1[i]);
+            out[i] = sqrt(DeltaE94Sq(&ref, lab2[i]));
+        }
+        break;
+    case DELTAE_CIEDE2000:
+        for (size_t i = 0; i < count; i++)
+        {
+            const DeltaERef ref = MakeRef(lab1[i]);
+            out[i] = sqrt(DeltaE2000Sq(&ref, lab2[i], sqrt(lab2[i].a * lab2[i].a + lab2[i].b * lab2[i].b)));
+        }
+        break;
+    case DELTAE_CIE76:
+    default:
+        for (size_t i = 0; i < count; i++)
+            out[i] = sqrt(DeltaE76Sq(lab1[i], lab2[i]));
+        break;
+    }
+
+    return count;
+}
+
+CHIZL_COLORS_API size_t DeltaEOneToMany(LabSpace reference, const LabSpace* samples, double* out, size_t count, DeltaEType type)
+{
+    if (samples == NULL || out == NULL)
+        return 0;
+
+    const DeltaERef ref = MakeRef(reference);
+
+    switch (type)
+    {
+    case DELTAE_CIE94:
+        for (size_t i = 0; i < count; i++)
+            out[i] = sqrt(DeltaE94Sq(&ref, samples[i]));
+        break;
+    case DELTAE_CIEDE2000:
+        for (size_t i = 0; i < count; i++)
+            out[i] = sqrt(DeltaE2000Sq(&ref, samples[i], sqrt(samples[i].a * samples[i].a + samples[i].b * samples[i].b)));
+        break;
+    case DELTAE_CIE76:
+    default:
+        for (size_t i = 0; i < count; i++)
+            out[i] = sqrt(DeltaE76Sq(reference, samples[i]));
+        break;
+    }
+
+    return count;
+}
+
+CHIZL_COLORS_API size_t DeltaENearest(LabSpace reference, const LabSpace* samples, size_t count, DeltaEType type, double* distance)
+{
+    if (samples == NULL || count == 0)
+        return count;
+
+    const DeltaERef ref = MakeRef(reference);
+
+    // Compare squared differences, only the winner needs the sqrt.
+    size_t best = 0;
+    double bestSq = DeltaESq(&ref, samples[0], type);
+    for (size_t i = 1; i < count; i++)
+    {
+        const double d = DeltaESq(&ref, samples[i], type);
+        if (d < bestSq)
+        {
+            bestSq = d;
+            best = i;
+        }
+    }
+
+    if (distance != NULL)
+        *distance = sqrt(bestSq);
+
+    return best;
+}
@@ -0,0 +1,106 @@
+// delta_e.h
+
+#pragma once
+
+#ifndef DELTA_E_H
+#define DELTA_E_H
+
+// --- Start of "extern C" block ---
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "import_exports.h"
+#include "chizl_colors_types.h"
+#include <stddef.h>             // For size_t
+
+/// <summary>
+/// Delta-E formulas available for measuring the perceptual difference between two Lab colors.
+/// </summary>
+typedef enum {
+    /// <summary>
+    /// CIE 1976: straight line (Euclidean) distance in Lab.  Cheapest, least perceptually uniform.
+    /// </summary>
+    DELTAE_CIE76 = 0,
+    /// <summary>
+    /// CIE 1994 (graphic arts weights: kL = 1, K1 = 0.045, K2 = 0.015).  Not symmetric, the first color is the reference.
+    /// </summary>
+    DELTAE_CIE94 = 1,
+    /// <summary>
+    /// CIEDE2000: the current CIE recommendation and the most perceptually accurate.
+    /// </summary>
+    DELTAE_CIEDE2000 = 2
+} DeltaEType;
+
+/// <summary>
+/// CIE 1976 color difference, the Euclidean distance between two Lab colors.
+/// </summary>
+/// <param name="lab1">First Lab color.</param>
+/// <param name="lab2">Second Lab color.</param>
+/// <returns>Delta-E 76, 0.0 for identical colors.  ~2.3 is the commonly quoted "just noticeable difference".</returns>
+CHIZL_COLORS_API double DeltaE76(LabSpace lab1, LabSpace lab2);
+
+/// <summary>
+/// CIE 1994 color difference using the graphic arts weights.
+/// </summary>
+/// <param name="reference">Reference Lab color, its chroma weights the result.</param>
+/// <param name="sample">Lab color compared against the reference.</param>
+/// <returns>Delta-E 94, 0.0 for identical colors.</returns>
+CHIZL_COLORS_API double DeltaE94(LabSpace reference, LabSpace sample);
+
+/// <summary>
+/// CIEDE2000 color difference (kL = kC = kH = 1).
+/// </summary>
+/// <param name="lab1">First Lab color.</param>
+/// <param name="lab2">Second Lab color.</param>
+/// <returns>Delta-E 2000, 0.0 for identical colors.</returns>
+CHIZL_COLORS_API double DeltaE2000(LabSpace lab1, LabSpace lab2);
+
+/// <summary>
+/// Color difference between two Lab colors using the requested formula.
+/// </summary>
+/// <param name="lab1">First (reference) Lab color.</param>
+/// <param name="lab2">Second Lab color.</param>
+/// <param name="type">Delta-E formula to use.</param>
+/// <returns>The color difference, 0.0 for identical colors.</returns>
+CHIZL_COLORS_API double DeltaE(LabSpace lab1, LabSpace lab2, DeltaEType type);
+
+/// <summary>
+/// Color difference of each pair of Lab colors, out[i] = DeltaE(lab1[i], lab2[i], type).
+/// </summary>
+/// <param name="lab1">Pointer to the first array of (reference) Lab colors.</param>
+/// <param name="lab2">Pointer to the second array of Lab colors.</param>
+/// <param name="out">Pointer to 'count' doubles to receive the differences.</param>
+/// <param name="count">Number of pairs.</param>
+/// <param name="type">Delta-E formula to use.</param>
+/// <returns>The number of pairs measured, 0 if any pointer is NULL.</returns>
+CHIZL_COLORS_API size_t DeltaEPairs(const LabSpace* lab1, const LabSpace* lab2, double* out, size_t count, DeltaEType type);
+
+/// <summary>
+/// Color difference between one reference and many samples, out[i] = DeltaE(reference, samples[i], type).<br/>
+/// Everything that only depends on the reference is worked out once, not per sample.
+/// </summary>
+/// <param name="reference">Reference Lab color.</param>
+/// <param name="samples">Pointer to the Lab colors to compare against the reference.</param>
+/// <param name="out">Pointer to 'count' doubles to receive the differences.</param>
+/// <param name="count">Number of samples.</param>
+/// <param name="type">Delta-E formula to use.</param>
+/// <returns>The number of samples measured, 0 if any pointer is NULL.</returns>
+CHIZL_COLORS_API size_t DeltaEOneToMany(LabSpace reference, const LabSpace* samples, double* out, size_t count, DeltaEType type);
+
+/// <summary>
+/// Finds the sample closest to the reference, e.g. the nearest palette entry.
+/// </summary>
+/// <param name="reference">Reference Lab color.</param>
+/// <param name="samples">Pointer to the Lab colors to search.</param>
+/// <param name="count">Number of samples.</param>
+/// <param name="type">Delta-E formula to use.</param>
+/// <param name="distance">Optional, receives the Delta-E of the closest sample.  May be NULL.</param>
+/// <returns>Index of the closest sample, or 'count' if samples is NULL or count is 0.</returns>
+CHIZL_COLORS_API size_t DeltaENearest(LabSpace reference, const LabSpace* samples, size_t count, DeltaEType type, double* distance);
+
+// --- End of "extern C" block ---
+#ifdef __cplusplus
+}
+#endif
+#endif
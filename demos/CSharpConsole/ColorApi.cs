@@ -69,6 +69,107 @@ public struct LuvSpace
     public double v;
 }
 
+[StructLayout(LayoutKind.Sequential)]
+public struct OkLabSpace
+{
+    public double l;
+    public double a;
+    public double b;
+}
+
+[StructLayout(LayoutKind.Sequential)]
+public struct OkLchSpace
+{
+    public double l;
+    public double c;
+    public double h;
+}
+
+[StructLayout(LayoutKind.Sequential)]
+internal struct HsvSpaceF
+{
+    public float hue;
+    public float saturation;
+    public float value;
+    public float raw_value;
+}
+
+[StructLayout(LayoutKind.Sequential)]
+internal struct HslSpaceF
+{
+    public float hue;
+    public float saturation;
+    public float lightness;
+    public float raw_lightness;
+}
+
+[StructLayout(LayoutKind.Sequential)]
+internal struct XyzSpaceF
+{
+    public float x;
+    public float y;
+    public float z;
+}
+
+[StructLayout(LayoutKind.Sequential)]
+internal struct CmykSpaceF
+{
+    public float cyan;
+    public float magenta;
+    public float yellow;
+    public float key;
+    public float raw_key;
+}
+
+[StructLayout(LayoutKind.Sequential)]
+public struct LabSpaceF
+{
+    public float l;
+    public float a;
+    public float b;
+}
+
+[StructLayout(LayoutKind.Sequential)]
+public struct LchSpaceF
+{
+    public float l;
+    public float c;
+    public float h;
+}
+
+[StructLayout(LayoutKind.Sequential)]
+public struct LuvSpaceF
+{
+    public float l;
+    public float u;
+    public float v;
+}
+
+[StructLayout(LayoutKind.Sequential)]
+public struct HsvSpaceU16
+{
+    public ushort hue;
+    public ushort saturation;
+    public ushort value;
+}
+
+[StructLayout(LayoutKind.Sequential)]
+public struct HslSpaceU16
+{
+    public ushort hue;
+    public ushort saturation;
+    public ushort lightness;
+}
+
+[StructLayout(LayoutKind.Sequential)]
+public struct CmykSpaceU16
+{
+    public ushort cyan;
+    public ushort magenta;
+    public ushort yellow;
+    public ushort key;
+}
+
 [StructLayout(LayoutKind.Sequential)]
 public struct WhitePoint
 {
@@ -77,10 +178,136 @@ public struct WhitePoint
     public double z;
 }
 
+public enum SimdLevel : int
+{
+    SIMD_NONE = 0,
+    SIMD_SSE41 = 1,
+    SIMD_AVX2 = 2
+}
+
+public enum DeltaEType : int
+{
+    DELTAE_CIE76 = 0,
+    DELTAE_CIE94 = 1,
+    DELTAE_CIEDE2000 = 2
+}
+
+public enum AnsiColorMode : int
+{
+    ANSI_COLOR_24BIT = 0,
+    ANSI_COLOR_256 = 1,
+    ANSI_COLOR_16 = 2
+}
+
+public enum PaletteCacheMode : int
+{
+    PCACHE_FULL = 0,
+    PCACHE_REDUCED = 1
+}
+
+public enum QuantizeMethod : int
+{
+    QUANTIZE_MEDIAN_CUT = 0,
+    QUANTIZE_KMEANS = 1
+}
+
+public enum DitherMethod : int
+{
+    DITHER_FLOYD_STEINBERG = 0,
+    DITHER_ATKINSON = 1,
+    DITHER_BAYER = 2
+}
+
+public enum DitherScan : int
+{
+    DITHER_SCAN_RASTER = 0,
+    DITHER_SCAN_SERPENTINE = 1,
+    DITHER_SCAN_WAVEFRONT = 2
+}
+
+public enum GamutMapMethod : int
+{
+    GAMUT_MAP_CSS = 0,
+    GAMUT_MAP_TABLE = 1
+}
+
+public enum GradientSpace : int
+{
+    GRADIENT_RGB = 0,
+    GRADIENT_LINEAR_RGB = 1,
+    GRADIENT_HSL = 2,
+    GRADIENT_HSV = 3,
+    GRADIENT_LAB = 4,
+    GRADIENT_LCH = 5,
+    GRADIENT_LUV = 6
+}
+
+[StructLayout(LayoutKind.Sequential)]
+public struct PaletteCacheInfo
+{
+    public PaletteCacheMode mode;
+    public DeltaEType type;
+    public nuint paletteCount;
+    public nuint bytes;
+    public nuint mixedCells;
+    public double buildMs;
+    public int mapped;
+}
+
+[StructLayout(LayoutKind.Sequential)]
+public struct AnsiImageStats
+{
+    public nuint cells;
+    public nuint changedCells;
+    public nuint bytes;
+    public double renderMs;
+    public nuint frames;
+    public ulong totalBytes;
+}
+
 public enum WhitePointType : int
 {
     WPID_D65 = 0,
-    WPID_D65_FULL = 1
+    WPID_D65_FULL = 1,
+    WPID_D50 = 2,
+    WPID_D55 = 3,
+    WPID_D75 = 4,
+    WPID_A = 5,
+    WPID_C = 6,
+    WPID_E = 7,
+    WPID_F1 = 8,
+    WPID_F2 = 9,
+    WPID_F3 = 10,
+    WPID_F4 = 11,
+    WPID_F5 = 12,
+    WPID_F6 = 13,
+    WPID_F7 = 14,
+    WPID_F8 = 15,
+    WPID_F9 = 16,
+    WPID_F10 = 17,
+    WPID_F11 = 18,
+    WPID_F12 = 19,
+    WPID_CUSTOM = 100
+}
+
+public enum ChromaticAdaptationType : int
+{
+    CAT_BRADFORD = 0,
+    CAT_CAT02 = 1,
+    CAT_VON_KRIES = 2,
+    CAT_XYZ_SCALING = 3
+}
+
+public enum ColorSpaceType : int
+{
+    COLOR_SPACE_RGB = 0,
+    COLOR_SPACE_HSV = 1,
+    COLOR_SPACE_HSL = 2,
+    COLOR_SPACE_CMYK = 3,
+    COLOR_SPACE_XYZ = 4,
+    COLOR_SPACE_LAB = 5,
+    COLOR_SPACE_LUV = 6,
+    COLOR_SPACE_LCH = 7
 }
 
 internal static class ColorApi
@@ -130,6 +357,47 @@ internal static class ColorApi
     [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
     public static extern LabSpace RgbToLab(RgbColor rgb);
 
+    // --- Inverse CIE Conversions ---
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern RgbColor XyzToRgb(XyzSpace xyz);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern XyzSpace LabToXyz(LabSpace lab);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern XyzSpace LabToXyzEx(LabSpace lab, WhitePointType wp);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern RgbColor LabToRgb(LabSpace lab);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern XyzSpace LuvToXyz(LuvSpace luv);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern XyzSpace LuvToXyzEx(LuvSpace luv, WhitePointType wp);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern RgbColor LuvToRgb(LuvSpace luv);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern LabSpace LchToLab(LchSpace lch);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern RgbColor LchToRgb(LchSpace lch);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern nuint XyzToRgbBatch([In] XyzSpace[] xyz, [Out] RgbColor[] rgb, nuint count, nuint stride);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern nuint LabToRgbBatch([In] LabSpace[] lab, [Out] RgbColor[] rgb, nuint count, nuint stride);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern nuint LuvToRgbBatch([In] LuvSpace[] luv, [Out] RgbColor[] rgb, nuint count, nuint stride);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern nuint LchToRgbBatch([In] LchSpace[] lch, [Out] RgbColor[] rgb, nuint count, nuint stride);
+
     // --- Lch Conversions ---
 
     [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
@@ -138,6 +406,38 @@ internal static class ColorApi
     [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
     public static extern LchSpace RgbToLch(RgbColor rgb);
 
+    // --- OKLab / OKLCh Conversions ---
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern OkLabSpace RgbToOkLab(RgbColor rgb);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern RgbColor OkLabToRgb(OkLabSpace lab);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern OkLchSpace RgbToOkLch(RgbColor rgb);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern RgbColor OkLchToRgb(OkLchSpace lch);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern OkLchSpace OkLabToOkLch(OkLabSpace lab);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern OkLabSpace OkLchToOkLab(OkLchSpace lch);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern nuint RgbToOkLabBatch([In] RgbColor[] rgb, [Out] OkLabSpace[] lab, nuint count, nuint stride);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern nuint OkLabToRgbBatch([In] OkLabSpace[] lab, [Out] RgbColor[] rgb, nuint count, nuint stride);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern nuint RgbToOkLchBatch([In] RgbColor[] rgb, [Out] OkLchSpace[] lch, nuint count, nuint stride);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern nuint OkLchToRgbBatch([In] OkLchSpace[] lch, [Out] RgbColor[] rgb, nuint count, nuint stride);
+
     // --- Cmyk Conversions ---
 
     [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
@@ -146,6 +446,439 @@ internal static class ColorApi
     [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
     public static extern RgbColor CmykToRgb(CmykSpace rgb);
 
+    // --- Batch Conversions ---
+    // One native call per array instead of one per color.  stride is the distance in bytes
+    // between output elements, pass 0 for a tightly packed array.
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern nuint RgbToHsvBatch([In] RgbColor[] rgb, [Out] HsvSpace[] hsv, nuint count, nuint stride);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern nuint RgbToHslBatch([In] RgbColor[] rgb, [Out] HslSpace[] hsl, nuint count, nuint stride);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern nuint RgbToCmykBatch([In] RgbColor[] rgb, [Out] CmykSpace[] cmyk, nuint count, nuint stride);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern nuint RgbToXyzBatch([In] RgbColor[] rgb, [Out] XyzSpace[] xyz, nuint count, nuint stride);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern nuint RgbToLabBatch([In] RgbColor[] rgb, [Out] LabSpace[] lab, nuint count, nuint stride);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern nuint RgbToLuvBatch([In] RgbColor[] rgb, [Out] LuvSpace[] luv, nuint count, nuint stride);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern nuint RgbToLchBatch([In] RgbColor[] rgb, [Out] LchSpace[] lch, nuint count, nuint stride);
+
+    // --- Parallel (multithreaded) Batch Conversions ---
+    // Same arguments and results as the *Batch forms, split across the library's worker pool.
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern nuint RgbToHsvParallel([In] RgbColor[] rgb, [Out] HsvSpace[] hsv, nuint count, nuint stride);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern nuint RgbToHslParallel([In] RgbColor[] rgb, [Out] HslSpace[] hsl, nuint count, nuint stride);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern nuint RgbToCmykParallel([In] RgbColor[] rgb, [Out] CmykSpace[] cmyk, nuint count, nuint stride);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern nuint RgbToXyzParallel([In] RgbColor[] rgb, [Out] XyzSpace[] xyz, nuint count, nuint stride);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern nuint RgbToLabParallel([In] RgbColor[] rgb, [Out] LabSpace[] lab, nuint count, nuint stride);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern nuint RgbToLuvParallel([In] RgbColor[] rgb, [Out] LuvSpace[] luv, nuint count, nuint stride);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern nuint RgbToLchParallel([In] RgbColor[] rgb, [Out] LchSpace[] lch, nuint count, nuint stride);
+
+    // --- Float (single precision) variants ---
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern HsvSpaceF RgbToHsvF(RgbColor rgb);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern RgbColor HsvFToRgb(HsvSpaceF hsv);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern nuint RgbToHsvFBatch([In] RgbColor[] rgb, [Out] HsvSpaceF[] hsv, nuint count, nuint stride);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern nuint HsvFToRgbBatch([In] HsvSpaceF[] hsv, [Out] RgbColor[] rgb, nuint count, nuint stride);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern HslSpaceF RgbToHslF(RgbColor rgb);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern RgbColor HslFToRgb(HslSpaceF hsl);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern nuint RgbToHslFBatch([In] RgbColor[] rgb, [Out] HslSpaceF[] hsl, nuint count, nuint stride);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern nuint HslFToRgbBatch([In] HslSpaceF[] hsl, [Out] RgbColor[] rgb, nuint count, nuint stride);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern CmykSpaceF RgbToCmykF(RgbColor rgb);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern RgbColor CmykFToRgb(CmykSpaceF cmyk);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern nuint RgbToCmykFBatch([In] RgbColor[] rgb, [Out] CmykSpaceF[] cmyk, nuint count, nuint stride);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern nuint CmykFToRgbBatch([In] CmykSpaceF[] cmyk, [Out] RgbColor[] rgb, nuint count, nuint stride);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern XyzSpaceF RgbToXyzF(RgbColor rgb);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern RgbColor XyzFToRgb(XyzSpaceF xyz);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern nuint RgbToXyzFBatch([In] RgbColor[] rgb, [Out] XyzSpaceF[] xyz, nuint count, nuint stride);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern nuint XyzFToRgbBatch([In] XyzSpaceF[] xyz, [Out] RgbColor[] rgb, nuint count, nuint stride);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern LabSpaceF RgbToLabF(RgbColor rgb);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern RgbColor LabFToRgb(LabSpaceF lab);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern nuint RgbToLabFBatch([In] RgbColor[] rgb, [Out] LabSpaceF[] lab, nuint count, nuint stride);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern nuint LabFToRgbBatch([In] LabSpaceF[] lab, [Out] RgbColor[] rgb, nuint count, nuint stride);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern LuvSpaceF RgbToLuvF(RgbColor rgb);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern RgbColor LuvFToRgb(LuvSpaceF luv);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern nuint RgbToLuvFBatch([In] RgbColor[] rgb, [Out] LuvSpaceF[] luv, nuint count, nuint stride);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern nuint LuvFToRgbBatch([In] LuvSpaceF[] luv, [Out] RgbColor[] rgb, nuint count, nuint stride);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern LchSpaceF RgbToLchF(RgbColor rgb);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern RgbColor LchFToRgb(LchSpaceF lch);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern nuint RgbToLchFBatch([In] RgbColor[] rgb, [Out] LchSpaceF[] lch, nuint count, nuint stride);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern nuint LchFToRgbBatch([In] LchSpaceF[] lch, [Out] RgbColor[] rgb, nuint count, nuint stride);
+
+    // --- Planar (structure of arrays) buffers ---
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern nuint RgbDeinterleave([In] RgbColor[] rgb, [Out] byte[] r, [Out] byte[] g, [Out] byte[] b, [Out] byte[]? a, nuint count);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern nuint RgbInterleave([In] byte[] r, [In] byte[] g, [In] byte[] b, [In] byte[]? a, [Out] RgbColor[] rgb, nuint count);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern nuint LabDeinterleave([In] LabSpace[] lab, [Out] double[] l, [Out] double[] a, [Out] double[] b, nuint count);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern nuint LabInterleave([In] double[] l, [In] double[] a, [In] double[] b, [Out] LabSpace[] lab, nuint count);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern nuint RgbPlanarToLabPlanar([In] byte[] r, [In] byte[] g, [In] byte[] b, [Out] double[] lOut, [Out] double[] aOut, [Out] double[] bOut, nuint count);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern nuint RgbPlanarToLabPlanarF([In] byte[] r, [In] byte[] g, [In] byte[] b, [Out] float[] lOut, [Out] float[] aOut, [Out] float[] bOut, nuint count);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern nuint LabPlanarToRgbPlanar([In] double[] l, [In] double[] a, [In] double[] b, [Out] byte[] rOut, [Out] byte[] gOut, [Out] byte[] bOut, nuint count);
+
+    // --- Delta-E (color difference) ---
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern double DeltaE76(LabSpace lab1, LabSpace lab2);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern double DeltaE94(LabSpace reference, LabSpace sample);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern double DeltaE2000(LabSpace lab1, LabSpace lab2);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern double DeltaE(LabSpace lab1, LabSpace lab2, DeltaEType type);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern nuint DeltaEPairs([In] LabSpace[] lab1, [In] LabSpace[] lab2, [Out] double[] result, nuint count, DeltaEType type);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern nuint DeltaEOneToMany(LabSpace reference, [In] LabSpace[] samples, [Out] double[] result, nuint count, DeltaEType type);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern nuint DeltaENearest(LabSpace reference, [In] LabSpace[] samples, nuint count, DeltaEType type, out double distance);
+
+    // --- Palette Index (nearest palette color) ---
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern IntPtr PaletteIndexCreate([In] RgbColor[] palette, nuint count);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern void PaletteIndexFree(IntPtr index);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern nuint PaletteIndexCount(IntPtr index);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern nuint PaletteIndexNearestLab(IntPtr index, LabSpace lab, DeltaEType type, out double distance);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern nuint PaletteIndexNearest(IntPtr index, RgbColor rgb, DeltaEType type, out double distance);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern nuint PaletteIndexNearestBatch(IntPtr index, [In] RgbColor[] rgb, [Out] nuint[] result, [Out] double[]? distances, nuint count, DeltaEType type);
+
+    // --- Palette Cache (precomputed RGB -> palette index) ---
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern IntPtr PaletteCacheCreate([In] RgbColor[] palette, nuint count, DeltaEType type, PaletteCacheMode mode);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern void PaletteCacheFree(IntPtr cache);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
+    public static extern int PaletteCacheSave(IntPtr cache, string path);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
+    public static extern IntPtr PaletteCacheLoad(string path);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern int PaletteCacheGetInfo(IntPtr cache, out PaletteCacheInfo info);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern RgbColor PaletteCacheColor(IntPtr cache, nuint entry);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern nuint PaletteCacheLookup(IntPtr cache, RgbColor rgb);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern nuint PaletteCacheLookupBatch(IntPtr cache, [In] RgbColor[] rgb, [Out] nuint[] result, nuint count);
+
+    // --- Gamut Mapping (LCH -> sRGB with chroma reduction) ---
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern int LchInGamut(LchSpace lch);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern double LchMaxChroma(double l, double h);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern RgbColor LchToRgbMapped(LchSpace lch, GamutMapMethod method);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern nuint LchToRgbMappedBatch([In] LchSpace[] lch, [Out] RgbColor[] rgb, nuint count, nuint stride, GamutMapMethod method);
+
+    // --- Gradients (color ramps) ---
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern nuint GradientFill([In] RgbColor[] anchors, [In] double[]? positions, nuint anchorCount, [Out] RgbColor[] output, nuint count, nuint stride, GradientSpace space);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern IntPtr GradientLutCreate([In] RgbColor[] anchors, [In] double[]? positions, nuint anchorCount, nuint size, GradientSpace space);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern void GradientLutFree(IntPtr lut);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern RgbColor GradientLutSample(IntPtr lut, double t);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern nuint GradientLutSampleBatch(IntPtr lut, [In] double[] t, [Out] RgbColor[] output, nuint count, nuint stride);
+
+    // --- Quantization (image -> palette + index map, up to 256 colors) ---
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern nuint QuantizeImage([In] RgbColor[] pixels, nuint count, [Out] RgbColor[] palette, nuint maxColors, [Out] byte[]? indexes, QuantizeMethod method);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern nuint QuantizeRemap([In] RgbColor[] pixels, nuint count, [In] RgbColor[] palette, nuint paletteCount, [Out] byte[] indexes);
+
+    // --- Dithering (Floyd-Steinberg, Atkinson, Bayer) ---
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern int DitherImage([In] RgbColor[] pixels, nuint width, nuint height, nuint stride, [In] RgbColor[] palette, nuint paletteCount, [Out] byte[]? indexes, [Out] RgbColor[]? output, DitherMethod method, DitherScan scan);
+
+    // --- ANSI SGR Sequences (24-bit, 256 and 16 color) ---
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern nuint AnsiSgrColor(RgbColor rgb, [MarshalAs(UnmanagedType.Bool)] bool background, AnsiColorMode mode, [Out] byte[] buffer, nuint bufferSize);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern byte AnsiNearest256(RgbColor rgb);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern byte AnsiNearest16(RgbColor rgb);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern RgbColor Ansi256ToRgb(byte index);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern void SetConsoleColorMode(AnsiColorMode mode);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern AnsiColorMode GetConsoleColorMode();
+
+    // --- ANSI Render Buffer (one write per frame) ---
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern IntPtr AnsiBufferCreate(nuint capacity);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern void AnsiBufferFree(IntPtr buffer);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern int AnsiBufferSetColorMode(IntPtr buffer, AnsiColorMode mode);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern int AnsiBufferSetFg(IntPtr buffer, RgbColor fg);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern int AnsiBufferSetBg(IntPtr buffer, RgbColor bg);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern int AnsiBufferSetColors(IntPtr buffer, RgbColor bg, RgbColor fg);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern int AnsiBufferResetColor(IntPtr buffer);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern int AnsiBufferWrite(IntPtr buffer, [In] byte[] text, nuint length);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern int AnsiBufferPuts(IntPtr buffer, [MarshalAs(UnmanagedType.LPUTF8Str)] string text);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern int AnsiBufferMoveTo(IntPtr buffer, uint row, uint column);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern int AnsiBufferFlush(IntPtr buffer);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern void AnsiBufferClear(IntPtr buffer);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern IntPtr AnsiBufferData(IntPtr buffer, out nuint length);
+
+    // --- ANSI Half Block Image Renderer ---
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern IntPtr AnsiImageCreate(nuint width, nuint height);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern void AnsiImageFree(IntPtr image);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern int AnsiImageRender(IntPtr image, [In] RgbColor[] pixels, nuint stride, uint row, uint column, IntPtr output);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern void AnsiImageInvalidate(IntPtr image);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern int AnsiImageGetStats(IntPtr image, out AnsiImageStats stats);
+
+    // --- White Points / Chromatic Adaptation ---
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern int WhitePointRegister(WhitePoint wp, out WhitePointType id);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern int WhitePointGet(WhitePointType id, out WhitePoint wp);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern int ChromaticAdaptationMatrix(WhitePointType source, WhitePointType destination, ChromaticAdaptationType cat, [Out] double[] matrix);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern XyzSpace XyzAdapt(XyzSpace xyz, WhitePointType source, WhitePointType destination, ChromaticAdaptationType cat);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern nuint XyzAdaptBatch([In] XyzSpace[] xyz, [Out] XyzSpace[] output, nuint count, nuint stride, WhitePointType source, WhitePointType destination, ChromaticAdaptationType cat);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern LabSpace RgbToLabEx(RgbColor rgb, WhitePointType wp, ChromaticAdaptationType cat);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern RgbColor LabToRgbEx(LabSpace lab, WhitePointType wp, ChromaticAdaptationType cat);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern nuint RgbToLabExBatch([In] RgbColor[] rgb, [Out] LabSpace[] lab, nuint count, nuint stride, WhitePointType wp, ChromaticAdaptationType cat);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern nuint LabToRgbExBatch([In] LabSpace[] lab, [Out] RgbColor[] rgb, nuint count, nuint stride, WhitePointType wp, ChromaticAdaptationType cat);
+
+    // --- Conversion Plans ---
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern nuint ColorSpaceSize(ColorSpaceType space);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern IntPtr ConversionPlanCreate(ColorSpaceType source, ColorSpaceType destination, WhitePointType wp, ChromaticAdaptationType cat);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern void ConversionPlanFree(IntPtr plan);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern int ConversionPlanConvert(IntPtr plan, IntPtr input, IntPtr output);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern nuint ConversionPlanConvertBatch(IntPtr plan, IntPtr input, IntPtr output, nuint count, nuint stride);
+
+    // --- 16-bit fixed point variants ---
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern HsvSpaceU16 RgbToHsvU16(RgbColor rgb);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern RgbColor HsvU16ToRgb(HsvSpaceU16 hsv);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern nuint RgbToHsvU16Batch([In] RgbColor[] rgb, [Out] HsvSpaceU16[] hsv, nuint count, nuint stride);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern nuint HsvU16ToRgbBatch([In] HsvSpaceU16[] hsv, [Out] RgbColor[] rgb, nuint count, nuint stride);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern HslSpaceU16 RgbToHslU16(RgbColor rgb);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern RgbColor HslU16ToRgb(HslSpaceU16 hsl);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern nuint RgbToHslU16Batch([In] RgbColor[] rgb, [Out] HslSpaceU16[] hsl, nuint count, nuint stride);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern nuint HslU16ToRgbBatch([In] HslSpaceU16[] hsl, [Out] RgbColor[] rgb, nuint count, nuint stride);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern CmykSpaceU16 RgbToCmykU16(RgbColor rgb);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern RgbColor CmykU16ToRgb(CmykSpaceU16 cmyk);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern nuint RgbToCmykU16Batch([In] RgbColor[] rgb, [Out] CmykSpaceU16[] cmyk, nuint count, nuint stride);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern nuint CmykU16ToRgbBatch([In] CmykSpaceU16[] cmyk, [Out] RgbColor[] rgb, nuint count, nuint stride);
+
     // --- Integer / Decimal Conversions ---
 
     [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
@@ -160,6 +893,32 @@ internal static class ColorApi
     [DllImport(DllName, CallingConvention = CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
     internal static extern nint RgbToRgbHex(RgbColor rgb, [MarshalAs(UnmanagedType.I1)] bool includeAlpha);
 
+    // Caller buffer forms, no native allocation and no ChizlFree.  buffer is ASCII, 8 bytes for
+    // "#RRGGBB\0", 10 for "#AARRGGBB\0".  The batch writes color i at i * 8 (or i * 10).
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern nuint RgbToRgbHexInto(RgbColor rgb, [MarshalAs(UnmanagedType.Bool)] bool includeAlpha, [Out] byte[] buffer, nuint bufferSize);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern nuint RgbToRgbHexBatch([In] RgbColor[] rgb, [Out] byte[] output, nuint count, [MarshalAs(UnmanagedType.Bool)] bool includeAlpha, byte separator);
+
+    // --- Hex / Decimal Parsing ---
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern int RgbFromHex([MarshalAs(UnmanagedType.LPStr)] string hex, out RgbColor rgb);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern RgbColor RgbFromRgbDec(uint rgb);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern RgbColor RgbFromArgbDec(uint argb);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern int RgbFromDecString([MarshalAs(UnmanagedType.LPStr)] string text, [MarshalAs(UnmanagedType.Bool)] bool includeAlpha, out RgbColor rgb);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern nuint RgbFromHexBatch([In] byte[] text, nuint length, [Out] RgbColor[] rgb, nuint maxCount, out nuint consumed);
+
     // --- Set Console Colors by struct ---
 
     [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
@@ -181,6 +940,21 @@ internal static class ColorApi
     [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
     public static extern void ChizlFree(IntPtr ptr);
 
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern SimdLevel ChizlGetSimdLevel();
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern SimdLevel ChizlSetSimdLevel(SimdLevel maxLevel);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern nuint ChizlGetThreadCount();
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern nuint ChizlSetThreadCount(nuint threadCount);
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern void ChizlStopThreads();
+
     [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
     public static extern void ResetColor();
 
@@ -0,0 +1,276 @@
+// dither.c
+#include "dither.h"
+#include "palette_index.h"
+#include "palette_index_core.h"  // For PaletteIndexNearestSeeded
+#include "quantize.h"            // For QUANTIZE_MAX_COLORS
+#include "thread_pool.h"
+#include "color_support.h"       // For ChizlGetThreadCount
+#include "chizl_atomic.h"        // For ChizlAtomic, ChizlAtomicLoad, ChizlAtomicStore, ChizlYield
+#include "cie_common.h"          // For RgbToXyz_Core, XyzToLab_White, cbrt
+#include "srgb_linear.h"         // For SrgbLinearTable
+#include <stdlib.h>              // For malloc, calloc, free
+#include <string.h>              // For memset
+
+// Error diffusion keeps one row of RGB error (float) per row in flight, in a ring.  Each row owns
+// its slot until it is done, rows above add into it, then it is cleared for the row 'ring' lines down.
+// Error for the pixels to the right on the same row is carried in locals, never in the slot, so in
+// wavefront mode a row never writes memory the row above it is still adding into.
+//
+// Wavefront: rows are chunks of one on the thread pool, claimed top to bottom.  A row at x waits
+// until the row above has published x + 2 (every kernel reaches x + 1 on the next row), and before
+// starting it waits until the row two below its slot owner is free.  The arithmetic per pixel is
+// the same in every mode, wavefront output matches raster output bit for bit.
+
+#define DITHER_PAD 2            // Slot padding on each side, kernels reach two pixels sideways
+#define DITHER_LAG 2            // Pixels the row above must be ahead
+#define DITHER_PUBLISH 32       // Pixels between wavefront progress updates
+#define DITHER_BAYER_PIXELS (16 * 1024)
+
+static const unsigned char s_bayer[8][8] = {
+    {  0, 32,  8, 40,  2, 34, 10, 42 },
+    { 48, 16, 56, 24, 50, 18, 58, 26 },
+    { 12, 44,  4, 36, 14, 46,  6, 38 },
+    { 60, 28, 52, 20, 62, 30, 54, 22 },
+    {  3, 35, 11, 43,  1, 33,  9, 41 },
+    { 51, 19, 59, 27, 49, 17, 57, 25 },
+    { 15, 47,  7, 39, 13, 45,  5, 37 },
+    { 63, 31, 55, 23, 61, 29, 53, 21 }
+};
+
+typedef struct {
+    const RgbColor* pixels;
+    size_t width;
+    size_t height;
+    size_t rowBytes;
+    const PaletteIndex* index;
+    const RgbColor* palette;
+    unsigned char* indexes;
+    RgbColor* out;
+    DitherMethod method;
+    float* errors;              // 'ring' slots of (width + 2 * DITHER_PAD) * 3 floats
+    size_t ring;
+    size_t slotFloats;
+    ChizlAtomic* progress;      // Wavefront only, pixels done per row
+    float spread;               // Bayer only, threshold amplitude in 8-bit units
+} DitherJob;
+
+static inline float ClampChannel(float v)
+{
+    return (v < 0.0f) ? 0.0f : ((v > 255.0f) ? 255.0f : v);
+}
+
+/// <summary>
+/// Palette entry closest to an (error adjusted, clamped) RGB value, rounded to 8 bits and matched in Lab.
+/// </summary>
+static inline size_t MatchColor(const DitherJob* job, const double* linear, float r, float g, float b, size_t seed)
+{
+    const RgbColor c = { 255, (unsigned char)(r + 0.5f), (unsigned char)(g + 0.5f), (unsigned char)(b + 0.5f) };
+    const LabSpace lab = XyzToLab_White(RgbToXyz_Core(c, linear), WP_D65_FULL);
+    return PaletteIndexNearestSeeded(job->index, lab, DELTAE_CIE76, seed, NULL);
+}
+
+static inline void Emit(const DitherJob* job, size_t at, size_t id)
+{
+    if (job->indexes != NULL)
+        job->indexes[at] = (unsigned char)id;
+    if (job->out != NULL)
+        job->out[at] = job->palette[id];
+}
+
+static inline float* Slot(const DitherJob* job, size_t row)
+{
+    return job->errors + (row % job->ring) * job->slotFloats + DITHER_PAD * 3;
+}
+
+static void WaitProgress(ChizlAtomic* progress, long need)
+{
+    while (ChizlAtomicLoad(progress) < need)
+        ChizlYield();
+}
+
+/// <summary>
+/// Error diffusion over one row.  'reverse' runs it right to left (serpentine odd rows).
+/// </summary>
+static void DiffuseRow(const DitherJob* job, size_t y, int reverse)
+{
+    const double* linear = SrgbLinearTable();
+    const RgbColor* src = (const RgbColor*)((const unsigned char*)job->pixels + y * job->rowBytes);
+    const size_t width = job->width;
+    const ptrdiff_t dir = reverse ? -1 : 1;
+    const int atkinson = job->method == DITHER_ATKINSON;
+
+    // Rows past the bottom still get error added, into slots whose rows are already finished.
+    float* cur = Slot(job, y);
+    float* next = Slot(job, y + 1);
+    float* next2 = Slot(job, y + 2);
+
+    ChizlAtomic* above = NULL;
+    long seen = 0;
+    if (job->progress != NULL)
+    {
+        if (y + 2 >= job->ring)
+            WaitProgress(&job->progress[y + 2 - job->ring], (long)width);
+        if (y > 0)
+            above = &job->progress[y - 1];
+    }
+
+    float c1[3] = { 0.0f, 0.0f, 0.0f };   // Carried to x + dir
+    float c2[3] = { 0.0f, 0.0f, 0.0f };   // Carried to x + 2 * dir (Atkinson)
+    size_t seed = PaletteIndexCount(job->index);
+
+    for (size_t k = 0; k < width; k++)
+    {
+        const size_t x = reverse ? width - 1 - k : k;
+
+        if (above != NULL)
+        {
+            const long need = (long)((width - k > DITHER_LAG) ? k + DITHER_LAG : width);
+            if (seen < need)
+            {
+                WaitProgress(above, need);
+                seen = ChizlAtomicLoad(above);
+            }
+        }
+
+        const float* e = cur + x * 3;
+        const float v[3] = {
+            ClampChannel((float)src[x].red + e[0] + c1[0]),
+            ClampChannel((float)src[x].green + e[1] + c1[1]),
+            ClampChannel((float)src[x].blue + e[2] + c1[2])
+        };
+
+        seed = MatchColor(job, linear, v[0], v[1], v[2], seed);
+        Emit(job, y * width + x, seed);
+
+        const RgbColor q = job->palette[seed];
+        const float err[3] = { v[0] - (float)q.red, v[1] - (float)q.green, v[2] - (float)q.blue };
+        float* n = next + (ptrdiff_t)x * 3;
+
+        for (int ch = 0; ch < 3; ch++)
+        {
+            if (atkinson)
+            {
+                const float part = err[ch] * (1.0f / 8.0f);
+                c1[ch] = c2[ch] + part;
+                c2[ch] = part;
+                n[ch - dir * 3] += part;
+                n[ch] += part;
+                n[ch + dir * 3] += part;
+                next2[x * 3 + ch] += part;
+            }
+            else
+            {
+                c1[ch] = err[ch] * (7.0f / 16.0f);
+                n[ch - dir * 3] += err[ch] * (3.0f / 16.0f);
+                n[ch] += err[ch] * (5.0f / 16.0f);
+                n[ch + dir * 3] += err[ch] * (1.0f / 16.0f);
+            }
+        }
+
+        if (job->progress != NULL && (k + 1) % DITHER_PUBLISH == 0)
+            ChizlAtomicStore(&job->progress[y], (long)(k + 1));
+    }
+
+    // Clear the slot for its next row before telling anyone this row is done.
+    memset(cur - DITHER_PAD * 3, 0, job->slotFloats * sizeof(float));
+    if (job->progress != NULL)
+        ChizlAtomicStore(&job->progress[y], (long)width);
+}
+
+static void WavefrontTask(void* ctx, size_t begin, size_t end)
+{
+    const DitherJob* job = (const DitherJob*)ctx;
+    for (size_t y = begin; y < end; y++)
+        DiffuseRow(job, y, 0);
+}
+
+static void BayerTask(void* ctx, size_t begin, size_t end)
+{
+    const DitherJob* job = (const DitherJob*)ctx;
+    const double* linear = SrgbLinearTable();
+    size_t seed = PaletteIndexCount(job->index);
+
+    for (size_t y = begin; y < end; y++)
+    {
+        const RgbColor* src = (const RgbColor*)((const unsigned char*)job->pixels + y * job->rowBytes);
+        const unsigned char* thresholds = s_bayer[y & 7];
+
+        for (size_t x = 0; x < job->width; x++)
+        {
+            // Threshold centered on zero: -spread / 2 to +spread / 2.
+            const float t = job->spread * (((float)thresholds[x & 7] + 0.5f) * (1.0f / 64.0f) - 0.5f);
+            seed = MatchColor(job, linear,
+                ClampChannel((float)src[x].red + t),
+                ClampChannel((float)src[x].green + t),
+                ClampChannel((float)src[x].blue + t),
+                seed);
+            Emit(job, y * job->width + x, seed);
+        }
+    }
+}
+
+CHIZL_COLORS_API int DitherImage(const RgbColor* pixels, size_t width, size_t height, size_t stride, const RgbColor* palette, size_t paletteCount, unsigned char* indexes, RgbColor* out, DitherMethod method, DitherScan scan)
+{
+    if (pixels == NULL || palette == NULL || (indexes == NULL && out == NULL) || width == 0 || height == 0)
+        return 0;
+    if (paletteCount == 0 || paletteCount > QUANTIZE_MAX_COLORS)
+        return 0;
+    if (method != DITHER_FLOYD_STEINBERG && method != DITHER_ATKINSON && method != DITHER_BAYER)
+        return 0;
+    if (scan != DITHER_SCAN_RASTER && scan != DITHER_SCAN_SERPENTINE && scan != DITHER_SCAN_WAVEFRONT)
+        return 0;
+
+    DitherJob job;
+    memset(&job, 0, sizeof(job));
+    job.pixels = pixels;
+    job.width = width;
+    job.height = height;
+    job.rowBytes = stride ? stride : width * sizeof(RgbColor);
+    job.palette = palette;
+    job.indexes = indexes;
+    job.out = out;
+    job.method = method;
+
+    PaletteIndex* index = PaletteIndexCreate(palette, paletteCount);
+    if (index == NULL)
+        return 0;
+    job.index = index;
+
+    if (method == DITHER_BAYER)
+    {
+        // About one step between palette levels per channel, 255 / cbrt(N) for a palette spread over the cube.
+        job.spread = (float)(255.0 / cbrt((double)paletteCount));
+
+        const size_t rows = (width < DITHER_BAYER_PIXELS) ? DITHER_BAYER_PIXELS / width : 1;
+        ChizlParallelFor(height, rows, BayerTask, (void*)&job);
+        PaletteIndexFree(index);
+        return 1;
+    }
+
+    // Progress counters are longs, wider rows fall back to one thread.
+    if (scan == DITHER_SCAN_WAVEFRONT && width > 0x7FFFFFFF)
+        scan = DITHER_SCAN_RASTER;
+
+    job.ring = (scan == DITHER_SCAN_WAVEFRONT) ? ChizlGetThreadCount() + 3 : 3;
+    job.slotFloats = (width + 2 * DITHER_PAD) * 3;
+    job.errors = (float*)calloc(job.ring * job.slotFloats, sizeof(float));
+    if (scan == DITHER_SCAN_WAVEFRONT)
+        job.progress = (ChizlAtomic*)calloc(height, sizeof(ChizlAtomic));
+
+    int ok = job.errors != NULL && (scan != DITHER_SCAN_WAVEFRONT || job.progress != NULL);
+    if (ok)
+    {
+        if (scan == DITHER_SCAN_WAVEFRONT)
+            ChizlParallelFor(height, 1, WavefrontTask, (void*)&job);
+        else
+        {
+            for (size_t y = 0; y < height; y++)
+                DiffuseRow(&job, y, scan == DITHER_SCAN_SERPENTINE && (y & 1) != 0);
+        }
+    }
+
+    free((void*)job.progress);
+    free(job.errors);
+    PaletteIndexFree(index);
+    return ok;
+}
@@ -0,0 +1,78 @@
+// dither.h
+
+#pragma once
+
+#ifndef DITHER_H
+#define DITHER_H
+
+// --- Start of "extern C" block ---
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "import_exports.h"
+#include "chizl_colors_types.h"
+#include <stddef.h>             // For size_t
+
+/// <summary>
+/// Dithering algorithms for DitherImage.
+/// </summary>
+typedef enum {
+    /// <summary>
+    /// Floyd-Steinberg error diffusion: 7/16 right, 3/16, 5/16 and 1/16 to the row below.
+    /// </summary>
+    DITHER_FLOYD_STEINBERG = 0,
+    /// <summary>
+    /// Atkinson error diffusion: 1/8 to six neighbors over the next two rows, the remaining 2/8 is
+    /// dropped.  Less noise, more contrast, loses detail in the darkest and brightest areas.
+    /// </summary>
+    DITHER_ATKINSON = 1,
+    /// <summary>
+    /// 8x8 Bayer ordered dithering.  Every pixel is independent, so it always runs on the thread pool,
+    /// and the pattern is stable from frame to frame (no crawling noise in animations).
+    /// </summary>
+    DITHER_BAYER = 2
+} DitherMethod;
+
+/// <summary>
+/// Scan order for the error diffusion methods.  Ignored by DITHER_BAYER.
+/// </summary>
+typedef enum {
+    /// <summary>
+    /// Every row left to right on the calling thread.
+    /// </summary>
+    DITHER_SCAN_RASTER = 0,
+    /// <summary>
+    /// Rows alternate direction (boustrophedon) on the calling thread, breaks up the diagonal artifacts of a raster scan.
+    /// </summary>
+    DITHER_SCAN_SERPENTINE = 1,
+    /// <summary>
+    /// Raster order on the thread pool: each row starts as soon as the row above is two pixels ahead
+    /// of it, so rows run in a diagonal wavefront.  Same output as DITHER_SCAN_RASTER.
+    /// </summary>
+    DITHER_SCAN_WAVEFRONT = 2
+} DitherScan;
+
+/// <summary>
+/// Maps an image to a palette with dithering.  Each (error adjusted) pixel is matched to the closest
+/// palette color in Lab (CIE76, the PaletteIndex search), the error is carried in RGB.<br/>
+/// Alpha is ignored.  Error diffusion keeps a few rows of error in memory, not a full image plane.
+/// </summary>
+/// <param name="pixels">Pointer to the image, row by row.</param>
+/// <param name="width">Image width in pixels.</param>
+/// <param name="height">Image height in pixels.</param>
+/// <param name="stride">Distance in bytes between pixel rows, 0 for width * sizeof(RgbColor).</param>
+/// <param name="palette">Pointer to the palette colors.</param>
+/// <param name="paletteCount">Number of palette colors, 1 to 256.</param>
+/// <param name="indexes">Optional, pointer to width * height bytes to receive the palette index of each pixel.  May be NULL.</param>
+/// <param name="out">Optional, pointer to width * height colors to receive the dithered image (palette colors).  May be NULL.</param>
+/// <param name="method">Dithering algorithm.</param>
+/// <param name="scan">Scan order for error diffusion.</param>
+/// <returns>1 on success, 0 on bad arguments (including both indexes and out NULL) or out of memory.</returns>
+CHIZL_COLORS_API int DitherImage(const RgbColor* pixels, size_t width, size_t height, size_t stride, const RgbColor* palette, size_t paletteCount, unsigned char* indexes, RgbColor* out, DitherMethod method, DitherScan scan);
+
+// --- End of "extern C" block ---
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -0,0 +1,19 @@
+// dllmain.cpp
+// Compiled as C with the rest of the library (CompileAsC), the .cpp name is the Visual Studio template's.
+#if defined(_WIN32) || defined(_WIN64)
+#ifndef WIN32_LEAN_AND_MEAN
+  #define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+
+// Nothing to stop on DLL_PROCESS_DETACH: the pool's workers are _beginthreadex threads, each holding a
+// reference on this DLL until it exits, so FreeLibrary only gets here once they are already gone.
+// Callers that unload the library stop them first with ChizlStopThreads (color_support.h).
+BOOL APIENTRY DllMain(HMODULE module, DWORD reason, LPVOID reserved)
+{
+    (void)reserved;
+    if (reason == DLL_PROCESS_ATTACH)
+        DisableThreadLibraryCalls(module);
+    return TRUE;
+}
+#endif
@@ -0,0 +1,32 @@
+// fixed_point.c
+#include "fixed_point.h"
+#include "chizl_once.h"
+
+static uint64_t s_hueRecip[256];
+static uint64_t s_ratioRecip[256];
+static ChizlOnce s_recipOnce = CHIZL_ONCE_INIT;
+
+static void BuildRecipTables(void)
+{
+    s_hueRecip[0] = 0;
+    s_ratioRecip[0] = 0;
+    for (uint64_t d = 1; d < 256; d++)
+    {
+        const uint64_t hueScale = ((uint64_t)1 << (16 + FIXED_RECIP_SHIFT));
+        const uint64_t ratioScale = (uint64_t)65535 << FIXED_RECIP_SHIFT;
+        s_hueRecip[d] = (hueScale + 6 * d - 1) / (6 * d);
+        s_ratioRecip[d] = (ratioScale + d - 1) / d;
+    }
+}
+
+const uint64_t* FixedHueRecipTable(void)
+{
+    ChizlRunOnce(&s_recipOnce, BuildRecipTables);
+    return s_hueRecip;
+}
+
+const uint64_t* FixedRatioRecipTable(void)
+{
+    ChizlRunOnce(&s_recipOnce, BuildRecipTables);
+    return s_ratioRecip;
+}
@@ -0,0 +1,102 @@
+// fixed_point.h
+#pragma once
+
+#ifndef FIXED_POINT_H
+#define FIXED_POINT_H
+
+// Internal only, not part of the public API.
+// Integer helpers for the 16-bit HSV / HSL / CMYK variants.  Every division in those conversions has a
+// numerator and divisor that come from 8-bit channels, so each one is a lookup of a 256 entry reciprocal
+// table and a multiply.  The reciprocals are rounded up with 24 fraction bits, which keeps the rounded
+// result equal to the exact rounded division for every input in range (the table is too precise to ever
+// cross a rounding boundary the exact quotient does not).
+
+#include "chizl_colors_types.h"
+#include <stdint.h>             // For uint64_t
+
+#define FIXED_RECIP_SHIFT 24
+
+/// <summary>
+/// [d] = ceil(2^40 / (6 * d)), [0] = 0.  Hue position n (0 .. 6 * delta) to 0 - 65536 with FixedDivRound.
+/// </summary>
+const uint64_t* FixedHueRecipTable(void);
+
+/// <summary>
+/// [d] = ceil(65535 * 2^24 / d), [0] = 0.  A channel ratio n / d (n <= d) to 0 - 65535 with FixedDivRound.
+/// </summary>
+const uint64_t* FixedRatioRecipTable(void);
+
+/// <summary>
+/// n times a reciprocal from the tables above, rounded to the nearest integer (halves up).
+/// </summary>
+static inline unsigned int FixedDivRound(unsigned int n, uint64_t recip)
+{
+    return (unsigned int)(((uint64_t)n * recip + (1u << (FIXED_RECIP_SHIFT - 1))) >> FIXED_RECIP_SHIFT);
+}
+
+/// <summary>
+/// 16-bit hue of a color, from its max channel and max - min.  Same sectors as the double RgbToHsv:
+/// red max at 0, green max at 2 * delta, blue max at 4 * delta, on a circle of 6 * delta.
+/// </summary>
+static inline unsigned short FixedHue(int r, int g, int b, int max, int delta, const uint64_t* hueRecip)
+{
+    int n;
+    if (r == max)
+        n = g - b + ((g < b) ? 6 * delta : 0);
+    else if (g == max)
+        n = 2 * delta + b - r;
+    else
+        n = 4 * delta + r - g;
+
+    // n < 6 * delta, so the result stays below 65536.
+    return (unsigned short)FixedDivRound((unsigned int)n, hueRecip[delta]);
+}
+
+/// <summary>
+/// RGB from a 16-bit hue, the max channel and max - min.  The inverse of FixedHue: the hue position
+/// is recovered exactly for any hue FixedHue produced, then the sector picks which channel rises or falls.
+/// </summary>
+static inline RgbColor FixedHueToRgb(unsigned int hue, int max, int delta)
+{
+    const int circle = 6 * delta;
+    int n = (int)((hue * (unsigned int)circle + 32768u) >> 16);
+    if (n >= circle)
+        n -= circle;
+
+    // Sector without a divide, delta 0 (gray) lands on a sector where all three channels are max.
+    const int sector = (n >= delta) + (n >= 2 * delta) + (n >= 3 * delta) + (n >= 4 * delta) + (n >= 5 * delta);
+    const int f = n - sector * delta;
+    const int min = max - delta;
+
+    int r, g, b;
+    switch (sector)
+    {
+    case 0: r = max; g = min + f; b = min; break;
+    case 1: r = max - f; g = max; b = min; break;
+    case 2: r = min; g = max; b = min + f; break;
+    case 3: r = min; g = max - f; b = max; break;
+    case 4: r = min + f; g = min; b = max; break;
+    default: r = max; g = min; b = max - f; break;
+    }
+
+    RgbColor rgb = { 255, (unsigned char)r, (unsigned char)g, (unsigned char)b };
+    return rgb;
+}
+
+/// <summary>
+/// 0 - 65535 back to 0 - 255 (the inverse of * 257), rounded.
+/// </summary>
+static inline int FixedTo8(unsigned int v16)
+{
+    return (int)((v16 + 128u) / 257u);
+}
+
+/// <summary>
+/// ratio16 (0 - 65535) of 'whole', rounded.  Inverse of FixedDivRound with FixedRatioRecipTable.
+/// </summary>
+static inline int FixedRatioOf(unsigned int ratio16, int whole)
+{
+    return (int)((ratio16 * (unsigned int)whole + 32767u) / 65535u);
+}
+
+#endif
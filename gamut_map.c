@@ -0,0 +1,479 @@
+// gamut_map.c
+#include "gamut_map.h"
+#include "cie_common.h"         // For LchToLab_Core, LabToXyz_White, XyzToLinearRgb_Core, LinearRgbToRgb_Core
+#include "chizl_once.h"
+#include "thread_pool.h"
+#include "common.h"             // For stridedAt, isPackedStride
+#include <math.h>               // For floor, fmod, fmin, fmax, sqrt, fabs, cos, sin
+
+// Both mappings hold L* and h and only reduce chroma.  In CIE LCH the sRGB gamut is not a simple
+// shell around the neutral axis: between the yellow and green corners, just below white, an L*, h
+// line leaves the gamut, comes back in and leaves again, and the outer section can be arbitrarily
+// narrow where it starts (L* 96.9, h 102.7: in gamut up to C 29.1, again from 95.25 to 96.70).
+// Neither a binary search nor a fixed step scan on chroma can be trusted there, so the boundary is
+// solved for instead:  for a fixed L* and h, fy is constant and fx, fz are linear in chroma, so X and
+// Z are cubics of chroma above the Lab toe (f > 6/29) and lines below it.  Each linear RGB channel is
+// a piecewise cubic with at most two breaks.  Splitting the chroma range at the breaks and at every
+// channel's turning points leaves segments where all three channels are monotone, and within each
+// segment the in gamut chromas form one interval whose ends are the channels' 0 / 1 crossings.
+
+// Linear RGB slack for "in gamut", absorbs the rounding of the Lab -> XYZ -> RGB chain.
+#define GAMUT_EPS 1e-9
+
+// Upper bound for the chroma searches, sRGB tops out near 134 (blue).
+#define GAMUT_MAX_CHROMA 150.0
+
+// Turning points and breaks per line: 2 breaks, up to 6 candidates per channel, plus both ends.
+#define GAMUT_MAX_SPLITS 24
+
+// CSS Color 4 constants, scaled from OKLCh (JND 0.02, epsilon 0.0001) to CIE Lab (about 100x).
+#define GAMUT_JND 2.0
+#define GAMUT_CSS_EPS 0.01
+
+#define GAMUT_TABLE_L 101       // L* 0 to 100, step 1
+#define GAMUT_TABLE_H 360       // h 0 to 359, step 1, wraps
+#define GAMUT_TABLE_JUMP 8.0     // Corner spread that marks a cell the boundary jumps across
+#define GAMUT_TABLE_SLACK 0.05   // Largest chroma shortfall accepted from the interpolated table
+
+static double s_maxChroma[GAMUT_TABLE_L][GAMUT_TABLE_H];
+static unsigned char s_reentrant[GAMUT_TABLE_L][GAMUT_TABLE_H];   // Grid point has more than one in gamut section
+static ChizlOnce s_tableOnce = CHIZL_ONCE_INIT;
+
+typedef struct {
+    double fy;                  // Constant along the line
+    double ka, kb;              // fx = fy + ka * C, fz = fy - kb * C
+    double x[3], z[3];          // Each channel's X and Z weight (matrix times white / 100)
+    double y[3];                // Each channel's fixed Y share
+} GamutLine;
+
+static inline void LchToLinear(LchSpace lch, double* r, double* g, double* b)
+{
+    XyzToLinearRgb_Core(LabToXyz_White(LchToLab_Core(lch), WP_D65_FULL), r, g, b);
+}
+
+static inline int LinearInGamut(double r, double g, double b)
+{
+    return r >= -GAMUT_EPS && r <= 1.0 + GAMUT_EPS &&
+           g >= -GAMUT_EPS && g <= 1.0 + GAMUT_EPS &&
+           b >= -GAMUT_EPS && b <= 1.0 + GAMUT_EPS;
+}
+
+static inline double WrapHue(double h)
+{
+    h = fmod(h, 360.0);
+    return (h < 0.0) ? h + 360.0 : h;
+}
+
+static inline double ToeSlope(double t)
+{
+    const double delta = 6.0 / 29.0;
+    return (t > delta) ? 3.0 * t * t : 3.0 * delta * delta;
+}
+
+static void MakeLine(double l, double h, GamutLine* line)
+{
+    // Matrix columns straight from XyzToLinearRgb_Core, so both paths share one set of constants.
+    const XyzSpace ex = { WP_D65_FULL.x, 0.0, 0.0 };
+    const XyzSpace ez = { 0.0, 0.0, WP_D65_FULL.z };
+    const double hr = h * (CHIZL_PI / 180.0);
+    double ey[3];
+
+    line->fy = (l + 16.0) / 116.0;
+    line->ka = cos(hr) / 500.0;
+    line->kb = sin(hr) / 200.0;
+
+    XyzToLinearRgb_Core(ex, &line->x[0], &line->x[1], &line->x[2]);
+    XyzToLinearRgb_Core(ez, &line->z[0], &line->z[1], &line->z[2]);
+    const XyzSpace ey100 = { 0.0, WP_D65_FULL.y * lab_f_inv(line->fy), 0.0 };
+    XyzToLinearRgb_Core(ey100, &ey[0], &ey[1], &ey[2]);
+    for (int i = 0; i < 3; i++)
+        line->y[i] = ey[i];
+}
+
+static inline double ChannelAt(const GamutLine* line, int i, double c)
+{
+    return line->x[i] * lab_f_inv(line->fy + line->ka * c) + line->y[i] + line->z[i] * lab_f_inv(line->fy - line->kb * c);
+}
+
+static inline double ChannelSlope(const GamutLine* line, int i, double c)
+{
+    return line->x[i] * line->ka * ToeSlope(line->fy + line->ka * c) - line->z[i] * line->kb * ToeSlope(line->fy - line->kb * c);
+}
+
+static inline void AddSplit(double* splits, int* n, double c, double top)
+{
+    if (c > 0.0 && c < top && *n < GAMUT_MAX_SPLITS)
+        splits[(*n)++] = c;
+}
+
+/// <summary>
+/// Chromas in (0, top) where a channel can turn around or change formula.  The slope is
+/// A * g'(fx) - B * g'(fz) with g' = 3 f^2 above the toe and 3 delta^2 below it, each combination
+/// solves as linear equations.  Candidates from the wrong side of the toe are harmless extra splits.
+/// </summary>
+static int LineSplits(const GamutLine* line, double top, double* splits)
+{
+    const double delta = 6.0 / 29.0;
+    int n = 0;
+
+    if (line->ka != 0.0)
+        AddSplit(splits, &n, (delta - line->fy) / line->ka, top);
+    if (line->kb != 0.0)
+        AddSplit(splits, &n, (line->fy - delta) / line->kb, top);
+
+    for (int i = 0; i < 3; i++)
+    {
+        const double a = line->x[i] * line->ka;
+        const double b = line->z[i] * line->kb;
+        if (a * b <= 0.0)
+            continue;               // Slope never changes sign
+
+        const double ra = sqrt(fabs(a));
+        const double rb = sqrt(fabs(b));
+        for (int sign = -1; sign <= 1; sign += 2)
+        {
+            // Both above the toe: ra * fx = +-rb * fz.
+            const double den = ra * line->ka + sign * rb * line->kb;
+            if (den != 0.0)
+                AddSplit(splits, &n, line->fy * (sign * rb - ra) / den, top);
+            // One side below the toe: ra * fx = +-rb * delta, or ra * delta = +-rb * fz.
+            if (line->ka != 0.0)
+                AddSplit(splits, &n, (sign * delta * rb / ra - line->fy) / line->ka, top);
+            if (line->kb != 0.0)
+                AddSplit(splits, &n, (line->fy - sign * delta * ra / rb) / line->kb, top);
+        }
+    }
+
+    // Insertion sort, a couple of dozen values at most.
+    for (int i = 1; i < n; i++)
+    {
+        const double v = splits[i];
+        int j = i;
+        for (; j > 0 && splits[j - 1] > v; j--)
+            splits[j] = splits[j - 1];
+        splits[j] = v;
+    }
+    return n;
+}
+
+/// <summary>
+/// Chroma in [lo, hi] where channel i equals 'target', the channel being monotone there and crossing
+/// 'target'.  Newton steps, falling back to bisection whenever a step leaves the bracket.
+/// </summary>
+static double SolveChannel(const GamutLine* line, int i, double target, double lo, double hi)
+{
+    const int rising = ChannelAt(line, i, hi) > ChannelAt(line, i, lo);
+    double c = (lo + hi) * 0.5;
+
+    for (int iter = 0; iter < 100; iter++)
+    {
+        const double f = ChannelAt(line, i, c) - target;
+        if (f == 0.0)
+            return c;
+        if ((f < 0.0) == rising)
+            lo = c;
+        else
+            hi = c;
+
+        const double slope = ChannelSlope(line, i, c);
+        double next = (slope != 0.0) ? c - f / slope : lo - 1.0;
+        if (!(next > lo && next < hi))
+            next = (lo + hi) * 0.5;
+        if (fabs(next - c) <= 1e-14 * (1.0 + c) || hi - lo <= 1e-14 * (1.0 + hi))
+            return next;
+        c = next;
+    }
+    return c;
+}
+
+/// <summary>
+/// In gamut chromas of one monotone segment [s0, s1], narrowed to [*lo, *hi].  Returns 0 if there are none.
+/// </summary>
+static int SegmentInGamut(const GamutLine* line, double s0, double s1, double* lo, double* hi)
+{
+    *lo = s0;
+    *hi = s1;
+    for (int i = 0; i < 3; i++)
+    {
+        const double f0 = ChannelAt(line, i, s0);
+        const double f1 = ChannelAt(line, i, s1);
+        if (fmax(f0, f1) < -GAMUT_EPS || fmin(f0, f1) > 1.0 + GAMUT_EPS)
+            return 0;
+
+        double a, b;
+        if (f1 >= f0)
+        {
+            a = (f0 >= -GAMUT_EPS) ? s0 : SolveChannel(line, i, 0.0, s0, s1);
+            b = (f1 <= 1.0 + GAMUT_EPS) ? s1 : SolveChannel(line, i, 1.0, s0, s1);
+        }
+        else
+        {
+            a = (f0 <= 1.0 + GAMUT_EPS) ? s0 : SolveChannel(line, i, 1.0, s0, s1);
+            b = (f1 >= -GAMUT_EPS) ? s1 : SolveChannel(line, i, 0.0, s0, s1);
+        }
+
+        *lo = fmax(*lo, a);
+        *hi = fmin(*hi, b);
+        if (*lo > *hi)
+            return 0;
+    }
+    return 1;
+}
+
+/// <summary>
+/// Largest in gamut chroma at or below 'c' for the given L* (0 &lt; L* &lt; 100) and h.  Exact up to
+/// rounding, every section however narrow is found.  'sections' (may be NULL) receives the number of
+/// separate in gamut sections in [0, c], which costs a walk down the whole line.
+/// </summary>
+static double ChromaBelow(double l, double h, double c, int* sections)
+{
+    GamutLine line;
+    double splits[GAMUT_MAX_SPLITS + 2];
+
+    MakeLine(l, h, &line);
+    const int n = LineSplits(&line, c, splits + 1) + 2;
+    splits[0] = 0.0;
+    splits[n - 1] = c;
+
+    double best = 0.0;
+    double below = -1.0;        // Bottom of the section being walked down
+    int found = 0;
+    int count = 0;
+
+    for (int k = n - 2; k >= 0; k--)
+    {
+        double lo, hi;
+        if (!SegmentInGamut(&line, splits[k], splits[k + 1], &lo, &hi))
+            continue;
+
+        if (!found)
+        {
+            best = hi;
+            found = 1;
+            if (sections == NULL)
+                break;
+        }
+
+        // A section carries on into the next segment down when it reaches the shared split.
+        if (below < 0.0 || hi < below - GAMUT_EPS)
+            count++;
+        below = lo;
+    }
+
+    if (sections != NULL)
+        *sections = (count > 0) ? count : 1;
+    return best;
+}
+
+static void MaxChromaRows(void* ctx, size_t begin, size_t end)
+{
+    (void)ctx;
+    for (size_t l = begin; l < end; l++)
+    {
+        for (int h = 0; h < GAMUT_TABLE_H; h++)
+        {
+            // The ends of L* are single points (black, white), no chroma at all.
+            int sections = 1;
+            s_maxChroma[l][h] = (l == 0 || l == GAMUT_TABLE_L - 1) ? 0.0 : ChromaBelow((double)l, (double)h, GAMUT_MAX_CHROMA, &sections);
+            s_reentrant[l][h] = (unsigned char)(sections > 1);
+        }
+    }
+}
+
+static void BuildMaxChromaTable(void)
+{
+    ChizlParallelFor(GAMUT_TABLE_L, 1, MaxChromaRows, NULL);
+}
+
+/// <summary>
+/// Bilinear max chroma from the table.  Returns a negative value for cells the boundary jumps across
+/// (next to the yellow and cyan cusps), where interpolating the corners means nothing.
+/// </summary>
+static double MaxChromaTable(double l, double h)
+{
+    const int li = (l >= GAMUT_TABLE_L - 1) ? GAMUT_TABLE_L - 2 : (int)l;
+    const int hi = (int)h % GAMUT_TABLE_H;
+    const int hn = (hi + 1) % GAMUT_TABLE_H;
+
+    // Next to a re-entrant section (one grid step of margin around the points that have one) the
+    // interpolated chroma can sit on the inner section, only the search knows which one is outer.
+    for (int dl = -1; dl <= 2; dl++)
+    {
+        const int row = li + dl;
+        if (row < 0 || row >= GAMUT_TABLE_L)
+            continue;
+        for (int dh = -1; dh <= 2; dh++)
+        {
+            if (s_reentrant[row][(hi + dh + GAMUT_TABLE_H) % GAMUT_TABLE_H])
+                return -1.0;
+        }
+    }
+    const double fl = l - li;
+    const double fh = h - floor(h);
+
+    const double c00 = s_maxChroma[li][hi], c01 = s_maxChroma[li][hn];
+    const double c10 = s_maxChroma[li + 1][hi], c11 = s_maxChroma[li + 1][hn];
+    const double lo = fmin(fmin(c00, c01), fmin(c10, c11));
+    const double top = fmax(fmax(c00, c01), fmax(c10, c11));
+    if (top - lo > GAMUT_TABLE_JUMP)
+        return -1.0;
+
+    const double c0 = c00 + (c01 - c00) * fh;
+    const double c1 = c10 + (c11 - c10) * fh;
+    return c0 + (c1 - c0) * fl;
+}
+
+/// <summary>
+/// Clips linear RGB to the gamut and returns the clipped color as both RgbColor and Lab.
+/// </summary>
+static inline RgbColor Clip(double r, double g, double b, LabSpace* lab)
+{
+    r = clampDbl(r, 0.0, 1.0);
+    g = clampDbl(g, 0.0, 1.0);
+    b = clampDbl(b, 0.0, 1.0);
+    *lab = XyzToLab_White(LinearRgbToXyz_Core(r, g, b), WP_D65_FULL);
+    return LinearRgbToRgb_Core(r, g, b);
+}
+
+static inline double Distance76(LabSpace x, LabSpace y)
+{
+    const double dl = x.l - y.l;
+    const double da = x.a - y.a;
+    const double db = x.b - y.b;
+    return sqrt(dl * dl + da * da + db * db);
+}
+
+/// <summary>
+/// CSS Color 4 "binary search gamut mapping with local MINDE", with CIE LCH in place of OKLCh.
+/// 'lch' is already known to be out of gamut, with 0 &lt; L* &lt; 100.
+/// </summary>
+static RgbColor MapCss(LchSpace lch)
+{
+    double r, g, b;
+    LabSpace clippedLab;
+
+    LchToLinear(lch, &r, &g, &b);
+    RgbColor clipped = Clip(r, g, b, &clippedLab);
+    if (Distance76(clippedLab, LchToLab_Core(lch)) < GAMUT_JND)
+        return clipped;
+
+    double lo = 0.0;
+    double hi = lch.c;
+    int loInGamut = 1;
+
+    while (hi - lo > GAMUT_CSS_EPS)
+    {
+        LchSpace current = lch;
+        current.c = (lo + hi) * 0.5;
+        LchToLinear(current, &r, &g, &b);
+
+        if (loInGamut && LinearInGamut(r, g, b))
+        {
+            lo = current.c;
+            continue;
+        }
+
+        clipped = Clip(r, g, b, &clippedLab);
+        const double e = Distance76(clippedLab, LchToLab_Core(current));
+        if (e < GAMUT_JND)
+        {
+            if (GAMUT_JND - e < GAMUT_CSS_EPS)
+                break;
+            loInGamut = 0;
+            lo = current.c;
+        }
+        else
+            hi = current.c;
+    }
+    return clipped;
+}
+
+static RgbColor MapTable(LchSpace lch)
+{
+    ChizlRunOnce(&s_tableOnce, BuildMaxChromaTable);
+
+    // The table holds the outer boundary, and cells it answers for have a single in gamut section.
+    // The interpolated chroma is kept when it is in gamut and one GAMUT_TABLE_SLACK step further is
+    // not, so it is within that step of the boundary.  Anything else (interpolation off near a cusp,
+    // jump and re-entrant cells) goes to the search.
+    double r, g, b;
+    const double maxC = MaxChromaTable(lch.l, lch.h);
+    if (maxC >= 0.0 && maxC < lch.c)
+    {
+        LchSpace probe = lch;
+        probe.c = maxC + GAMUT_TABLE_SLACK;
+        LchToLinear(probe, &r, &g, &b);
+        if (probe.c >= lch.c || !LinearInGamut(r, g, b))
+        {
+            lch.c = maxC;
+            LchToLinear(lch, &r, &g, &b);
+            if (LinearInGamut(r, g, b))
+                return LinearRgbToRgb_Core(r, g, b);
+        }
+    }
+
+    lch.c = ChromaBelow(lch.l, lch.h, lch.c, NULL);
+    LchToLinear(lch, &r, &g, &b);
+    return LinearRgbToRgb_Core(r, g, b);
+}
+
+static inline RgbColor Map(LchSpace lch, GamutMapMethod method)
+{
+    if (lch.l <= 0.0)
+    {
+        const RgbColor black = { 255, 0, 0, 0 };
+        return black;
+    }
+    if (lch.l >= 100.0)
+    {
+        const RgbColor white = { 255, 255, 255, 255 };
+        return white;
+    }
+
+    double r, g, b;
+    LchToLinear(lch, &r, &g, &b);
+    if (lch.c <= 0.0 || LinearInGamut(r, g, b))
+        return LinearRgbToRgb_Core(r, g, b);
+
+    lch.h = WrapHue(lch.h);
+    return (method == GAMUT_MAP_TABLE) ? MapTable(lch) : MapCss(lch);
+}
+
+CHIZL_COLORS_API int LchInGamut(LchSpace lch)
+{
+    double r, g, b;
+    LchToLinear(lch, &r, &g, &b);
+    return LinearInGamut(r, g, b);
+}
+
+CHIZL_COLORS_API double LchMaxChroma(double l, double h)
+{
+    if (l <= 0.0 || l >= 100.0)
+        return 0.0;
+
+    return ChromaBelow(l, WrapHue(h), GAMUT_MAX_CHROMA, NULL);
+}
+
+CHIZL_COLORS_API RgbColor LchToRgbMapped(LchSpace lch, GamutMapMethod method)
+{
+    return Map(lch, method);
+}
+
+CHIZL_COLORS_API size_t LchToRgbMappedBatch(const LchSpace* lch, RgbColor* rgb, size_t count, size_t stride, GamutMapMethod method)
+{
+    if (lch == NULL || rgb == NULL)
+        return 0;
+
+    if (isPackedStride(stride, sizeof(RgbColor)))
+    {
+        for (size_t i = 0; i < count; i++)
+            rgb[i] = Map(lch[i], method);
+    }
+    else
+    {
+        for (size_t i = 0; i < count; i++)
+            *(RgbColor*)stridedAt(rgb, i, stride, sizeof(RgbColor)) = Map(lch[i], method);
+    }
+
+    return count;
+}
@@ -0,0 +1,78 @@
+// gamut_map.h
+
+#pragma once
+
+#ifndef GAMUT_MAP_H
+#define GAMUT_MAP_H
+
+// --- Start of "extern C" block ---
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "import_exports.h"
+#include "chizl_colors_types.h"
+#include <stddef.h>             // For size_t
+
+/// <summary>
+/// Gamut mapping algorithms for LchToRgbMapped.  Both keep lightness and hue and only give up chroma,
+/// unlike LchToRgb which clamps each RGB channel and so shifts hue and lightness of out of gamut colors.
+/// </summary>
+typedef enum {
+    /// <summary>
+    /// CSS Color 4 gamut mapping: binary search on chroma, stopping at the first chroma whose clipped
+    /// color is within a just noticeable difference (CIE76 2.0) of the reduced color.  Keeps a little
+    /// more chroma than GAMUT_MAP_TABLE, about a dozen conversions per out of gamut color.
+    /// </summary>
+    GAMUT_MAP_CSS = 0,
+    /// <summary>
+    /// Chroma reduced to the sRGB boundary, read from a precomputed max chroma table (1 L* x 1 degree
+    /// grid, bilinear, built on first use on the thread pool) and kept within 0.05 chroma of it.  One
+    /// table read and two conversions for most colors, an exact boundary solve next to the cusps and
+    /// the re-entrant sections below white.  The fastest mapping.
+    /// </summary>
+    GAMUT_MAP_TABLE = 1
+} GamutMapMethod;
+
+/// <summary>
+/// Checks whether an LCH color (D65 full, as from RgbToLch) is inside the sRGB gamut.
+/// </summary>
+/// <param name="lch">Color to check.</param>
+/// <returns>1 if every linear RGB channel is within 0.0 - 1.0, 0 otherwise.</returns>
+CHIZL_COLORS_API int LchInGamut(LchSpace lch);
+
+/// <summary>
+/// Largest chroma that is still inside the sRGB gamut for a lightness and hue, solved for exactly.<br/>
+/// Just below white between yellow and green, chroma can leave and re-enter the gamut, this is the outer boundary.
+/// </summary>
+/// <param name="l">Lightness, 0.0 - 100.0.</param>
+/// <param name="h">Hue in degrees, any value (wrapped to 0.0 - 360.0).</param>
+/// <returns>The maximum chroma, 0.0 for l at or outside 0.0 / 100.0.</returns>
+CHIZL_COLORS_API double LchMaxChroma(double l, double h);
+
+/// <summary>
+/// LCH to RGB with gamut mapping.  In gamut colors give the same result as LchToRgb, out of gamut
+/// colors have their chroma reduced (to the largest in gamut chroma below it) instead of their channels clipped.  L* at or below 0 is black,
+/// at or above 100 white.
+/// </summary>
+/// <param name="lch">Color to convert.</param>
+/// <param name="method">Gamut mapping algorithm.</param>
+/// <returns>The mapped RgbColor (alpha 255).</returns>
+CHIZL_COLORS_API RgbColor LchToRgbMapped(LchSpace lch, GamutMapMethod method);
+
+/// <summary>
+/// LchToRgbMapped for an array of colors.
+/// </summary>
+/// <param name="lch">Pointer to the source array.</param>
+/// <param name="rgb">Pointer to the destination array.</param>
+/// <param name="count">Number of elements to convert.</param>
+/// <param name="stride">Distance in bytes between output elements, 0 for a tightly packed array.</param>
+/// <param name="method">Gamut mapping algorithm.</param>
+/// <returns>The number of elements converted, 0 if lch or rgb is NULL.</returns>
+CHIZL_COLORS_API size_t LchToRgbMappedBatch(const LchSpace* lch, RgbColor* rgb, size_t count, size_t stride, GamutMapMethod method);
+
+// --- End of "extern C" block ---
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -0,0 +1,365 @@
+// gradient.c
+#include "gradient.h"
+#include "hsl_space.h"
+#include "hsv_space.h"
+#include "cie_common.h"         // For RgbToXyz_Core, XyzToLab_White, LabToLch_Core, LinearRgbToRgb_Core, ...
+#include "srgb_linear.h"        // For SrgbLinearTable
+#include "common.h"             // For stridedAt, isPackedStride, clampDbl
+#include <stdlib.h>             // For malloc, free
+#include <math.h>               // For fmod, lround
+
+// A gradient is prepared once per call: anchors are converted to the interpolation space and each
+// pair becomes a segment holding its start, 1 / length, start value and delta (hue deltas already
+// taken the shorter way round).  The per stop loop is then one multiply-add per channel plus the
+// conversion back to RGB, with the linearization table and Luv white point fetched outside it.
+
+#define GRADIENT_LUT_DEFAULT_SIZE 1024
+
+// LCH chroma below which a color counts as gray.  8-bit grays reach 0.0034 (white, just above
+// CHIZL_LCH_CHROMA_EPS), the least chromatic non-gray 8-bit color is about 0.28.
+#define GRADIENT_HUELESS_CHROMA 0.01
+
+struct GradientLut {
+    size_t size;
+    RgbColor* colors;
+};
+
+typedef struct {
+    double start;               // Position of the segment's first anchor
+    double scale;               // 1 / segment length, 0 for a zero length segment
+    double from[4];             // Three channels in the interpolation space, alpha
+    double delta[4];
+} GradSegment;
+
+typedef struct {
+    GradientSpace space;
+    const double* linear;
+    double un_prime, vn_prime;  // Luv white chromaticity
+} GradContext;
+
+/// <summary>
+/// Channel holding the hue for the cylindrical spaces, -1 for the rest.
+/// </summary>
+static inline int HueChannel(GradientSpace space)
+{
+    switch (space)
+    {
+    case GRADIENT_HSL:
+    case GRADIENT_HSV:
+        return 0;
+    case GRADIENT_LCH:
+        return 2;
+    default:
+        return -1;
+    }
+}
+
+/// <summary>
+/// True when the color has no meaningful hue (saturation or chroma 0).
+/// </summary>
+static inline int IsHueless(GradientSpace space, const double* v)
+{
+    return (space == GRADIENT_LCH) ? v[1] < GRADIENT_HUELESS_CHROMA : v[1] <= 0.0;
+}
+
+static void ToSpace(const GradContext* ctx, RgbColor rgb, double* v)
+{
+    switch (ctx->space)
+    {
+    case GRADIENT_RGB:
+        v[0] = rgb.red;
+        v[1] = rgb.green;
+        v[2] = rgb.blue;
+        break;
+    case GRADIENT_LINEAR_RGB:
+        v[0] = ctx->linear[rgb.red];
+        v[1] = ctx->linear[rgb.green];
+        v[2] = ctx->linear[rgb.blue];
+        break;
+    case GRADIENT_HSL:
+    {
+        const HslSpace hsl = RgbToHsl(rgb);
+        v[0] = hsl.hue;
+        v[1] = hsl.saturation;
+        v[2] = hsl.lightness;
+        break;
+    }
+    case GRADIENT_HSV:
+    {
+        const HsvSpace hsv = RgbToHsv(rgb);
+        v[0] = hsv.hue;
+        v[1] = hsv.saturation;
+        v[2] = hsv.value;
+        break;
+    }
+    case GRADIENT_LAB:
+    case GRADIENT_LCH:
+    {
+        const LabSpace lab = XyzToLab_White(RgbToXyz_Core(rgb, ctx->linear), WP_D65_FULL);
+        if (ctx->space == GRADIENT_LAB)
+        {
+            v[0] = lab.l;
+            v[1] = lab.a;
+            v[2] = lab.b;
+        }
+        else
+        {
+            const LchSpace lch = LabToLch_Core(lab);
+            v[0] = lch.l;
+            v[1] = lch.c;
+            v[2] = lch.h;
+        }
+        break;
+    }
+    case GRADIENT_LUV:
+    {
+        const LuvSpace luv = XyzToLuv_White(RgbToXyz_Core(rgb, ctx->linear), WP_D65_FULL, ctx->un_prime, ctx->vn_prime);
+        v[0] = luv.l;
+        v[1] = luv.u;
+        v[2] = luv.v;
+        break;
+    }
+    }
+    v[3] = rgb.alpha;
+}
+
+static inline double WrapHue(double h)
+{
+    h = fmod(h, 360.0);
+    return (h < 0.0) ? h + 360.0 : h;
+}
+
+static inline RgbColor FromSpace(const GradContext* ctx, const double* v)
+{
+    RgbColor rgb;
+
+    switch (ctx->space)
+    {
+    case GRADIENT_RGB:
+    {
+        const RgbColor c = {
+            255,
+            (unsigned char)lround(clampDbl(v[0], 0.0, 255.0)),
+            (unsigned char)lround(clampDbl(v[1], 0.0, 255.0)),
+            (unsigned char)lround(clampDbl(v[2], 0.0, 255.0))
+        };
+        rgb = c;
+        break;
+    }
+    case GRADIENT_LINEAR_RGB:
+        rgb = LinearRgbToRgb_Core(v[0], v[1], v[2]);
+        break;
+    case GRADIENT_HSL:
+    {
+        const HslSpace hsl = { WrapHue(v[0]), v[1], v[2], 0.0 };
+        rgb = HslToRgb(hsl);
+        break;
+    }
+    case GRADIENT_HSV:
+    {
+        const HsvSpace hsv = { WrapHue(v[0]), v[1], v[2], 0.0 };
+        rgb = HsvToRgb(hsv);
+        break;
+    }
+    case GRADIENT_LAB:
+    {
+        const LabSpace lab = { v[0], v[1], v[2] };
+        rgb = XyzToRgb_Core(LabToXyz_White(lab, WP_D65_FULL));
+        break;
+    }
+    case GRADIENT_LCH:
+    {
+        const LchSpace lch = { v[0], v[1], v[2] };
+        rgb = XyzToRgb_Core(LabToXyz_White(LchToLab_Core(lch), WP_D65_FULL));
+        break;
+    }
+    default:
+    {
+        const LuvSpace luv = { v[0], v[1], v[2] };
+        rgb = XyzToRgb_Core(LuvToXyz_White(luv, WP_D65_FULL, ctx->un_prime, ctx->vn_prime));
+        break;
+    }
+    }
+
+    rgb.alpha = (unsigned char)lround(clampDbl(v[3], 0.0, 255.0));
+    return rgb;
+}
+
+/// <summary>
+/// Converts the anchors and builds one segment per anchor pair.  Returns the segment array (at least
+/// one entry, a single anchor becomes a zero length segment) or NULL on bad positions / out of memory.
+/// </summary>
+static GradSegment* BuildSegments(const GradContext* ctx, const RgbColor* anchors, const double* positions, size_t anchorCount, size_t* segmentCount)
+{
+    if (positions != NULL)
+    {
+        // The ends are pinned so the first and last stops are always the first and last anchors.
+        if (anchorCount > 1 && (positions[0] != 0.0 || positions[anchorCount - 1] != 1.0))
+            return NULL;
+        for (size_t i = 0; i < anchorCount; i++)
+        {
+            if (!(positions[i] >= 0.0 && positions[i] <= 1.0) || (i > 0 && positions[i] < positions[i - 1]))
+                return NULL;
+        }
+    }
+
+    const size_t count = (anchorCount > 1) ? anchorCount - 1 : 1;
+    GradSegment* segments = (GradSegment*)malloc(count * sizeof(GradSegment));
+    if (segments == NULL)
+        return NULL;
+
+    const int hue = HueChannel(ctx->space);
+    double to[4];
+    ToSpace(ctx, anchors[0], to);
+
+    for (size_t i = 0; i < count; i++)
+    {
+        GradSegment* seg = segments + i;
+        double from[4] = { to[0], to[1], to[2], to[3] };
+        if (anchorCount > 1)
+            ToSpace(ctx, anchors[i + 1], to);
+
+        const double start = (positions != NULL) ? positions[i] : (anchorCount > 1 ? (double)i / (double)(anchorCount - 1) : 0.0);
+        const double end = (anchorCount == 1) ? start : ((positions != NULL) ? positions[i + 1] : (double)(i + 1) / (double)(anchorCount - 1));
+        double target[4] = { to[0], to[1], to[2], to[3] };
+
+        if (hue >= 0)
+        {
+            // A gray end has no hue of its own, borrow the other end's so only lightness / saturation move.
+            if (IsHueless(ctx->space, from) && !IsHueless(ctx->space, target))
+                from[hue] = target[hue];
+            else if (IsHueless(ctx->space, target) && !IsHueless(ctx->space, from))
+                target[hue] = from[hue];
+
+            double d = target[hue] - from[hue];
+            if (d > 180.0)
+                d -= 360.0;
+            else if (d < -180.0)
+                d += 360.0;
+            target[hue] = from[hue] + d;
+        }
+
+        seg->start = start;
+        seg->scale = (end > start) ? 1.0 / (end - start) : 0.0;
+        for (int c = 0; c < 4; c++)
+        {
+            seg->from[c] = from[c];
+            seg->delta[c] = target[c] - from[c];
+        }
+    }
+
+    *segmentCount = count;
+    return segments;
+}
+
+static inline void InitContext(GradContext* ctx, GradientSpace space)
+{
+    ctx->space = space;
+    ctx->linear = SrgbLinearTable();
+    LuvWhiteChromaticity(WP_D65_FULL, &ctx->un_prime, &ctx->vn_prime);
+}
+
+CHIZL_COLORS_API size_t GradientFill(const RgbColor* anchors, const double* positions, size_t anchorCount, RgbColor* out, size_t count, size_t stride, GradientSpace space)
+{
+    if (anchors == NULL || out == NULL || anchorCount == 0 || space < GRADIENT_RGB || space > GRADIENT_LUV)
+        return 0;
+
+    GradContext ctx;
+    InitContext(&ctx, space);
+
+    size_t segmentCount = 0;
+    GradSegment* segments = BuildSegments(&ctx, anchors, positions, anchorCount, &segmentCount);
+    if (segments == NULL)
+        return 0;
+
+    const double step = (count > 1) ? 1.0 / (double)(count - 1) : 0.0;
+    size_t k = 0;
+
+    for (size_t i = 0; i < count; i++)
+    {
+        // Stops only move forward, so does the segment.  The last stop is exactly 1.0.
+        const double t = (i + 1 == count && count > 1) ? 1.0 : (double)i * step;
+        while (k + 1 < segmentCount && t >= segments[k + 1].start)
+            k++;
+
+        const GradSegment* seg = segments + k;
+        const double u = clampDbl((t - seg->start) * seg->scale, 0.0, 1.0);
+        const double v[4] = {
+            seg->from[0] + seg->delta[0] * u,
+            seg->from[1] + seg->delta[1] * u,
+            seg->from[2] + seg->delta[2] * u,
+            seg->from[3] + seg->delta[3] * u
+        };
+
+        *(RgbColor*)stridedAt(out, i, stride, sizeof(RgbColor)) = FromSpace(&ctx, v);
+    }
+
+    free(segments);
+    return count;
+}
+
+CHIZL_COLORS_API GradientLut* GradientLutCreate(const RgbColor* anchors, const double* positions, size_t anchorCount, size_t size, GradientSpace space)
+{
+    if (size == 0)
+        size = GRADIENT_LUT_DEFAULT_SIZE;
+    if (size < 2 || size > ((size_t)-1 - sizeof(GradientLut)) / sizeof(RgbColor))
+        return NULL;
+
+    // One block: header then the colors.
+    GradientLut* lut = (GradientLut*)malloc(sizeof(GradientLut) + size * sizeof(RgbColor));
+    if (lut == NULL)
+        return NULL;
+
+    lut->size = size;
+    lut->colors = (RgbColor*)(lut + 1);
+    if (GradientFill(anchors, positions, anchorCount, lut->colors, size, 0, space) != size)
+    {
+        free(lut);
+        return NULL;
+    }
+    return lut;
+}
+
+CHIZL_COLORS_API void GradientLutFree(GradientLut* lut)
+{
+    free(lut);
+}
+
+static inline RgbColor LutSample(const GradientLut* lut, double t)
+{
+    // !(t > 0.0) also catches NaN.
+    if (!(t > 0.0))
+        return lut->colors[0];
+    if (t >= 1.0)
+        return lut->colors[lut->size - 1];
+    return lut->colors[(size_t)(t * (double)(lut->size - 1) + 0.5)];
+}
+
+CHIZL_COLORS_API RgbColor GradientLutSample(const GradientLut* lut, double t)
+{
+    if (lut == NULL)
+    {
+        const RgbColor none = { 0, 0, 0, 0 };
+        return none;
+    }
+    return LutSample(lut, t);
+}
+
+CHIZL_COLORS_API size_t GradientLutSampleBatch(const GradientLut* lut, const double* t, RgbColor* out, size_t count, size_t stride)
+{
+    if (lut == NULL || t == NULL || out == NULL)
+        return 0;
+
+    if (isPackedStride(stride, sizeof(RgbColor)))
+    {
+        for (size_t i = 0; i < count; i++)
+            out[i] = LutSample(lut, t[i]);
+    }
+    else
+    {
+        for (size_t i = 0; i < count; i++)
+            *(RgbColor*)stridedAt(out, i, stride, sizeof(RgbColor)) = LutSample(lut, t[i]);
+    }
+
+    return count;
+}
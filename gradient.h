@@ -0,0 +1,115 @@
+// gradient.h
+
+#pragma once
+
+#ifndef GRADIENT_H
+#define GRADIENT_H
+
+// --- Start of "extern C" block ---
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "import_exports.h"
+#include "chizl_colors_types.h"
+#include <stddef.h>             // For size_t
+
+/// <summary>
+/// Color space the gradient functions interpolate in.  Anchors are converted once, each stop is
+/// interpolated in this space and converted back to RGB.  Alpha is always interpolated linearly.
+/// </summary>
+typedef enum {
+    /// <summary>
+    /// sRGB channels as stored, the cheapest.  Midpoints of saturated colors come out dark.
+    /// </summary>
+    GRADIENT_RGB = 0,
+    /// <summary>
+    /// Linear light RGB (gamma expanded), physically correct blending of light.
+    /// </summary>
+    GRADIENT_LINEAR_RGB = 1,
+    /// <summary>
+    /// HSL, hue along the shorter way around the circle.
+    /// </summary>
+    GRADIENT_HSL = 2,
+    /// <summary>
+    /// HSV, hue along the shorter way around the circle.
+    /// </summary>
+    GRADIENT_HSV = 3,
+    /// <summary>
+    /// CIE Lab (D65 full), perceptually even steps.
+    /// </summary>
+    GRADIENT_LAB = 4,
+    /// <summary>
+    /// CIE LCH (D65 full), hue along the shorter way around the circle.  Keeps chroma up through the middle.
+    /// </summary>
+    GRADIENT_LCH = 5,
+    /// <summary>
+    /// CIE Luv (D65 full).
+    /// </summary>
+    GRADIENT_LUV = 6
+} GradientSpace;
+
+/// <summary>
+/// Opaque precomputed gradient: a table of evenly spaced colors for repeated GradientLutSample lookups.<br/>
+/// Read only after creation, one table can be sampled from any number of threads.
+/// </summary>
+typedef struct GradientLut GradientLut;
+
+/// <summary>
+/// Fills 'count' evenly spaced stops of a gradient through 'anchorCount' anchor colors.  Stop i is at
+/// position i / (count - 1), the first stop is the first anchor and the last stop the last anchor.<br/>
+/// A gray anchor (no hue) takes the hue of its neighbor in HSL, HSV and LCH, so fading to gray or
+/// white does not sweep through unrelated hues.
+/// </summary>
+/// <param name="anchors">Pointer to the anchor colors.</param>
+/// <param name="positions">Optional, pointer to 'anchorCount' positions of the anchors, ascending, first exactly 0.0 and last exactly 1.0 (other ends are bad arguments).  NULL spaces the anchors evenly.</param>
+/// <param name="anchorCount">Number of anchors, at least 1.</param>
+/// <param name="out">Pointer to the destination array.</param>
+/// <param name="count">Number of stops to write.</param>
+/// <param name="stride">Distance in bytes between output elements, 0 for a tightly packed array.</param>
+/// <param name="space">Interpolation space.</param>
+/// <returns>The number of stops written, 0 on bad arguments.</returns>
+CHIZL_COLORS_API size_t GradientFill(const RgbColor* anchors, const double* positions, size_t anchorCount, RgbColor* out, size_t count, size_t stride, GradientSpace space);
+
+/// <summary>
+/// Builds a lookup table of 'size' stops with GradientFill, for sampling the same gradient many times.
+/// </summary>
+/// <param name="anchors">Pointer to the anchor colors.</param>
+/// <param name="positions">Optional anchor positions, see GradientFill.  May be NULL.</param>
+/// <param name="anchorCount">Number of anchors, at least 1.</param>
+/// <param name="size">Table entries, 2 or more, 0 for 1024.  Sampling error is half an entry.</param>
+/// <param name="space">Interpolation space.</param>
+/// <returns>The new table, or NULL on bad arguments or out of memory.  Release with GradientLutFree.</returns>
+CHIZL_COLORS_API GradientLut* GradientLutCreate(const RgbColor* anchors, const double* positions, size_t anchorCount, size_t size, GradientSpace space);
+
+/// <summary>
+/// Releases a table created by GradientLutCreate.  NULL is ignored.
+/// </summary>
+/// <param name="lut">Table to free.</param>
+/// <returns>This function does not return a value.</returns>
+CHIZL_COLORS_API void GradientLutFree(GradientLut* lut);
+
+/// <summary>
+/// Color at position t of the gradient, the nearest table entry.
+/// </summary>
+/// <param name="lut">Gradient table.</param>
+/// <param name="t">Position, 0.0 - 1.0.  Values outside (and NaN) are clamped.</param>
+/// <returns>The gradient color, black (alpha 0) if lut is NULL.</returns>
+CHIZL_COLORS_API RgbColor GradientLutSample(const GradientLut* lut, double t);
+
+/// <summary>
+/// GradientLutSample for an array of positions.
+/// </summary>
+/// <param name="lut">Gradient table.</param>
+/// <param name="t">Pointer to the positions.</param>
+/// <param name="out">Pointer to the destination array.</param>
+/// <param name="count">Number of positions.</param>
+/// <param name="stride">Distance in bytes between output elements, 0 for a tightly packed array.</param>
+/// <returns>The number of colors written, 0 if lut, t or out is NULL.</returns>
+CHIZL_COLORS_API size_t GradientLutSampleBatch(const GradientLut* lut, const double* t, RgbColor* out, size_t count, size_t stride);
+
+// --- End of "extern C" block ---
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -1,5 +1,7 @@
 // hsl_space.c
 #include "hsl_space.h"
+#include "common.h"             // For stridedAt, isPackedStride
+#include "fixed_point.h"        // For FixedHue, FixedDivRound, reciprocal tables
 #include <string.h>             // For strlen, strcpy_s
 #include <math.h>               // For fmin, fmax, fabs, round, pow
 
@@ -12,7 +14,7 @@ static double HueToRgb(double p, double q, double t) {
     return p;
 }
 
-CHIZL_COLORS_API HslSpace RgbToHsl(RgbColor rgb)
+static inline HslSpace RgbToHsl_Core(RgbColor rgb)
 {
     // Convert 0-255 to 0.0-1.0
     double r = (double)rgb.red / 255.0;
@@ -48,7 +50,12 @@ CHIZL_COLORS_API HslSpace RgbToHsl(RgbColor rgb)
     return hsl;
 }
 
-CHIZL_COLORS_API RgbColor HslToRgb(HslSpace hsl)
+CHIZL_COLORS_API HslSpace RgbToHsl(RgbColor rgb)
+{
+    return RgbToHsl_Core(rgb);
+}
+
+static inline RgbColor HslToRgb_Core(HslSpace hsl)
 {
     // Convert 0-100.0 to 0.0-1.0
     double h = hsl.hue / 360.0; // HSL stores 0-360, but math needs 0-1.0
@@ -84,3 +91,170 @@ CHIZL_COLORS_API RgbColor HslToRgb(HslSpace hsl)
     return rgb;
 }
 
+CHIZL_COLORS_API RgbColor HslToRgb(HslSpace hsl)
+{
+    return HslToRgb_Core(hsl);
+}
+
+// Float variants: same math in double, rounded to float once on the way out.
+static inline HslSpaceF HslToF(HslSpace hsl)
+{
+    HslSpaceF f = { (float)hsl.hue, (float)hsl.saturation, (float)hsl.lightness, (float)hsl.raw_lightness };
+    return f;
+}
+
+static inline HslSpace HslFromF(HslSpaceF f)
+{
+    HslSpace hsl = { f.hue, f.saturation, f.lightness, f.raw_lightness };
+    return hsl;
+}
+
+CHIZL_COLORS_API HslSpaceF RgbToHslF(RgbColor rgb)
+{
+    return HslToF(RgbToHsl_Core(rgb));
+}
+
+CHIZL_COLORS_API RgbColor HslFToRgb(HslSpaceF hsl)
+{
+    return HslToRgb_Core(HslFromF(hsl));
+}
+
+CHIZL_COLORS_API size_t RgbToHslBatch(const RgbColor* rgb, HslSpace* hsl, size_t count, size_t stride)
+{
+    if (rgb == NULL || hsl == NULL)
+        return 0;
+
+    if (isPackedStride(stride, sizeof(HslSpace)))
+    {
+        for (size_t i = 0; i < count; i++)
+            hsl[i] = RgbToHsl_Core(rgb[i]);
+    }
+    else
+    {
+        for (size_t i = 0; i < count; i++)
+            *(HslSpace*)stridedAt(hsl, i, stride, sizeof(HslSpace)) = RgbToHsl_Core(rgb[i]);
+    }
+
+    return count;
+}
+
+CHIZL_COLORS_API size_t RgbToHslFBatch(const RgbColor* rgb, HslSpaceF* hsl, size_t count, size_t stride)
+{
+    if (rgb == NULL || hsl == NULL)
+        return 0;
+
+    if (isPackedStride(stride, sizeof(HslSpaceF)))
+    {
+        for (size_t i = 0; i < count; i++)
+            hsl[i] = HslToF(RgbToHsl_Core(rgb[i]));
+    }
+    else
+    {
+        for (size_t i = 0; i < count; i++)
+            *(HslSpaceF*)stridedAt(hsl, i, stride, sizeof(HslSpaceF)) = HslToF(RgbToHsl_Core(rgb[i]));
+    }
+
+    return count;
+}
+
+CHIZL_COLORS_API size_t HslFToRgbBatch(const HslSpaceF* hsl, RgbColor* rgb, size_t count, size_t stride)
+{
+    if (hsl == NULL || rgb == NULL)
+        return 0;
+
+    if (isPackedStride(stride, sizeof(RgbColor)))
+    {
+        for (size_t i = 0; i < count; i++)
+            rgb[i] = HslToRgb_Core(HslFromF(hsl[i]));
+    }
+    else
+    {
+        for (size_t i = 0; i < count; i++)
+            *(RgbColor*)stridedAt(rgb, i, stride, sizeof(RgbColor)) = HslToRgb_Core(HslFromF(hsl[i]));
+    }
+
+    return count;
+}
+
+// Fixed point variants: integer only, every division through the fixed_point.h reciprocal tables.
+// Sums of two channels (0 - 510) stand in for lightness so nothing is halved before the end.
+static inline HslSpaceU16 RgbToHslU16_Core(RgbColor rgb, const uint64_t* hueRecip, const uint64_t* ratioRecip)
+{
+    const int r = rgb.red, g = rgb.green, b = rgb.blue;
+    const int max = (r > g) ? ((r > b) ? r : b) : ((g > b) ? g : b);
+    const int min = (r < g) ? ((r < b) ? r : b) : ((g < b) ? g : b);
+    const int delta = max - min;
+    const int sum = max + min;
+
+    // Saturation delta / (max + min) up to mid lightness, delta / (2 - max - min) above it.
+    const int range = (sum <= 255) ? sum : 510 - sum;
+
+    HslSpaceU16 hsl = {
+        FixedHue(r, g, b, max, delta, hueRecip),
+        (unsigned short)FixedDivRound((unsigned int)delta, ratioRecip[range]),
+        (unsigned short)((sum * 257 + 1) >> 1)
+    };
+    return hsl;
+}
+
+static inline RgbColor HslU16ToRgb_Core(HslSpaceU16 hsl)
+{
+    const int sum = (int)((hsl.lightness * 2u + 128u) / 257u);
+    const int range = (sum <= 255) ? sum : 510 - sum;
+    const int delta = FixedRatioOf(hsl.saturation, range);
+
+    // sum and delta always share parity for values RgbToHslU16 made, + 1 keeps others in range.
+    const int max = (sum + delta + 1) >> 1;
+    return FixedHueToRgb(hsl.hue, max, delta);
+}
+
+CHIZL_COLORS_API HslSpaceU16 RgbToHslU16(RgbColor rgb)
+{
+    return RgbToHslU16_Core(rgb, FixedHueRecipTable(), FixedRatioRecipTable());
+}
+
+CHIZL_COLORS_API RgbColor HslU16ToRgb(HslSpaceU16 hsl)
+{
+    return HslU16ToRgb_Core(hsl);
+}
+
+CHIZL_COLORS_API size_t RgbToHslU16Batch(const RgbColor* rgb, HslSpaceU16* hsl, size_t count, size_t stride)
+{
+    if (rgb == NULL || hsl == NULL)
+        return 0;
+
+    const uint64_t* hueRecip = FixedHueRecipTable();
+    const uint64_t* ratioRecip = FixedRatioRecipTable();
+
+    if (isPackedStride(stride, sizeof(HslSpaceU16)))
+    {
+        for (size_t i = 0; i < count; i++)
+            hsl[i] = RgbToHslU16_Core(rgb[i], hueRecip, ratioRecip);
+    }
+    else
+    {
+        for (size_t i = 0; i < count; i++)
+            *(HslSpaceU16*)stridedAt(hsl, i, stride, sizeof(HslSpaceU16)) = RgbToHslU16_Core(rgb[i], hueRecip, ratioRecip);
+    }
+
+    return count;
+}
+
+CHIZL_COLORS_API size_t HslU16ToRgbBatch(const HslSpaceU16* hsl, RgbColor* rgb, size_t count, size_t stride)
+{
+    if (hsl == NULL || rgb == NULL)
+        return 0;
+
+    if (isPackedStride(stride, sizeof(RgbColor)))
+    {
+        for (size_t i = 0; i < count; i++)
+            rgb[i] = HslU16ToRgb_Core(hsl[i]);
+    }
+    else
+    {
+        for (size_t i = 0; i < count; i++)
+            *(RgbColor*)stridedAt(rgb, i, stride, sizeof(RgbColor)) = HslU16ToRgb_Core(hsl[i]);
+    }
+
+    return count;
+}
@@ -12,6 +12,7 @@ extern "C" {
 
 #include "import_exports.h"
 #include "chizl_colors_types.h"
+#include <stddef.h>             // For size_t
 
 /// <summary>
 /// Converts an RGB color to its HSL (Hue, Saturation, Lightness) equivalent.
@@ -28,6 +29,88 @@ CHIZL_COLORS_API HslSpace RgbToHsl(RgbColor rgb);
 /// <returns>RGB Color</returns>
 CHIZL_COLORS_API RgbColor HslToRgb(HslSpace hsl);
 
+/// <summary>
+/// Converts an array of RGB colors to their HSL (Hue, Saturation, Lightness) equivalents in a single call.
+/// </summary>
+/// <param name="rgb">Pointer to the first RGB color to convert.</param>
+/// <param name="hsl">Pointer to the first HslSpace to write.</param>
+/// <param name="count">Number of colors to convert.</param>
+/// <param name="stride">Distance in bytes between output elements, 0 for a tightly packed array.</param>
+/// <returns>The number of colors converted, 0 if either pointer is NULL.</returns>
+CHIZL_COLORS_API size_t RgbToHslBatch(const RgbColor* rgb, HslSpace* hsl, size_t count, size_t stride);
+
+
+// --- Float (single precision) variants, see chizl_colors_types.h for accuracy ---
+
+/// <summary>
+/// Float version of RgbToHsl, the double result rounded to float.
+/// </summary>
+/// <param name="rgb">RGB Color</param>
+/// <returns>HslSpaceF struct</returns>
+CHIZL_COLORS_API HslSpaceF RgbToHslF(RgbColor rgb);
+
+/// <summary>
+/// Float version of HslToRgb.
+/// </summary>
+/// <param name="hsl">HslSpaceF struct</param>
+/// <returns>RGB Color</returns>
+CHIZL_COLORS_API RgbColor HslFToRgb(HslSpaceF hsl);
+
+/// <summary>
+/// Converts an array of RGB colors to HslSpaceF in a single call.  Half the output memory of RgbToHslBatch.
+/// </summary>
+/// <param name="rgb">Pointer to the first RGB color to convert.</param>
+/// <param name="hsl">Pointer to the first HslSpaceF to write.</param>
+/// <param name="count">Number of colors to convert.</param>
+/// <param name="stride">Distance in bytes between output elements, 0 for a tightly packed array.</param>
+/// <returns>The number of colors converted, 0 if either pointer is NULL.</returns>
+CHIZL_COLORS_API size_t RgbToHslFBatch(const RgbColor* rgb, HslSpaceF* hsl, size_t count, size_t stride);
+
+/// <summary>
+/// Converts an array of HslSpaceF colors back to RGB in a single call.
+/// </summary>
+/// <param name="hsl">Pointer to the first HslSpaceF to convert.</param>
+/// <param name="rgb">Pointer to the first RGB color to write.</param>
+/// <param name="count">Number of colors to convert.</param>
+/// <param name="stride">Distance in bytes between output elements, 0 for a tightly packed array.</param>
+/// <returns>The number of colors converted, 0 if either pointer is NULL.</returns>
+CHIZL_COLORS_API size_t HslFToRgbBatch(const HslSpaceF* hsl, RgbColor* rgb, size_t count, size_t stride);
+
+// --- 16-bit fixed point variants, integer math only, see chizl_colors_types.h for accuracy ---
+
+/// <summary>
+/// Fixed point version of RgbToHsl, every field 0 - 65535.
+/// </summary>
+/// <param name="rgb">RGB Color</param>
+/// <returns>HslSpaceU16 struct</returns>
+CHIZL_COLORS_API HslSpaceU16 RgbToHslU16(RgbColor rgb);
+
+/// <summary>
+/// Fixed point version of HslToRgb.  Returns the original color for anything RgbToHslU16 produced.
+/// </summary>
+/// <param name="hsl">HslSpaceU16 struct</param>
+/// <returns>RGB Color</returns>
+CHIZL_COLORS_API RgbColor HslU16ToRgb(HslSpaceU16 hsl);
+
+/// <summary>
+/// Converts an array of RGB colors to HslSpaceU16 in a single call.
+/// </summary>
+/// <param name="rgb">Pointer to the first RGB color to convert.</param>
+/// <param name="hsl">Pointer to the first HslSpaceU16 to write.</param>
+/// <param name="count">Number of colors to convert.</param>
+/// <param name="stride">Distance in bytes between output elements, 0 for a tightly packed array.</param>
+/// <returns>The number of colors converted, 0 if either pointer is NULL.</returns>
+CHIZL_COLORS_API size_t RgbToHslU16Batch(const RgbColor* rgb, HslSpaceU16* hsl, size_t count, size_t stride);
+
+/// <summary>
+/// Converts an array of HslSpaceU16 colors back to RGB in a single call.
+/// </summary>
+/// <param name="hsl">Pointer to the first HslSpaceU16 to convert.</param>
+/// <param name="rgb">Pointer to the first RGB color to write.</param>
+/// <param name="count">Number of colors to convert.</param>
+/// <param name="stride">Distance in bytes between output elements, 0 for a tightly packed array.</param>
+/// <returns>The number of colors converted, 0 if either pointer is NULL.</returns>
+CHIZL_COLORS_API size_t HslU16ToRgbBatch(const HslSpaceU16* hsl, RgbColor* rgb, size_t count, size_t stride);
 
 // --- End of "extern C" block ---
 #ifdef __cplusplus
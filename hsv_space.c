@@ -1,11 +1,12 @@
 // hsv_space.c
 #include "hsv_space.h"
 #include "common.h"             // For clampDbl
+#include "fixed_point.h"        // For FixedHue, FixedDivRound, reciprocal tables
 #include <math.h>               // For fmin, fmax, fabs, round, pow
 
 // CIELAB, CIELCh, and CIELUV, and XYZ conversions.
 
-CHIZL_COLORS_API RgbColor HsvToRgb(HsvSpace hsv)
+static inline RgbColor HsvToRgb_Core(HsvSpace hsv)
 {
     // Whole number
     double h = clampDbl(hsv.hue, 0.0, 360.0);
@@ -46,7 +47,7 @@ CHIZL_COLORS_API RgbColor HsvToRgb(HsvSpace hsv)
     return rgb;
 }
 
-CHIZL_COLORS_API HsvSpace RgbToHsv(RgbColor rgb)
+static inline HsvSpace RgbToHsv_Core(RgbColor rgb)
 {
     // Convert 0-255 to 0.0-1.0
     double r = clampDbl(rgb.red, 0.0, 255.0) / 255.0;
@@ -81,3 +82,168 @@ CHIZL_COLORS_API HsvSpace RgbToHsv(RgbColor rgb)
     HsvSpace hsv = { h, s * 100.0, v * 100.0, raw };
     return hsv;
 }
+
+CHIZL_COLORS_API HsvSpace RgbToHsv(RgbColor rgb)
+{
+    return RgbToHsv_Core(rgb);
+}
+
+CHIZL_COLORS_API RgbColor HsvToRgb(HsvSpace hsv)
+{
+    return HsvToRgb_Core(hsv);
+}
+
+// Float variants: same math in double, rounded to float once on the way out.
+static inline HsvSpaceF HsvToF(HsvSpace hsv)
+{
+    HsvSpaceF f = { (float)hsv.hue, (float)hsv.saturation, (float)hsv.value, (float)hsv.raw_value };
+    return f;
+}
+
+static inline HsvSpace HsvFromF(HsvSpaceF f)
+{
+    HsvSpace hsv = { f.hue, f.saturation, f.value, f.raw_value };
+    return hsv;
+}
+
+CHIZL_COLORS_API HsvSpaceF RgbToHsvF(RgbColor rgb)
+{
+    return HsvToF(RgbToHsv_Core(rgb));
+}
+
+CHIZL_COLORS_API RgbColor HsvFToRgb(HsvSpaceF hsv)
+{
+    return HsvToRgb_Core(HsvFromF(hsv));
+}
+
+CHIZL_COLORS_API size_t RgbToHsvBatch(const RgbColor* rgb, HsvSpace* hsv, size_t count, size_t stride)
+{
+    if (rgb == NULL || hsv == NULL)
+        return 0;
+
+    if (isPackedStride(stride, sizeof(HsvSpace)))
+    {
+        for (size_t i = 0; i < count; i++)
+            hsv[i] = RgbToHsv_Core(rgb[i]);
+    }
+    else
+    {
+        for (size_t i = 0; i < count; i++)
+            *(HsvSpace*)stridedAt(hsv, i, stride, sizeof(HsvSpace)) = RgbToHsv_Core(rgb[i]);
+    }
+
+    return count;
+}
+
+CHIZL_COLORS_API size_t RgbToHsvFBatch(const RgbColor* rgb, HsvSpaceF* hsv, size_t count, size_t stride)
+{
+    if (rgb == NULL || hsv == NULL)
+        return 0;
+
+    if (isPackedStride(stride, sizeof(HsvSpaceF)))
+    {
+        for (size_t i = 0; i < count; i++)
+            hsv[i] = HsvToF(RgbToHsv_Core(rgb[i]));
+    }
+    else
+    {
+        for (size_t i = 0; i < count; i++)
+            *(HsvSpaceF*)stridedAt(hsv, i, stride, sizeof(HsvSpaceF)) = HsvToF(RgbToHsv_Core(rgb[i]));
+    }
+
+    return count;
+}
+
+CHIZL_COLORS_API size_t HsvFToRgbBatch(const HsvSpaceF* hsv, RgbColor* rgb, size_t count, size_t stride)
+{
+    if (hsv == NULL || rgb == NULL)
+        return 0;
+
+    if (isPackedStride(stride, sizeof(RgbColor)))
+    {
+        for (size_t i = 0; i < count; i++)
+            rgb[i] = HsvToRgb_Core(HsvFromF(hsv[i]));
+    }
+    else
+    {
+        for (size_t i = 0; i < count; i++)
+            *(RgbColor*)stridedAt(rgb, i, stride, sizeof(RgbColor)) = HsvToRgb_Core(HsvFromF(hsv[i]));
+    }
+
+    return count;
+}
+
+// Fixed point variants: integer only, every division through the fixed_point.h reciprocal tables.
+static inline HsvSpaceU16 RgbToHsvU16_Core(RgbColor rgb, const uint64_t* hueRecip, const uint64_t* ratioRecip)
+{
+    const int r = rgb.red, g = rgb.green, b = rgb.blue;
+    const int max = (r > g) ? ((r > b) ? r : b) : ((g > b) ? g : b);
+    const int min = (r < g) ? ((r < b) ? r : b) : ((g < b) ? g : b);
+    const int delta = max - min;
+
+    // Saturation delta / max, value max / 255 (* 257 is exact for 0 - 65535).
+    HsvSpaceU16 hsv = {
+        FixedHue(r, g, b, max, delta, hueRecip),
+        (unsigned short)FixedDivRound((unsigned int)delta, ratioRecip[max]),
+        (unsigned short)(max * 257)
+    };
+    return hsv;
+}
+
+static inline RgbColor HsvU16ToRgb_Core(HsvSpaceU16 hsv)
+{
+    const int max = FixedTo8(hsv.value);
+    const int delta = FixedRatioOf(hsv.saturation, max);
+    return FixedHueToRgb(hsv.hue, max, delta);
+}
+
+CHIZL_COLORS_API HsvSpaceU16 RgbToHsvU16(RgbColor rgb)
+{
+    return RgbToHsvU16_Core(rgb, FixedHueRecipTable(), FixedRatioRecipTable());
+}
+
+CHIZL_COLORS_API RgbColor HsvU16ToRgb(HsvSpaceU16 hsv)
+{
+    return HsvU16ToRgb_Core(hsv);
+}
+
+CHIZL_COLORS_API size_t RgbToHsvU16Batch(const RgbColor* rgb, HsvSpaceU16* hsv, size_t count, size_t stride)
+{
+    if (rgb == NULL || hsv == NULL)
+        return 0;
+
+    const uint64_t* hueRecip = FixedHueRecipTable();
+    const uint64_t* ratioRecip = FixedRatioRecipTable();
+
+    if (isPackedStride(stride, sizeof(HsvSpaceU16)))
+    {
+        for (size_t i = 0; i < count; i++)
+            hsv[i] = RgbToHsvU16_Core(rgb[i], hueRecip, ratioRecip);
+    }
+    else
+    {
+        for (size_t i = 0; i < count; i++)
+            *(HsvSpaceU16*)stridedAt(hsv, i, stride, sizeof(HsvSpaceU16)) = RgbToHsvU16_Core(rgb[i], hueRecip, ratioRecip);
+    }
+
+    return count;
+}
+
+CHIZL_COLORS_API size_t HsvU16ToRgbBatch(const HsvSpaceU16* hsv, RgbColor* rgb, size_t count, size_t stride)
+{
+    if (hsv == NULL || rgb == NULL)
+        return 0;
+
+    if (isPackedStride(stride, sizeof(RgbColor)))
+    {
+        for (size_t i = 0; i < count; i++)
+            rgb[i] = HsvU16ToRgb_Core(hsv[i]);
+    }
+    else
+    {
+        for (size_t i = 0; i < count; i++)
+            *(RgbColor*)stridedAt(rgb, i, stride, sizeof(RgbColor)) = HsvU16ToRgb_Core(hsv[i]);
+    }
+
+    return count;
+}
@@ -12,6 +12,7 @@ extern "C" {
 
 #include "import_exports.h"
 #include "chizl_colors_types.h"
+#include <stddef.h>             // For size_t
 
 /// <summary>
 /// Converts an RGB color to its HSV (Hue, Saturation, Value) equivalent.
@@ -28,6 +29,88 @@ CHIZL_COLORS_API HsvSpace RgbToHsv(RgbColor rgb);
 /// <returns>RGB Color</returns>
 CHIZL_COLORS_API RgbColor HsvToRgb(HsvSpace hsv);
 
+/// <summary>
+/// Converts an array of RGB colors to their HSV (Hue, Saturation, Value) equivalents in a single call.
+/// </summary>
+/// <param name="rgb">Pointer to the first RGB color to convert.</param>
+/// <param name="hsv">Pointer to the first HsvSpace to write.</param>
+/// <param name="count">Number of colors to convert.</param>
+/// <param name="stride">Distance in bytes between output elements, 0 for a tightly packed array.</param>
+/// <returns>The number of colors converted, 0 if either pointer is NULL.</returns>
+CHIZL_COLORS_API size_t RgbToHsvBatch(const RgbColor* rgb, HsvSpace* hsv, size_t count, size_t stride);
+
+// --- Float (single precision) variants, see chizl_colors_types.h for accuracy ---
+
+/// <summary>
+/// Float version of RgbToHsv, the double result rounded to float.
+/// </summary>
+/// <param name="rgb">RGB Color</param>
+/// <returns>HsvSpaceF struct</returns>
+CHIZL_COLORS_API HsvSpaceF RgbToHsvF(RgbColor rgb);
+
+/// <summary>
+/// Float version of HsvToRgb.
+/// </summary>
+/// <param name="hsv">HsvSpaceF struct</param>
+/// <returns>RGB Color</returns>
+CHIZL_COLORS_API RgbColor HsvFToRgb(HsvSpaceF hsv);
+
+/// <summary>
+/// Converts an array of RGB colors to HsvSpaceF in a single call.  Half the output memory of RgbToHsvBatch.
+/// </summary>
+/// <param name="rgb">Pointer to the first RGB color to convert.</param>
+/// <param name="hsv">Pointer to the first HsvSpaceF to write.</param>
+/// <param name="count">Number of colors to convert.</param>
+/// <param name="stride">Distance in bytes between output elements, 0 for a tightly packed array.</param>
+/// <returns>The number of colors converted, 0 if either pointer is NULL.</returns>
+CHIZL_COLORS_API size_t RgbToHsvFBatch(const RgbColor* rgb, HsvSpaceF* hsv, size_t count, size_t stride);
+
+/// <summary>
+/// Converts an array of HsvSpaceF colors back to RGB in a single call.
+/// </summary>
+/// <param name="hsv">Pointer to the first HsvSpaceF to convert.</param>
+/// <param name="rgb">Pointer to the first RGB color to write.</param>
+/// <param name="count">Number of colors to convert.</param>
+/// <param name="stride">Distance in bytes between output elements, 0 for a tightly packed array.</param>
+/// <returns>The number of colors converted, 0 if either pointer is NULL.</returns>
+CHIZL_COLORS_API size_t HsvFToRgbBatch(const HsvSpaceF* hsv, RgbColor* rgb, size_t count, size_t stride);
+
+// --- 16-bit fixed point variants, integer math only, see chizl_colors_types.h for accuracy ---
+
+/// <summary>
+/// Fixed point version of RgbToHsv, every field 0 - 65535.
+/// </summary>
+/// <param name="rgb">RGB Color</param>
+/// <returns>HsvSpaceU16 struct</returns>
+CHIZL_COLORS_API HsvSpaceU16 RgbToHsvU16(RgbColor rgb);
+
+/// <summary>
+/// Fixed point version of HsvToRgb.  Returns the original color for anything RgbToHsvU16 produced.
+/// </summary>
+/// <param name="hsv">HsvSpaceU16 struct</param>
+/// <returns>RGB Color</returns>
+CHIZL_COLORS_API RgbColor HsvU16ToRgb(HsvSpaceU16 hsv);
+
+/// <summary>
+/// Converts an array of RGB colors to HsvSpaceU16 in a single call.
+/// </summary>
+/// <param name="rgb">Pointer to the first RGB color to convert.</param>
+/// <param name="hsv">Pointer to the first HsvSpaceU16 to write.</param>
+/// <param name="count">Number of colors to convert.</param>
+/// <param name="stride">Distance in bytes between output elements, 0 for a tightly packed array.</param>
+/// <returns>The number of colors converted, 0 if either pointer is NULL.</returns>
+CHIZL_COLORS_API size_t RgbToHsvU16Batch(const RgbColor* rgb, HsvSpaceU16* hsv, size_t count, size_t stride);
+
+/// <summary>
+/// Converts an array of HsvSpaceU16 colors back to RGB in a single call.
+/// </summary>
+/// <param name="hsv">Pointer to the first HsvSpaceU16 to convert.</param>
+/// <param name="rgb">Pointer to the first RGB color to write.</param>
+/// <param name="count">Number of colors to convert.</param>
+/// <param name="stride">Distance in bytes between output elements, 0 for a tightly packed array.</param>
+/// <returns>The number of colors converted, 0 if either pointer is NULL.</returns>
+CHIZL_COLORS_API size_t HsvU16ToRgbBatch(const HsvSpaceU16* hsv, RgbColor* rgb, size_t count, size_t stride);
+
 // --- End of "extern C" block ---
 #ifdef __cplusplus
 }
@@ -2,35 +2,138 @@
 
 #include "lch_space.h"
 #include "xyz_space.h"          // For RgbToLch -> XyzToLab and XyzToLab
+#include "cie_common.h"         // For RgbToXyz_Core, XyzToLab_White, LabToLch_Core
 #include "common.h"             // For clampInt, clampDbl
 #include <string.h>             // For strlen, strcpy_s
 #include <math.h>               // For fmin, fmax, fabs, round, pow
 
 CHIZL_COLORS_API LchSpace RgbToLch(RgbColor rgb)
 {
-    XyzSpace xyz = RgbToXyz(rgb);
-    LabSpace lab = XyzToLab(xyz);
-	return LabToLch(lab);
+    XyzSpace xyz = RgbToXyz_Core(rgb, SrgbLinearTable());
+    LabSpace lab = XyzToLab_White(xyz, WP_D65_FULL);
+	return LabToLch_Core(lab);
 }
 
 CHIZL_COLORS_API LchSpace LabToLch(LabSpace lab)
 {
-    double a = lab.a;
-    double b = lab.b;
+    return LabToLch_Core(lab);
+}
+
+CHIZL_COLORS_API size_t RgbToLchBatch(const RgbColor* rgb, LchSpace* lch, size_t count, size_t stride)
+{
+    if (rgb == NULL || lch == NULL)
+        return 0;
 
-    double C = sqrt(a * a + b * b);
-    double H = 0.0;
+    const double* linear = SrgbLinearTable();
+    const WhitePoint wp = WP_D65_FULL;      // Same default XyzToLab uses for RgbToLch
 
-    if (C < CHIZL_LCH_CHROMA_EPS) {
-        C = 0.0;
-        H = 0.0;
+    if (isPackedStride(stride, sizeof(LchSpace)))
+    {
+        for (size_t i = 0; i < count; i++)
+            lch[i] = LabToLch_Core(XyzToLab_White(RgbToXyz_Core(rgb[i], linear), wp));
     }
-    else {
-        H = atan2(b, a) * (180.0 / CHIZL_PI);
-        if (H < 0.0) //H += 360.0;
-            H = fmod(H + 360.0, 360.0);
+    else
+    {
+        for (size_t i = 0; i < count; i++)
+            *(LchSpace*)stridedAt(lch, i, stride, sizeof(LchSpace)) = LabToLch_Core(XyzToLab_White(RgbToXyz_Core(rgb[i], linear), wp));
     }
 
-    LchSpace lch = { lab.l, C, H };
+    return count;
+}
+
+CHIZL_COLORS_API LabSpace LchToLab(LchSpace lch)
+{
+    return LchToLab_Core(lch);
+}
+
+CHIZL_COLORS_API RgbColor LchToRgb(LchSpace lch)
+{
+    return XyzToRgb_Core(LabToXyz_White(LchToLab_Core(lch), WP_D65_FULL));
+}
+
+CHIZL_COLORS_API size_t LchToRgbBatch(const LchSpace* lch, RgbColor* rgb, size_t count, size_t stride)
+{
+    if (lch == NULL || rgb == NULL)
+        return 0;
+
+    const WhitePoint wp = WP_D65_FULL;      // Same default as RgbToLch
+
+    if (isPackedStride(stride, sizeof(RgbColor)))
+    {
+        for (size_t i = 0; i < count; i++)
+            rgb[i] = XyzToRgb_Core(LabToXyz_White(LchToLab_Core(lch[i]), wp));
+    }
+    else
+    {
+        for (size_t i = 0; i < count; i++)
+            *(RgbColor*)stridedAt(rgb, i, stride, sizeof(RgbColor)) = XyzToRgb_Core(LabToXyz_White(LchToLab_Core(lch[i]), wp));
+    }
+
+    return count;
+}
+
+// Float variants: same math in double, rounded to float once on the way out.
+static inline LchSpaceF LchToF(LchSpace lch)
+{
+    LchSpaceF f = { (float)lch.l, (float)lch.c, (float)lch.h };
+    return f;
+}
+
+static inline LchSpace LchFromF(LchSpaceF f)
+{
+    LchSpace lch = { f.l, f.c, f.h };
     return lch;
-}
\ No newline at end of file
+}
+
+CHIZL_COLORS_API LchSpaceF RgbToLchF(RgbColor rgb)
+{
+    return LchToF(LabToLch_Core(XyzToLab_White(RgbToXyz_Core(rgb, SrgbLinearTable()), WP_D65_FULL)));
+}
+
+CHIZL_COLORS_API RgbColor LchFToRgb(LchSpaceF lch)
+{
+    return XyzToRgb_Core(LabToXyz_White(LchToLab_Core(LchFromF(lch)), WP_D65_FULL));
+}
+
+CHIZL_COLORS_API size_t RgbToLchFBatch(const RgbColor* rgb, LchSpaceF* lch, size_t count, size_t stride)
+{
+    if (rgb == NULL || lch == NULL)
+        return 0;
+
+    const double* linear = SrgbLinearTable();
+    const WhitePoint wp = WP_D65_FULL;      // Same default XyzToLab uses for RgbToLch
+
+    if (isPackedStride(stride, sizeof(LchSpaceF)))
+    {
+        for (size_t i = 0; i < count; i++)
+            lch[i] = LchToF(LabToLch_Core(XyzToLab_White(RgbToXyz_Core(rgb[i], linear), wp)));
+    }
+    else
+    {
+        for (size_t i = 0; i < count; i++)
+            *(LchSpaceF*)stridedAt(lch, i, stride, sizeof(LchSpaceF)) = LchToF(LabToLch_Core(XyzToLab_White(RgbToXyz_Core(rgb[i], linear), wp)));
+    }
+
+    return count;
+}
+
+CHIZL_COLORS_API size_t LchFToRgbBatch(const LchSpaceF* lch, RgbColor* rgb, size_t count, size_t stride)
+{
+    if (lch == NULL || rgb == NULL)
+        return 0;
+
+    const WhitePoint wp = WP_D65_FULL;      // Same default as RgbToLch
+
+    if (isPackedStride(stride, sizeof(RgbColor)))
+    {
+        for (size_t i = 0; i < count; i++)
+            rgb[i] = XyzToRgb_Core(LabToXyz_White(LchToLab_Core(LchFromF(lch[i])), wp));
+    }
+    else
+    {
+        for (size_t i = 0; i < count; i++)
+            *(RgbColor*)stridedAt(rgb, i, stride, sizeof(RgbColor)) = XyzToRgb_Core(LabToXyz_White(LchToLab_Core(LchFromF(lch[i])), wp));
+    }
+
+    return count;
+}
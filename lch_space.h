@@ -12,6 +12,7 @@ extern "C" {
 
 #include "import_exports.h"
 #include "chizl_colors_types.h"
+#include <stddef.h>             // For size_t
 
 /// <summary>
 /// Converts an RGB color to the LCH (Lightness, Chroma, Hue) color space.
@@ -26,6 +27,78 @@ CHIZL_COLORS_API LchSpace RgbToLch(RgbColor rgb);
 /// <returns>The color converted to LCH color space.</returns>
 CHIZL_COLORS_API LchSpace LabToLch(LabSpace lab);
 
+/// <summary>
+/// Converts an array of RGB colors to the LCH (Lightness, Chroma, Hue) color space in a single call.
+/// </summary>
+/// <param name="rgb">Pointer to the first RGB color to convert.</param>
+/// <param name="lch">Pointer to the first LchSpace to write.</param>
+/// <param name="count">Number of colors to convert.</param>
+/// <param name="stride">Distance in bytes between output elements, 0 for a tightly packed array.</param>
+/// <returns>The number of colors converted, 0 if either pointer is NULL.</returns>
+CHIZL_COLORS_API size_t RgbToLchBatch(const RgbColor* rgb, LchSpace* lch, size_t count, size_t stride);
+
+/// <summary>
+/// Converts a color from LCH color space back to LAB color space.
+/// </summary>
+/// <param name="lch">The color in LCH color space to convert.</param>
+/// <returns>The color converted to LAB color space.</returns>
+CHIZL_COLORS_API LabSpace LchToLab(LchSpace lch);
+
+/// <summary>
+/// Converts a color from LCH color space back to RGB.  Out of gamut colors are clamped to 0-255.<br/>
+/// (Default: WP_D65_FULL white point is used for the Lab to XYZ step.)
+/// </summary>
+/// <param name="lch">The color in LCH color space to convert.</param>
+/// <returns>The converted RGB color, alpha is set to 255.</returns>
+CHIZL_COLORS_API RgbColor LchToRgb(LchSpace lch);
+
+/// <summary>
+/// Converts an array of LCH colors back to RGB in a single call, without leaving native code.<br/>
+/// (Default: WP_D65_FULL white point is used for the Lab to XYZ step.)
+/// </summary>
+/// <param name="lch">Pointer to the first LchSpace to convert.</param>
+/// <param name="rgb">Pointer to the first RgbColor to write.</param>
+/// <param name="count">Number of colors to convert.</param>
+/// <param name="stride">Distance in bytes between output elements, 0 for a tightly packed array.</param>
+/// <returns>The number of colors converted, 0 if either pointer is NULL.</returns>
+CHIZL_COLORS_API size_t LchToRgbBatch(const LchSpace* lch, RgbColor* rgb, size_t count, size_t stride);
+
+// --- Float (single precision) variants, see chizl_colors_types.h for accuracy ---
+
+/// <summary>
+/// Float version of RgbToLch, the double result rounded to float.
+/// </summary>
+/// <param name="rgb">RGB Color</param>
+/// <returns>LchSpaceF struct</returns>
+CHIZL_COLORS_API LchSpaceF RgbToLchF(RgbColor rgb);
+
+/// <summary>
+/// Float version of LchToRgb.
+/// </summary>
+/// <param name="lch">LchSpaceF struct</param>
+/// <returns>RGB Color</returns>
+CHIZL_COLORS_API RgbColor LchFToRgb(LchSpaceF lch);
+
+/// <summary>
+/// Converts an array of RGB colors to LchSpaceF in a single call.  Half the output memory of RgbToLchBatch.
+/// </summary>
+/// <param name="rgb">Pointer to the first RGB color to convert.</param>
+/// <param name="lch">Pointer to the first LchSpaceF to write.</param>
+/// <param name="count">Number of colors to convert.</param>
+/// <param name="stride">Distance in bytes between output elements, 0 for a tightly packed array.</param>
+/// <returns>The number of colors converted, 0 if either pointer is NULL.</returns>
+CHIZL_COLORS_API size_t RgbToLchFBatch(const RgbColor* rgb, LchSpaceF* lch, size_t count, size_t stride);
+
+/// <summary>
+/// Converts an array of LchSpaceF colors back to RGB in a single call.
+/// </summary>
+/// <param name="lch">Pointer to the first LchSpaceF to convert.</param>
+/// <param name="rgb">Pointer to the first RGB color to write.</param>
+/// <param name="count">Number of colors to convert.</param>
+/// <param name="stride">Distance in bytes between output elements, 0 for a tightly packed array.</param>
+/// <returns>The number of colors converted, 0 if either pointer is NULL.</returns>
+CHIZL_COLORS_API size_t LchFToRgbBatch(const LchSpaceF* lch, RgbColor* rgb, size_t count, size_t stride);
+
 // --- End of "extern C" block ---
 #ifdef __cplusplus
 }
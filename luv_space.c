@@ -2,63 +2,161 @@
 
 #include "luv_space.h"
 #include "xyz_space.h"          // For RgbToLch -> XyzToLab and XyzToLab
+#include "cie_common.h"         // For RgbToXyz_Core, XyzToLuv_White
+#include "white_points_core.h"  // For WhitePointInfoFromType
 #include "common.h"             // For clampInt, clampDbl
 #include <string.h>             // For strlen, strcpy_s
 #include <math.h>               // For fmin, fmax, fabs, round, pow
 
 CHIZL_COLORS_API LuvSpace XyzToLuvEx(XyzSpace xyz, WhitePointType wp)
 {
-    double wpX, wpY, wpZ = 0.0;
+    // u'n / v'n come precomputed with the registry entry.
+    const WhitePointInfo white = WhitePointInfoFromType(wp);
+    return XyzToLuv_White(xyz, white.wp, white.un_prime, white.vn_prime);
+}
+
+CHIZL_COLORS_API LuvSpace XyzToLuv(XyzSpace xyz)
+{
+    return XyzToLuvEx(xyz, WPID_D65_FULL);      // Default: WP_D65_FULL, WPID_D65 is the other option
+}
+
+CHIZL_COLORS_API LuvSpace RgbToLuv(RgbColor	rgb) 
+{
+	XyzSpace xyz = RgbToXyz_Core(rgb, SrgbLinearTable());
+    return XyzToLuvEx(xyz, WPID_D65_FULL);      // Default: WP_D65_FULL, WPID_D65 is the other option
+}
+
+CHIZL_COLORS_API size_t RgbToLuvBatch(const RgbColor* rgb, LuvSpace* luv, size_t count, size_t stride)
+{
+    if (rgb == NULL || luv == NULL)
+        return 0;
+
+    const double* linear = SrgbLinearTable();
+    const WhitePoint wp = WP_D65_FULL;      // Default: WP_D65_FULL, same as RgbToLuv
+    double un_prime, vn_prime;
+    LuvWhiteChromaticity(wp, &un_prime, &vn_prime);
 
-    switch (wp)
+    if (isPackedStride(stride, sizeof(LuvSpace)))
+    {
+        for (size_t i = 0; i < count; i++)
+            luv[i] = XyzToLuv_White(RgbToXyz_Core(rgb[i], linear), wp, un_prime, vn_prime);
+    }
+    else
     {
-    case WPID_D65_FULL:
-        wpX = WP_D65_FULL.x;
-        wpY = WP_D65_FULL.y;
-        wpZ = WP_D65_FULL.z;
-        break;
-    case WPID_D65:
-    default:
-        wpX = WP_D65.x;
-        wpY = WP_D65.y;
-        wpZ = WP_D65.z;
-        break;
+        for (size_t i = 0; i < count; i++)
+            *(LuvSpace*)stridedAt(luv, i, stride, sizeof(LuvSpace)) = XyzToLuv_White(RgbToXyz_Core(rgb[i], linear), wp, un_prime, vn_prime);
     }
 
-    //// Calculate reference white point chromaticity coordinates (u'n, v'n)
-    double un_prime = (4 * wpX) / (wpX + (15 * wpY) + (3 * wpZ));
-    double vn_prime = (9 * wpY) / (wpX + (15 * wpY) + (3 * wpZ));
+    return count;
+}
+
+CHIZL_COLORS_API XyzSpace LuvToXyzEx(LuvSpace luv, WhitePointType wp)
+{
+    const WhitePointInfo white = WhitePointInfoFromType(wp);
+    return LuvToXyz_White(luv, white.wp, white.un_prime, white.vn_prime);
+}
+
+CHIZL_COLORS_API XyzSpace LuvToXyz(LuvSpace luv)
+{
+    return LuvToXyzEx(luv, WPID_D65_FULL);      // Default: WP_D65_FULL, WPID_D65 is the other option
+}
+
+CHIZL_COLORS_API RgbColor LuvToRgb(LuvSpace luv)
+{
+    return XyzToRgb_Core(LuvToXyzEx(luv, WPID_D65_FULL));
+}
 
-    //// Calculate sample chromaticity coordinates (u', v')
-    double divisor = (xyz.x + (15 * xyz.y) + (3 * xyz.z));
-    double u_prime = (divisor == 0) ? 0 : (4 * xyz.x) / divisor;
-    double v_prime = (divisor == 0) ? 0 : (9 * xyz.y) / divisor;
+CHIZL_COLORS_API size_t LuvToRgbBatch(const LuvSpace* luv, RgbColor* rgb, size_t count, size_t stride)
+{
+    if (luv == NULL || rgb == NULL)
+        return 0;
 
-    //// Calculate L*
-    const double delta = 6.0 / 29.0;
-    const double deltaCubed = (delta * delta * delta); // (6/29)^3
+    // White point chromaticity is the same for every color, work it out once.
+    const WhitePoint wp = WP_D65_FULL;      // Default: WP_D65_FULL, same as RgbToLuv
+    double un_prime, vn_prime;
+    LuvWhiteChromaticity(wp, &un_prime, &vn_prime);
 
-    double l, u, v = 0.0;
-    if ((xyz.y / wpY) > deltaCubed)
-        l = 116 * pow(xyz.y / wpY, 1.0 / 3.0) - 16;
+    if (isPackedStride(stride, sizeof(RgbColor)))
+    {
+        for (size_t i = 0; i < count; i++)
+            rgb[i] = XyzToRgb_Core(LuvToXyz_White(luv[i], wp, un_prime, vn_prime));
+    }
     else
-        l = (29.0 / 6.0) * (29.0 / 6.0) * (29.0 / 6.0) * (xyz.y / wpY);
+    {
+        for (size_t i = 0; i < count; i++)
+            *(RgbColor*)stridedAt(rgb, i, stride, sizeof(RgbColor)) = XyzToRgb_Core(LuvToXyz_White(luv[i], wp, un_prime, vn_prime));
+    }
 
-    //// Calculate u* and v*
-    u = 13 * l * (u_prime - un_prime);
-    v = 13 * l * (v_prime - vn_prime);
+    return count;
+}
+
+// Float variants: same math in double, rounded to float once on the way out.
+static inline LuvSpaceF LuvToF(LuvSpace luv)
+{
+    LuvSpaceF f = { (float)luv.l, (float)luv.u, (float)luv.v };
+    return f;
+}
 
-    LuvSpace luv = { l, u, v };
+static inline LuvSpace LuvFromF(LuvSpaceF f)
+{
+    LuvSpace luv = { f.l, f.u, f.v };
     return luv;
 }
 
-CHIZL_COLORS_API LuvSpace XyzToLuv(XyzSpace xyz)
+CHIZL_COLORS_API LuvSpaceF RgbToLuvF(RgbColor rgb)
 {
-    return XyzToLuvEx(xyz, WPID_D65_FULL);      // Default: WP_D65_FULL, WPID_D65 is the other option
+    const WhitePointInfo white = WhitePointInfoFromType(WPID_D65_FULL);
+    return LuvToF(XyzToLuv_White(RgbToXyz_Core(rgb, SrgbLinearTable()), white.wp, white.un_prime, white.vn_prime));
 }
 
-CHIZL_COLORS_API LuvSpace RgbToLuv(RgbColor	rgb) 
+CHIZL_COLORS_API RgbColor LuvFToRgb(LuvSpaceF luv)
 {
-	XyzSpace xyz = RgbToXyz(rgb);
-    return XyzToLuvEx(xyz, WPID_D65_FULL);      // Default: WP_D65_FULL, WPID_D65 is the other option
-}
\ No newline at end of file
+    return XyzToRgb_Core(LuvToXyzEx(LuvFromF(luv), WPID_D65_FULL));
+}
+
+CHIZL_COLORS_API size_t RgbToLuvFBatch(const RgbColor* rgb, LuvSpaceF* luv, size_t count, size_t stride)
+{
+    if (rgb == NULL || luv == NULL)
+        return 0;
+
+    const double* linear = SrgbLinearTable();
+    const WhitePoint wp = WP_D65_FULL;      // Default: WP_D65_FULL, same as RgbToLuv
+    double un_prime, vn_prime;
+    LuvWhiteChromaticity(wp, &un_prime, &vn_prime);
+
+    if (isPackedStride(stride, sizeof(LuvSpaceF)))
+    {
+        for (size_t i = 0; i < count; i++)
+            luv[i] = LuvToF(XyzToLuv_White(RgbToXyz_Core(rgb[i], linear), wp, un_prime, vn_prime));
+    }
+    else
+    {
+        for (size_t i = 0; i < count; i++)
+            *(LuvSpaceF*)stridedAt(luv, i, stride, sizeof(LuvSpaceF)) = LuvToF(XyzToLuv_White(RgbToXyz_Core(rgb[i], linear), wp, un_prime, vn_prime));
+    }
+
+    return count;
+}
+
+CHIZL_COLORS_API size_t LuvFToRgbBatch(const LuvSpaceF* luv, RgbColor* rgb, size_t count, size_t stride)
+{
+    if (luv == NULL || rgb == NULL)
+        return 0;
+
+    const WhitePoint wp = WP_D65_FULL;      // Default: WP_D65_FULL, same as RgbToLuv
+    double un_prime, vn_prime;
+    LuvWhiteChromaticity(wp, &un_prime, &vn_prime);
+
+    if (isPackedStride(stride, sizeof(RgbColor)))
+    {
+        for (size_t i = 0; i < count; i++)
+            rgb[i] = XyzToRgb_Core(LuvToXyz_White(LuvFromF(luv[i]), wp, un_prime, vn_prime));
+    }
+    else
+    {
+        for (size_t i = 0; i < count; i++)
+            *(RgbColor*)stridedAt(rgb, i, stride, sizeof(RgbColor)) = XyzToRgb_Core(LuvToXyz_White(LuvFromF(luv[i]), wp, un_prime, vn_prime));
+    }
+
+    return count;
+}
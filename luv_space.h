@@ -13,6 +13,7 @@ extern "C" {
 #include "import_exports.h"
 #include "chizl_colors_types.h"
 #include "white_points.h"       // For white point definitions used in XYZ to Lab conversions.
+#include <stddef.h>             // For size_t
 
 
 /// <summary>
@@ -37,6 +38,88 @@ CHIZL_COLORS_API LuvSpace XyzToLuvEx(XyzSpace xyz, WhitePointType wp);
 /// <returns>The color represented in the CIE Luv color space.</returns>
 CHIZL_COLORS_API LuvSpace RgbToLuv(RgbColor	rgb);
 
+/// <summary>
+/// Converts an array of RGB colors to the CIE Luv color space in a single call.<br/>
+/// (Default: WP_D65_FULL white point is used between XYZ to Luv for this conversion.)
+/// </summary>
+/// <param name="rgb">Pointer to the first RGB color to convert.</param>
+/// <param name="luv">Pointer to the first LuvSpace to write.</param>
+/// <param name="count">Number of colors to convert.</param>
+/// <param name="stride">Distance in bytes between output elements, 0 for a tightly packed array.</param>
+/// <returns>The number of colors converted, 0 if either pointer is NULL.</returns>
+CHIZL_COLORS_API size_t RgbToLuvBatch(const RgbColor* rgb, LuvSpace* luv, size_t count, size_t stride);
+
+/// <summary>
+/// Converts a color from Luv color space back to XYZ color space.<br/>
+/// (Default: WP_D65_FULL white point is used for the conversion.)
+/// </summary>
+/// <param name="luv">The color in Luv color space to convert.</param>
+/// <returns>The color converted to XYZ color space.</returns>
+CHIZL_COLORS_API XyzSpace LuvToXyz(LuvSpace luv);
+
+/// <summary>
+/// Converts a color from Luv color space back to XYZ color space using a specified white point.
+/// </summary>
+/// <param name="luv">The color in Luv color space to convert.</param>
+/// <param name="wp">The white point type the Luv color was created with.</param>
+/// <returns>The color converted to XYZ color space.</returns>
+CHIZL_COLORS_API XyzSpace LuvToXyzEx(LuvSpace luv, WhitePointType wp);
+
+/// <summary>
+/// Converts a color from Luv color space back to RGB.  Out of gamut colors are clamped to 0-255.<br/>
+/// (Default: WP_D65_FULL white point is used for the conversion.)
+/// </summary>
+/// <param name="luv">The color in Luv color space to convert.</param>
+/// <returns>The converted RGB color, alpha is set to 255.</returns>
+CHIZL_COLORS_API RgbColor LuvToRgb(LuvSpace luv);
+
+/// <summary>
+/// Converts an array of Luv colors back to RGB in a single call.<br/>
+/// (Default: WP_D65_FULL white point is used for the conversion.)
+/// </summary>
+/// <param name="luv">Pointer to the first LuvSpace to convert.</param>
+/// <param name="rgb">Pointer to the first RgbColor to write.</param>
+/// <param name="count">Number of colors to convert.</param>
+/// <param name="stride">Distance in bytes between output elements, 0 for a tightly packed array.</param>
+/// <returns>The number of colors converted, 0 if either pointer is NULL.</returns>
+CHIZL_COLORS_API size_t LuvToRgbBatch(const LuvSpace* luv, RgbColor* rgb, size_t count, size_t stride);
+
+
+// --- Float (single precision) variants, see chizl_colors_types.h for accuracy ---
+
+/// <summary>
+/// Float version of RgbToLuv, the double result rounded to float.
+/// </summary>
+/// <param name="rgb">RGB Color</param>
+/// <returns>LuvSpaceF struct</returns>
+CHIZL_COLORS_API LuvSpaceF RgbToLuvF(RgbColor rgb);
+
+/// <summary>
+/// Float version of LuvToRgb.
+/// </summary>
+/// <param name="luv">LuvSpaceF struct</param>
+/// <returns>RGB Color</returns>
+CHIZL_COLORS_API RgbColor LuvFToRgb(LuvSpaceF luv);
+
+/// <summary>
+/// Converts an array of RGB colors to LuvSpaceF in a single call.  Half the output memory of RgbToLuvBatch.
+/// </summary>
+/// <param name="rgb">Pointer to the first RGB color to convert.</param>
+/// <param name="luv">Pointer to the first LuvSpaceF to write.</param>
+/// <param name="count">Number of colors to convert.</param>
+/// <param name="stride">Distance in bytes between output elements, 0 for a tightly packed array.</param>
+/// <returns>The number of colors converted, 0 if either pointer is NULL.</returns>
+CHIZL_COLORS_API size_t RgbToLuvFBatch(const RgbColor* rgb, LuvSpaceF* luv, size_t count, size_t stride);
+
+/// <summary>
+/// Converts an array of LuvSpaceF colors back to RGB in a single call.
+/// </summary>
+/// <param name="luv">Pointer to the first LuvSpaceF to convert.</param>
+/// <param name="rgb">Pointer to the first RGB color to write.</param>
+/// <param name="count">Number of colors to convert.</param>
+/// <param name="stride">Distance in bytes between output elements, 0 for a tightly packed array.</param>
+/// <returns>The number of colors converted, 0 if either pointer is NULL.</returns>
+CHIZL_COLORS_API size_t LuvFToRgbBatch(const LuvSpaceF* luv, RgbColor* rgb, size_t count, size_t stride);
 
 // --- End of "extern C" block ---
 #ifdef __cplusplus
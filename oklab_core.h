@@ -0,0 +1,98 @@
+// oklab_core.h
+#pragma once
+
+#ifndef OKLAB_CORE_H
+#define OKLAB_CORE_H
+
+// Internal only, not part of the public API.
+// Shared inline math for OKLab / OKLCh, so the batch loops in oklab_space.c and the scalar tail of
+// the SIMD kernel run the same expressions.  Matrices are Bjorn Ottosson's published linear sRGB
+// versions (https://bottosson.github.io/posts/oklab/), input is linear sRGB from SrgbLinearTable().
+
+#include "chizl_colors_types.h"
+#include "common.h"             // For CHIZL_PI, CHIZL_OKLCH_CHROMA_EPS
+#include "cie_common.h"         // For LinearRgbToRgb_Core
+#include <math.h>               // For cbrt, sqrt, atan2, fmod, cos, sin
+
+/// <summary>
+/// Linear sRGB (0.0-1.0) to OKLab.
+/// </summary>
+static inline OkLabSpace LinearRgbToOkLab_Core(double r, double g, double b)
+{
+    // Linear sRGB to cone response (LMS), already D65 adapted.
+    const double l = cbrt(0.4122214708 * r + 0.5363325363 * g + 0.0514459929 * b);
+    const double m = cbrt(0.2119034982 * r + 0.6806995451 * g + 0.1073969566 * b);
+    const double s = cbrt(0.0883024619 * r + 0.2817188376 * g + 0.6299787005 * b);
+
+    OkLabSpace lab = {
+        0.2104542553 * l + 0.7936177850 * m - 0.0040720468 * s,
+        1.9779984951 * l - 2.4285922050 * m + 0.4505937099 * s,
+        0.0259040371 * l + 0.7827717662 * m - 0.8086757660 * s
+    };
+    return lab;
+}
+
+static inline OkLabSpace RgbToOkLab_Core(RgbColor rgb, const double* linear)
+{
+    return LinearRgbToOkLab_Core(linear[rgb.red], linear[rgb.green], linear[rgb.blue]);
+}
+
+/// <summary>
+/// OKLab to linear sRGB, unclamped.  Components outside 0.0-1.0 mean the color is out of the sRGB gamut.
+/// </summary>
+static inline void OkLabToLinearRgb_Core(OkLabSpace lab, double* r, double* g, double* b)
+{
+    const double l1 = lab.l + 0.3963377774 * lab.a + 0.2158037573 * lab.b;
+    const double m1 = lab.l - 0.1055613458 * lab.a - 0.0638541728 * lab.b;
+    const double s1 = lab.l - 0.0894841775 * lab.a - 1.2914855480 * lab.b;
+
+    const double l = l1 * l1 * l1;
+    const double m = m1 * m1 * m1;
+    const double s = s1 * s1 * s1;
+
+    *r = 4.0767416621 * l - 3.3077115913 * m + 0.2309699292 * s;
+    *g = -1.2684380046 * l + 2.6097574011 * m - 0.3413193965 * s;
+    *b = -0.0041960863 * l - 0.7034186147 * m + 1.7076147010 * s;
+}
+
+/// <summary>
+/// OKLab back to RGB.  Out of gamut values are clamped, alpha is 255.
+/// </summary>
+static inline RgbColor OkLabToRgb_Core(OkLabSpace lab)
+{
+    double r, g, b;
+    OkLabToLinearRgb_Core(lab, &r, &g, &b);
+    return LinearRgbToRgb_Core(r, g, b);
+}
+
+static inline OkLabSpace OkLchToOkLab_Core(OkLchSpace lch)
+{
+    const double h = lch.h * (CHIZL_PI / 180.0);
+
+    OkLabSpace lab = {
+        lch.l,
+        lch.c * cos(h),
+        lch.c * sin(h)
+    };
+    return lab;
+}
+
+static inline OkLchSpace OkLabToOkLch_Core(OkLabSpace lab)
+{
+    double c = sqrt(lab.a * lab.a + lab.b * lab.b);
+    double h = 0.0;
+
+    if (c < CHIZL_OKLCH_CHROMA_EPS)
+        c = 0.0;
+    else
+    {
+        h = atan2(lab.b, lab.a) * (180.0 / CHIZL_PI);
+        if (h < 0.0)
+            h = fmod(h + 360.0, 360.0);
+    }
+
+    OkLchSpace lch = { lab.l, c, h };
+    return lch;
+}
+
+#endif
@@ -0,0 +1,104 @@
+// oklab_space.c
+#include "oklab_space.h"
+#include "oklab_core.h"         // For RgbToOkLab_Core, OkLabToRgb_Core, OkLabToOkLch_Core, OkLchToOkLab_Core
+#include "simd_kernels.h"       // For RgbToOkLabKernel
+#include "srgb_linear.h"        // For SrgbLinearTable
+#include "common.h"             // For stridedAt, isPackedStride
+
+CHIZL_COLORS_API OkLabSpace RgbToOkLab(RgbColor rgb)
+{
+    return RgbToOkLab_Core(rgb, SrgbLinearTable());
+}
+
+CHIZL_COLORS_API RgbColor OkLabToRgb(OkLabSpace lab)
+{
+    return OkLabToRgb_Core(lab);
+}
+
+CHIZL_COLORS_API OkLchSpace RgbToOkLch(RgbColor rgb)
+{
+    return OkLabToOkLch_Core(RgbToOkLab_Core(rgb, SrgbLinearTable()));
+}
+
+CHIZL_COLORS_API RgbColor OkLchToRgb(OkLchSpace lch)
+{
+    return OkLabToRgb_Core(OkLchToOkLab_Core(lch));
+}
+
+CHIZL_COLORS_API OkLchSpace OkLabToOkLch(OkLabSpace lab)
+{
+    return OkLabToOkLch_Core(lab);
+}
+
+CHIZL_COLORS_API OkLabSpace OkLchToOkLab(OkLchSpace lch)
+{
+    return OkLchToOkLab_Core(lch);
+}
+
+CHIZL_COLORS_API size_t RgbToOkLabBatch(const RgbColor* rgb, OkLabSpace* lab, size_t count, size_t stride)
+{
+    if (rgb == NULL || lab == NULL)
+        return 0;
+
+    // Vectorized (AVX2 / SSE4.1) when the CPU supports it, see simd_kernels.c.
+    RgbToOkLabKernel(rgb, lab, count, stride, SrgbLinearTable());
+
+    return count;
+}
+
+CHIZL_COLORS_API size_t OkLabToRgbBatch(const OkLabSpace* lab, RgbColor* rgb, size_t count, size_t stride)
+{
+    if (lab == NULL || rgb == NULL)
+        return 0;
+
+    if (isPackedStride(stride, sizeof(RgbColor)))
+    {
+        for (size_t i = 0; i < count; i++)
+            rgb[i] = OkLabToRgb_Core(lab[i]);
+    }
+    else
+    {
+        for (size_t i = 0; i < count; i++)
+            *(RgbColor*)stridedAt(rgb, i, stride, sizeof(RgbColor)) = OkLabToRgb_Core(lab[i]);
+    }
+
+    return count;
+}
+
+CHIZL_COLORS_API size_t RgbToOkLchBatch(const RgbColor* rgb, OkLchSpace* lch, size_t count, size_t stride)
+{
+    if (rgb == NULL || lch == NULL)
+        return 0;
+
+    // OkLabSpace and OkLchSpace are both three doubles: the kernel writes OKLab straight into the
+    // output, then each element is turned into OKLCh in place.
+    RgbToOkLabKernel(rgb, (OkLabSpace*)lch, count, stride, SrgbLinearTable());
+
+    for (size_t i = 0; i < count; i++)
+    {
+        OkLchSpace* dst = (OkLchSpace*)stridedAt(lch, i, stride, sizeof(OkLchSpace));
+        const OkLabSpace lab = { dst->l, dst->c, dst->h };
+        *dst = OkLabToOkLch_Core(lab);
+    }
+
+    return count;
+}
+
+CHIZL_COLORS_API size_t OkLchToRgbBatch(const OkLchSpace* lch, RgbColor* rgb, size_t count, size_t stride)
+{
+    if (lch == NULL || rgb == NULL)
+        return 0;
+
+    if (isPackedStride(stride, sizeof(RgbColor)))
+    {
+        for (size_t i = 0; i < count; i++)
+            rgb[i] = OkLabToRgb_Core(OkLchToOkLab_Core(lch[i]));
+    }
+    else
+    {
+        for (size_t i = 0; i < count; i++)
+            *(RgbColor*)stridedAt(rgb, i, stride, sizeof(RgbColor)) = OkLabToRgb_Core(OkLchToOkLab_Core(lch[i]));
+    }
+
+    return count;
+}
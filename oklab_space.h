@@ -0,0 +1,104 @@
+// oklab_space.h
+
+#pragma once
+
+#ifndef OKLAB_SPACE_H
+#define OKLAB_SPACE_H
+
+// --- Start of "extern C" block ---
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "import_exports.h"
+#include "chizl_colors_types.h"
+#include <stddef.h>             // For size_t
+
+/// <summary>
+/// Converts an RGB color to OKLab.  Two 3x3 matrices and a cube root on linear sRGB, no white point
+/// divide and no linear toe, so it is cheaper than RgbToLab.
+/// </summary>
+/// <param name="rgb">The RGB color to convert.</param>
+/// <returns>The color in OKLab, L 0.0 - 1.0.</returns>
+CHIZL_COLORS_API OkLabSpace RgbToOkLab(RgbColor rgb);
+
+/// <summary>
+/// Converts an OKLab color back to RGB.  Out of gamut colors are clamped to 0-255.
+/// </summary>
+/// <param name="lab">The OKLab color to convert.</param>
+/// <returns>The converted RGB color, alpha is set to 255.</returns>
+CHIZL_COLORS_API RgbColor OkLabToRgb(OkLabSpace lab);
+
+/// <summary>
+/// Converts an RGB color to OKLCh.
+/// </summary>
+/// <param name="rgb">The RGB color to convert.</param>
+/// <returns>The color in OKLCh.  Chroma under 0.00003 is treated as gray: chroma and hue 0.</returns>
+CHIZL_COLORS_API OkLchSpace RgbToOkLch(RgbColor rgb);
+
+/// <summary>
+/// Converts an OKLCh color back to RGB.  Out of gamut colors are clamped to 0-255.
+/// </summary>
+/// <param name="lch">The OKLCh color to convert.</param>
+/// <returns>The converted RGB color, alpha is set to 255.</returns>
+CHIZL_COLORS_API RgbColor OkLchToRgb(OkLchSpace lch);
+
+/// <summary>
+/// Converts OKLab to its cylindrical form, OKLCh.
+/// </summary>
+/// <param name="lab">The OKLab color to convert.</param>
+/// <returns>The color in OKLCh.</returns>
+CHIZL_COLORS_API OkLchSpace OkLabToOkLch(OkLabSpace lab);
+
+/// <summary>
+/// Converts OKLCh back to OKLab.
+/// </summary>
+/// <param name="lch">The OKLCh color to convert.</param>
+/// <returns>The color in OKLab.</returns>
+CHIZL_COLORS_API OkLabSpace OkLchToOkLab(OkLchSpace lch);
+
+/// <summary>
+/// Converts an array of RGB colors to OKLab in a single call.  Vectorized (AVX2 / SSE4.1) when the CPU supports it.
+/// </summary>
+/// <param name="rgb">Pointer to the first RGB color to convert.</param>
+/// <param name="lab">Pointer to the first OkLabSpace to write.</param>
+/// <param name="count">Number of colors to convert.</param>
+/// <param name="stride">Distance in bytes between output elements, 0 for a tightly packed array.</param>
+/// <returns>The number of colors converted, 0 if either pointer is NULL.</returns>
+CHIZL_COLORS_API size_t RgbToOkLabBatch(const RgbColor* rgb, OkLabSpace* lab, size_t count, size_t stride);
+
+/// <summary>
+/// Converts an array of OKLab colors back to RGB in a single call.
+/// </summary>
+/// <param name="lab">Pointer to the first OkLabSpace to convert.</param>
+/// <param name="rgb">Pointer to the first RgbColor to write.</param>
+/// <param name="count">Number of colors to convert.</param>
+/// <param name="stride">Distance in bytes between output elements, 0 for a tightly packed array.</param>
+/// <returns>The number of colors converted, 0 if either pointer is NULL.</returns>
+CHIZL_COLORS_API size_t OkLabToRgbBatch(const OkLabSpace* lab, RgbColor* rgb, size_t count, size_t stride);
+
+/// <summary>
+/// Converts an array of RGB colors to OKLCh in a single call.  The OKLab step is vectorized, as in RgbToOkLabBatch.
+/// </summary>
+/// <param name="rgb">Pointer to the first RGB color to convert.</param>
+/// <param name="lch">Pointer to the first OkLchSpace to write.</param>
+/// <param name="count">Number of colors to convert.</param>
+/// <param name="stride">Distance in bytes between output elements, 0 for a tightly packed array.</param>
+/// <returns>The number of colors converted, 0 if either pointer is NULL.</returns>
+CHIZL_COLORS_API size_t RgbToOkLchBatch(const RgbColor* rgb, OkLchSpace* lch, size_t count, size_t stride);
+
+/// <summary>
+/// Converts an array of OKLCh colors back to RGB in a single call.
+/// </summary>
+/// <param name="lch">Pointer to the first OkLchSpace to convert.</param>
+/// <param name="rgb">Pointer to the first RgbColor to write.</param>
+/// <param name="count">Number of colors to convert.</param>
+/// <param name="stride">Distance in bytes between output elements, 0 for a tightly packed array.</param>
+/// <returns>The number of colors converted, 0 if either pointer is NULL.</returns>
+CHIZL_COLORS_API size_t OkLchToRgbBatch(const OkLchSpace* lch, RgbColor* rgb, size_t count, size_t stride);
+
+// --- End of "extern C" block ---
+#ifdef __cplusplus
+}
+#endif
+#endif
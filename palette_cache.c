@@ -0,0 +1,548 @@
+// palette_cache.c
+#include "palette_cache.h"
+#include "palette_index_core.h" // For PaletteIndexNearestSeeded
+#include "cie_common.h"         // For RgbToXyz_Core, XyzToLab_White
+#include "srgb_linear.h"        // For SrgbLinearTable
+#include "chizl_clock.h"        // For ChizlNowMs
+#include <stdint.h>             // For uint16_t, uint32_t, uint64_t
+#include <stdio.h>              // For fopen, fwrite
+#include <stdlib.h>             // For malloc, realloc, free
+#include <string.h>             // For memcpy, memcmp
+
+#if defined(_WIN32) || defined(_WIN64)
+  #ifndef WIN32_LEAN_AND_MEAN
+    #define WIN32_LEAN_AND_MEAN
+  #endif
+  #include <windows.h>          // For CreateFileMapping, MapViewOfFile
+#else
+  #include <fcntl.h>            // For open
+  #include <sys/mman.h>         // For mmap, munmap
+  #include <sys/stat.h>         // For fstat
+  #include <unistd.h>           // For close
+#endif
+
+// Precomputed RGB -> palette index tables.
+//
+// A cache is one contiguous block: file header, palette, table, candidate lists.  The saved file is that
+// block byte for byte, so PaletteCacheLoad maps the file and points straight into it.
+//
+// Reduced cells hold either the palette index (every color in the cell has the same match) or, with the
+// high bit set, the offset and count of a sorted candidate list.  The lists are the distinct matches found
+// for the cell's 64 colors while building, so picking the closest of them is exact.
+
+#define PCACHE_MAGIC "CZPC"
+#define PCACHE_VERSION 1
+#define PCACHE_MAX_COLORS 65536
+#define PCACHE_FULL_ENTRIES (1u << 24)
+#define PCACHE_CELL_ENTRIES (1u << 18)
+#define PCACHE_CELL_MIXED 0x80000000u
+
+typedef struct {
+    char magic[4];              // PCACHE_MAGIC
+    uint32_t version;
+    uint32_t mode;              // PaletteCacheMode
+    uint32_t type;              // DeltaEType
+    uint32_t paletteCount;
+    uint32_t entryBytes;        // Full: 1 or 2, reduced: 4
+    uint64_t mixedCells;
+    uint64_t candidateCount;
+    uint64_t totalBytes;
+} PaletteCacheFile;
+
+struct PaletteCache {
+    const unsigned char* data;  // Block or mapped view, starts with PaletteCacheFile
+    size_t bytes;
+    const PaletteCacheFile* head;
+    const RgbColor* palette;
+    const void* table;
+    const uint16_t* candidates;
+    LabSpace* labs;             // Reduced mode only, palette in Lab for the candidate check
+    double buildMs;
+    int mapped;
+};
+
+typedef struct {
+    size_t palette;
+    size_t table;
+    size_t candidates;
+    size_t total;
+} PaletteCacheLayout;
+
+static PaletteCacheLayout MakeLayout(size_t paletteCount, size_t entryBytes, PaletteCacheMode mode, size_t candidateCount)
+{
+    PaletteCacheLayout layout;
+    const size_t entries = (mode == PCACHE_REDUCED) ? PCACHE_CELL_ENTRIES : PCACHE_FULL_ENTRIES;
+
+    layout.palette = sizeof(PaletteCacheFile);
+    layout.table = (layout.palette + paletteCount * sizeof(RgbColor) + 7) & ~(size_t)7;
+    layout.candidates = layout.table + entries * entryBytes;
+    layout.total = layout.candidates + candidateCount * sizeof(uint16_t);
+    return layout;
+}
+
+static inline LabSpace CacheLab(RgbColor rgb, const double* linear)
+{
+    return XyzToLab_White(RgbToXyz_Core(rgb, linear), WP_D65_FULL);
+}
+
+// Points the cache at the sections of its block and builds the Lab copy reduced lookups need.
+static int AttachSections(PaletteCache* cache)
+{
+    const PaletteCacheFile* head = (const PaletteCacheFile*)cache->data;
+    const PaletteCacheLayout layout = MakeLayout(head->paletteCount, head->entryBytes, (PaletteCacheMode)head->mode, (size_t)head->candidateCount);
+
+    cache->head = head;
+    cache->palette = (const RgbColor*)(cache->data + layout.palette);
+    cache->table = cache->data + layout.table;
+    cache->candidates = (const uint16_t*)(cache->data + layout.candidates);
+    cache->labs = NULL;
+
+    if (head->mode == PCACHE_REDUCED)
+    {
+        cache->labs = (LabSpace*)malloc(head->paletteCount * sizeof(LabSpace));
+        if (cache->labs == NULL)
+            return 0;
+
+        const double* linear = SrgbLinearTable();
+        for (uint32_t i = 0; i < head->paletteCount; i++)
+            cache->labs[i] = CacheLab(cache->palette[i], linear);
+    }
+    return 1;
+}
+
+static void InitHeader(PaletteCacheFile* head, size_t count, DeltaEType type, PaletteCacheMode mode,
+    size_t entryBytes, size_t mixedCells, size_t candidateCount, size_t totalBytes)
+{
+    memset(head, 0, sizeof(*head));
+    memcpy(head->magic, PCACHE_MAGIC, 4);
+    head->version = PCACHE_VERSION;
+    head->mode = (uint32_t)mode;
+    head->type = (uint32_t)type;
+    head->paletteCount = (uint32_t)count;
+    head->entryBytes = (uint32_t)entryBytes;
+    head->mixedCells = mixedCells;
+    head->candidateCount = candidateCount;
+    head->totalBytes = totalBytes;
+}
+
+static unsigned char* BuildFull(const PaletteIndex* index, const RgbColor* palette, size_t count, DeltaEType type, size_t* bytes)
+{
+    const size_t entryBytes = (count <= 256) ? 1 : 2;
+    const PaletteCacheLayout layout = MakeLayout(count, entryBytes, PCACHE_FULL, 0);
+
+    unsigned char* block = (unsigned char*)malloc(layout.total);
+    if (block == NULL)
+        return NULL;
+
+    InitHeader((PaletteCacheFile*)block, count, type, PCACHE_FULL, entryBytes, 0, 0, layout.total);
+    memcpy(block + layout.palette, palette, count * sizeof(RgbColor));
+
+    unsigned char* table8 = block + layout.table;
+    uint16_t* table16 = (uint16_t*)(block + layout.table);
+    const double* linear = SrgbLinearTable();
+    size_t seed = 0;
+
+    // Blue innermost, so each search is seeded with the match of a color one step away.
+    for (uint32_t key = 0; key < PCACHE_FULL_ENTRIES; key++)
+    {
+        const RgbColor rgb = { 255, (unsigned char)(key >> 16), (unsigned char)(key >> 8), (unsigned char)key };
+        seed = PaletteIndexNearestSeeded(index, CacheLab(rgb, linear), type, seed, NULL);
+
+        if (entryBytes == 1)
+            table8[key] = (unsigned char)seed;
+        else
+            table16[key] = (uint16_t)seed;
+    }
+
+    *bytes = layout.total;
+    return block;
+}
+
+// Fills the 2^18 cells, growing the candidate list as needed.  Returns 0 when out of memory.
+static int FillCells(const PaletteIndex* index, DeltaEType type, uint32_t* cells, uint16_t** cands, size_t* candCap, size_t* candCount, size_t* mixed)
+{
+    const double* linear = SrgbLinearTable();
+    size_t seed = 0;
+
+    for (uint32_t cell = 0; cell < PCACHE_CELL_ENTRIES; cell++)
+    {
+        const unsigned r0 = (cell >> 12) << 2, g0 = ((cell >> 6) & 63) << 2, b0 = (cell & 63) << 2;
+
+        // Distinct matches of the 64 colors in the cell, kept sorted by palette index.
+        uint16_t found[64];
+        size_t n = 0;
+        for (unsigned i = 0; i < 64; i++)
+        {
+            const RgbColor rgb = { 255, (unsigned char)(r0 + (i >> 4)), (unsigned char)(g0 + ((i >> 2) & 3)), (unsigned char)(b0 + (i & 3)) };
+            seed = PaletteIndexNearestSeeded(index, CacheLab(rgb, linear), type, seed, NULL);
+
+            size_t at = 0;
+            while (at < n && found[at] < seed)
+                at++;
+            if (at < n && found[at] == seed)
+                continue;
+            memmove(&found[at + 1], &found[at], (n - at) * sizeof(uint16_t));
+            found[at] = (uint16_t)seed;
+            n++;
+        }
+
+        if (n == 1)
+        {
+            cells[cell] = found[0];
+            continue;
+        }
+
+        if (*candCount + n > *candCap)
+        {
+            uint16_t* grown = (uint16_t*)realloc(*cands, *candCap * 2 * sizeof(uint16_t));
+            if (grown == NULL)
+                return 0;
+            *cands = grown;
+            *candCap *= 2;
+        }
+
+        // Offset in bits 0-23, count - 1 in bits 24-29.  At most 2^18 * 64 = 2^24 candidates, so the
+        // offset of a list always fits.
+        cells[cell] = PCACHE_CELL_MIXED | ((uint32_t)(n - 1) << 24) | (uint32_t)*candCount;
+        memcpy(*cands + *candCount, found, n * sizeof(uint16_t));
+        *candCount += n;
+        (*mixed)++;
+    }
+    return 1;
+}
+
+static unsigned char* BuildReduced(const PaletteIndex* index, const RgbColor* palette, size_t count, DeltaEType type, size_t* bytes)
+{
+    uint32_t* cells = (uint32_t*)malloc(PCACHE_CELL_ENTRIES * sizeof(uint32_t));
+    size_t candCap = 1 << 16, candCount = 0, mixed = 0;
+    uint16_t* cands = (uint16_t*)malloc(candCap * sizeof(uint16_t));
+    unsigned char* block = NULL;
+
+    if (cells != NULL && cands != NULL && FillCells(index, type, cells, &cands, &candCap, &candCount, &mixed))
+    {
+        const PaletteCacheLayout layout = MakeLayout(count, sizeof(uint32_t), PCACHE_REDUCED, candCount);
+        block = (unsigned char*)malloc(layout.total);
+        if (block != NULL)
+        {
+            InitHeader((PaletteCacheFile*)block, count, type, PCACHE_REDUCED, sizeof(uint32_t), mixed, candCount, layout.total);
+            memcpy(block + layout.palette, palette, count * sizeof(RgbColor));
+            memcpy(block + layout.table, cells, PCACHE_CELL_ENTRIES * sizeof(uint32_t));
+            memcpy(block + layout.candidates, cands, candCount * sizeof(uint16_t));
+            *bytes = layout.total;
+        }
+    }
+
+    free(cells);
+    free(cands);
+    return block;
+}
+
+// Closest of a reduced cell's candidates, same ranking and tie break (lowest index) as the PaletteIndex search.
+static size_t PickCandidate(const PaletteCache* cache, uint32_t cell, RgbColor rgb, const double* linear)
+{
+    const uint16_t* list = cache->candidates + (cell & 0x00FFFFFFu);
+    const size_t n = ((cell >> 24) & 63) + 1;
+    const DeltaEType type = (DeltaEType)cache->head->type;
+    const LabSpace lab = CacheLab(rgb, linear);
+
+    size_t best = list[0];
+    double bestD = HUGE_VAL;
+    for (size_t i = 0; i < n; i++)
+    {
+        const LabSpace c = cache->labs[list[i]];
+        double d;
+        if (type == DELTAE_CIE94 || type == DELTAE_CIEDE2000)
+            d = DeltaE(lab, c, type);
+        else
+        {
+            const double dl = c.l - lab.l, da = c.a - lab.a, db = c.b - lab.b;
+            d = dl * dl + da * da + db * db;
+        }
+
+        if (d < bestD)
+        {
+            bestD = d;
+            best = list[i];
+        }
+    }
+    return best;
+}
+
+static inline size_t Lookup_Core(const PaletteCache* cache, RgbColor rgb, const double* linear)
+{
+    if (cache->head->mode == PCACHE_FULL)
+    {
+        const uint32_t key = ((uint32_t)rgb.red << 16) | ((uint32_t)rgb.green << 8) | rgb.blue;
+        if (cache->head->entryBytes == 1)
+            return ((const unsigned char*)cache->table)[key];
+        return ((const uint16_t*)cache->table)[key];
+    }
+
+    const uint32_t cell = ((const uint32_t*)cache->table)[((uint32_t)(rgb.red >> 2) << 12) | ((uint32_t)(rgb.green >> 2) << 6) | (rgb.blue >> 2)];
+    if ((cell & PCACHE_CELL_MIXED) == 0)
+        return cell;
+    return PickCandidate(cache, cell, rgb, linear);
+}
+
+CHIZL_COLORS_API PaletteCache* PaletteCacheCreate(const RgbColor* palette, size_t count, DeltaEType type, PaletteCacheMode mode)
+{
+    if (palette == NULL || count == 0 || count > PCACHE_MAX_COLORS)
+        return NULL;
+    if (mode != PCACHE_FULL && mode != PCACHE_REDUCED)
+        return NULL;
+
+    const double start = ChizlNowMs();
+
+    PaletteCache* cache = (PaletteCache*)calloc(1, sizeof(PaletteCache));
+    PaletteIndex* index = PaletteIndexCreate(palette, count);
+    if (cache == NULL || index == NULL)
+    {
+        free(cache);
+        PaletteIndexFree(index);
+        return NULL;
+    }
+
+    size_t bytes = 0;
+    unsigned char* block = (mode == PCACHE_REDUCED)
+        ? BuildReduced(index, palette, count, type, &bytes)
+        : BuildFull(index, palette, count, type, &bytes);
+    PaletteIndexFree(index);
+
+    if (block == NULL)
+    {
+        free(cache);
+        return NULL;
+    }
+
+    cache->data = block;
+    cache->bytes = bytes;
+    cache->mapped = 0;
+    if (!AttachSections(cache))
+    {
+        PaletteCacheFree(cache);
+        return NULL;
+    }
+
+    cache->buildMs = ChizlNowMs() - start;
+    return cache;
+}
+
+CHIZL_COLORS_API void PaletteCacheFree(PaletteCache* cache)
+{
+    if (cache == NULL)
+        return;
+
+    if (cache->mapped)
+    {
+#if defined(_WIN32) || defined(_WIN64)
+        UnmapViewOfFile(cache->data);
+#else
+        munmap((void*)cache->data, cache->bytes);
+#endif
+    }
+    else
+        free((void*)cache->data);
+
+    free(cache->labs);
+    free(cache);
+}
+
+CHIZL_COLORS_API int PaletteCacheSave(const PaletteCache* cache, const char* path)
+{
+    if (cache == NULL || path == NULL)
+        return 0;
+
+    FILE* f = NULL;
+#if defined(_MSC_VER)
+    if (fopen_s(&f, path, "wb") != 0)
+        f = NULL;
+#else
+    f = fopen(path, "wb");
+#endif
+    if (f == NULL)
+        return 0;
+
+    const int ok = fwrite(cache->data, 1, cache->bytes, f) == cache->bytes;
+    return (fclose(f) == 0) && ok;
+}
+
+// Checks a mapped file describes a complete cache before anything indexes into it.
+static int ValidFile(const unsigned char* data, size_t bytes)
+{
+    if (bytes < sizeof(PaletteCacheFile))
+        return 0;
+
+    const PaletteCacheFile* head = (const PaletteCacheFile*)data;
+    if (memcmp(head->magic, PCACHE_MAGIC, 4) != 0 || head->version != PCACHE_VERSION)
+        return 0;
+    if (head->paletteCount == 0 || head->paletteCount > PCACHE_MAX_COLORS || head->type > DELTAE_CIEDE2000)
+        return 0;
+    if (head->mode == PCACHE_FULL)
+    {
+        if (head->entryBytes != ((head->paletteCount <= 256) ? 1u : 2u) || head->candidateCount != 0)
+            return 0;
+    }
+    else if (head->mode != PCACHE_REDUCED || head->entryBytes != 4 || head->candidateCount > ((uint64_t)1 << 24))
+        return 0;
+
+    const PaletteCacheLayout layout = MakeLayout(head->paletteCount, head->entryBytes, (PaletteCacheMode)head->mode, (size_t)head->candidateCount);
+    if (head->totalBytes != bytes || layout.total != bytes)
+        return 0;
+
+    // Lookups trust every table entry, so a damaged or hostile file has to be caught here: each entry
+    // must name a palette color and each mixed cell must stay inside the candidate list.
+    const uint32_t count = head->paletteCount;
+    if (head->mode == PCACHE_FULL)
+    {
+        const unsigned char* table8 = data + layout.table;
+        const uint16_t* table16 = (const uint16_t*)(data + layout.table);
+        for (uint32_t key = 0; key < PCACHE_FULL_ENTRIES; key++)
+        {
+            const uint32_t entry = (head->entryBytes == 1) ? table8[key] : table16[key];
+            if (entry >= count)
+                return 0;
+        }
+        return 1;
+    }
+
+    const uint32_t* cells = (const uint32_t*)(data + layout.table);
+    const uint16_t* candidates = (const uint16_t*)(data + layout.candidates);
+    uint64_t mixed = 0;
+
+    for (uint32_t cell = 0; cell < PCACHE_CELL_ENTRIES; cell++)
+    {
+        const uint32_t value = cells[cell];
+        if ((value & PCACHE_CELL_MIXED) == 0)
+        {
+            if (value >= count)
+                return 0;
+            continue;
+        }
+
+        const uint64_t offset = value & 0xFFFFFFu;
+        const uint64_t n = ((value >> 24) & 63u) + 1;
+        if (offset + n > head->candidateCount)
+            return 0;
+        mixed++;
+    }
+    if (mixed != head->mixedCells)
+        return 0;
+
+    for (uint64_t i = 0; i < head->candidateCount; i++)
+    {
+        if (candidates[i] >= count)
+            return 0;
+    }
+    return 1;
+}
+
+CHIZL_COLORS_API PaletteCache* PaletteCacheLoad(const char* path)
+{
+    if (path == NULL)
+        return NULL;
+
+    PaletteCache* cache = (PaletteCache*)calloc(1, sizeof(PaletteCache));
+    if (cache == NULL)
+        return NULL;
+
+    const unsigned char* view = NULL;
+    size_t bytes = 0;
+
+#if defined(_WIN32) || defined(_WIN64)
+    HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (file != INVALID_HANDLE_VALUE)
+    {
+        LARGE_INTEGER size;
+        if (GetFileSizeEx(file, &size) && size.QuadPart > 0 && (unsigned long long)size.QuadPart <= (size_t)-1)
+        {
+            HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+            if (mapping != NULL)
+            {
+                // The view keeps the mapping alive, both handles can go.
+                view = (const unsigned char*)MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+                bytes = (size_t)size.QuadPart;
+                CloseHandle(mapping);
+            }
+        }
+        CloseHandle(file);
+    }
+#else
+    const int fd = open(path, O_RDONLY);
+    if (fd >= 0)
+    {
+        struct stat st;
+        if (fstat(fd, &st) == 0 && st.st_size > 0)
+        {
+            void* p = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (p != MAP_FAILED)
+            {
+                view = (const unsigned char*)p;
+                bytes = (size_t)st.st_size;
+            }
+        }
+        close(fd);
+    }
+#endif
+
+    if (view == NULL)
+    {
+        free(cache);
+        return NULL;
+    }
+
+    cache->data = view;
+    cache->bytes = bytes;
+    cache->mapped = 1;
+    cache->buildMs = 0.0;
+
+    if (!ValidFile(view, bytes) || !AttachSections(cache))
+    {
+        PaletteCacheFree(cache);
+        return NULL;
+    }
+    return cache;
+}
+
+CHIZL_COLORS_API int PaletteCacheGetInfo(const PaletteCache* cache, PaletteCacheInfo* info)
+{
+    if (cache == NULL || info == NULL)
+        return 0;
+
+    info->mode = (PaletteCacheMode)cache->head->mode;
+    info->type = (DeltaEType)cache->head->type;
+    info->paletteCount = cache->head->paletteCount;
+    info->bytes = cache->bytes;
+    info->mixedCells = (size_t)cache->head->mixedCells;
+    info->buildMs = cache->buildMs;
+    info->mapped = cache->mapped;
+    return 1;
+}
+
+CHIZL_COLORS_API RgbColor PaletteCacheColor(const PaletteCache* cache, size_t entry)
+{
+    RgbColor black = { 255, 0, 0, 0 };
+    if (cache == NULL || entry >= cache->head->paletteCount)
+        return black;
+
+    return cache->palette[entry];
+}
+
+CHIZL_COLORS_API size_t PaletteCacheLookup(const PaletteCache* cache, RgbColor rgb)
+{
+    if (cache == NULL)
+        return 0;
+
+    return Lookup_Core(cache, rgb, SrgbLinearTable());
+}
+
+CHIZL_COLORS_API size_t PaletteCacheLookupBatch(const PaletteCache* cache, const RgbColor* rgb, size_t* out, size_t count)
+{
+    if (cache == NULL || rgb == NULL || out == NULL)
+        return 0;
+
+    const double* linear = SrgbLinearTable();
+    for (size_t i = 0; i < count; i++)
+        out[i] = Lookup_Core(cache, rgb[i], linear);
+
+    return count;
+}
@@ -0,0 +1,144 @@
+// palette_cache.h
+
+#pragma once
+
+#ifndef PALETTE_CACHE_H
+#define PALETTE_CACHE_H
+
+// --- Start of "extern C" block ---
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "import_exports.h"
+#include "chizl_colors_types.h"
+#include "delta_e.h"            // For DeltaEType
+#include <stddef.h>             // For size_t
+
+/// <summary>
+/// Opaque precomputed RGB -> palette index table.  Built once from the PaletteIndex search, after
+/// that mapping a pixel is a table load instead of RgbToLab plus a nearest color search.<br/>
+/// Read only after creation, one cache can be queried from any number of threads.
+/// </summary>
+typedef struct PaletteCache PaletteCache;
+
+/// <summary>
+/// Table layouts for PaletteCacheCreate.
+/// </summary>
+typedef enum {
+    /// <summary>
+    /// One entry per 24-bit color (16,777,216).  16 MB for palettes of up to 256 colors, 32 MB above that.
+    /// Every lookup is a single load.
+    /// </summary>
+    PCACHE_FULL = 0,
+    /// <summary>
+    /// 6-6-6 bit cube (262,144 cells of 4x4x4 colors), about 1 MB plus candidate lists.  Cells where every
+    /// color maps to the same entry are a single load, the rest pick between that cell's few candidates.
+    /// Same results as PCACHE_FULL.
+    /// </summary>
+    PCACHE_REDUCED = 1
+} PaletteCacheMode;
+
+/// <summary>
+/// Size and cost of a PaletteCache, from PaletteCacheGetInfo.
+/// </summary>
+typedef struct {
+    PaletteCacheMode mode;
+    DeltaEType type;
+    /// <summary>
+    /// Number of palette colors.
+    /// </summary>
+    size_t paletteCount;
+    /// <summary>
+    /// Bytes used by the table, candidate lists and palette (also the PaletteCacheSave file size).
+    /// </summary>
+    size_t bytes;
+    /// <summary>
+    /// Reduced mode only: cells that need a candidate check, 0 for PCACHE_FULL.
+    /// </summary>
+    size_t mixedCells;
+    /// <summary>
+    /// Milliseconds PaletteCacheCreate took, 0.0 for a cache from PaletteCacheLoad.
+    /// </summary>
+    double buildMs;
+    /// <summary>
+    /// 1 when the table is a read only memory mapped file (PaletteCacheLoad), 0 when built in memory.
+    /// </summary>
+    int mapped;
+} PaletteCacheInfo;
+
+/// <summary>
+/// Builds the lookup table for a palette.  Every 24-bit color is matched once with the PaletteIndex
+/// search, so results are the same as PaletteIndexNearest.  This takes seconds, build once and
+/// PaletteCacheSave / PaletteCacheLoad the result.
+/// </summary>
+/// <param name="palette">Pointer to the palette colors, the cache keeps its own copy.</param>
+/// <param name="count">Number of palette colors, 1 to 65536.</param>
+/// <param name="type">Delta-E formula used to pick the nearest entry.</param>
+/// <param name="mode">Table layout.</param>
+/// <returns>The new cache, or NULL on bad arguments or out of memory.  Release with PaletteCacheFree.</returns>
+CHIZL_COLORS_API PaletteCache* PaletteCacheCreate(const RgbColor* palette, size_t count, DeltaEType type, PaletteCacheMode mode);
+
+/// <summary>
+/// Releases a cache from PaletteCacheCreate or PaletteCacheLoad (unmapping the file).  NULL is ignored.
+/// </summary>
+/// <param name="cache">Cache to free.</param>
+/// <returns>This function does not return a value.</returns>
+CHIZL_COLORS_API void PaletteCacheFree(PaletteCache* cache);
+
+/// <summary>
+/// Writes the cache to a file for PaletteCacheLoad.  The file is the in memory layout, so it is only
+/// valid on machines with the same byte order and pointer size.
+/// </summary>
+/// <param name="cache">Cache to save.</param>
+/// <param name="path">File to create or overwrite.</param>
+/// <returns>1 on success, 0 on failure.</returns>
+CHIZL_COLORS_API int PaletteCacheSave(const PaletteCache* cache, const char* path);
+
+/// <summary>
+/// Memory maps a file written by PaletteCacheSave.  Nothing is rebuilt, but every table entry is checked
+/// once against the palette size, so a damaged file is rejected instead of read out of bounds later.
+/// </summary>
+/// <param name="path">File to map.</param>
+/// <returns>The cache, or NULL if the file is missing, truncated, not a cache file or has out of range entries.  Release with PaletteCacheFree.</returns>
+CHIZL_COLORS_API PaletteCache* PaletteCacheLoad(const char* path);
+
+/// <summary>
+/// Reports the layout, size and build time of a cache.
+/// </summary>
+/// <param name="cache">Cache to describe.</param>
+/// <param name="info">Receives the details.</param>
+/// <returns>1 on success, 0 if either pointer is NULL.</returns>
+CHIZL_COLORS_API int PaletteCacheGetInfo(const PaletteCache* cache, PaletteCacheInfo* info);
+
+/// <summary>
+/// Returns the color of a palette entry.
+/// </summary>
+/// <param name="cache">Palette cache.</param>
+/// <param name="entry">Palette index, 0 to paletteCount - 1.</param>
+/// <returns>The palette color, black if cache is NULL or entry is out of range.</returns>
+CHIZL_COLORS_API RgbColor PaletteCacheColor(const PaletteCache* cache, size_t entry);
+
+/// <summary>
+/// Palette index closest to an RGB color.  Alpha is ignored.
+/// </summary>
+/// <param name="cache">Palette cache.</param>
+/// <param name="rgb">Color to match.</param>
+/// <returns>Palette index of the closest entry, 0 if cache is NULL.</returns>
+CHIZL_COLORS_API size_t PaletteCacheLookup(const PaletteCache* cache, RgbColor rgb);
+
+/// <summary>
+/// PaletteCacheLookup for an array of colors.
+/// </summary>
+/// <param name="cache">Palette cache.</param>
+/// <param name="rgb">Pointer to the colors to match.</param>
+/// <param name="out">Pointer to 'count' size_t values to receive the palette indexes.</param>
+/// <param name="count">Number of colors.</param>
+/// <returns>The number of colors matched, 0 if any pointer is NULL.</returns>
+CHIZL_COLORS_API size_t PaletteCacheLookupBatch(const PaletteCache* cache, const RgbColor* rgb, size_t* out, size_t count);
+
+// --- End of "extern C" block ---
+#ifdef __cplusplus
+}
+#endif
+#endif
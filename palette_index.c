@@ -0,0 +1,348 @@
+// palette_index.c
+#include "palette_index.h"
+#include "palette_index_core.h"
+#include "cie_common.h"         // For RgbToXyz_Core, XyzToLab_White
+#include "srgb_linear.h"        // For SrgbLinearTable
+#include <stdlib.h>             // For malloc, free
+
+// Nearest palette color through a k-d tree in Lab.
+//
+// The tree is implicit: nodes are stored in one array, each subtree [lo, hi) has its split node
+// at the middle, left half below it, right half above it.  No child pointers, no per node allocation.
+// Each split uses the axis with the widest spread in that subtree, which keeps the cells close to
+// cubes for palettes that are mostly a thin slice of Lab (e.g. all grays or all one hue).
+
+typedef struct {
+    double p[3];            // L*, a*, b*
+    size_t id;              // Position in the caller's palette
+    int axis;               // Split axis of the subtree this node is the middle of
+} KdNode;
+
+struct PaletteIndex {
+    size_t count;
+    KdNode* nodes;          // Tree order
+    LabSpace* labs;         // Palette order, for the re-rank step
+};
+
+typedef struct {
+    double d2;              // Squared CIE76, or the Delta-E itself for the weighted searches
+    size_t id;
+} KdHit;
+
+static inline double KdDist2(const double* a, const double* b)
+{
+    const double d0 = a[0] - b[0];
+    const double d1 = a[1] - b[1];
+    const double d2 = a[2] - b[2];
+    return d0 * d0 + d1 * d1 + d2 * d2;
+}
+
+// Lower distance wins, equal distances go to the lower palette index so results match a linear scan.
+static inline int KdBetter(double d2, size_t id, double bestD2, size_t bestId)
+{
+    return d2 < bestD2 || (d2 == bestD2 && id < bestId);
+}
+
+static inline void KdSwap(KdNode* a, KdNode* b)
+{
+    KdNode t = *a;
+    *a = *b;
+    *b = t;
+}
+
+// Quickselect: puts the node that belongs at 'k' there, smaller on the left, larger on the right.
+static void KdSelect(KdNode* nodes, size_t lo, size_t hi, size_t k, int axis)
+{
+    while (hi - lo > 1)
+    {
+        // Median of three pivot, moved to hi - 1.
+        const size_t mid = lo + (hi - lo) / 2;
+        if (nodes[mid].p[axis] < nodes[lo].p[axis]) KdSwap(&nodes[mid], &nodes[lo]);
+        if (nodes[hi - 1].p[axis] < nodes[lo].p[axis]) KdSwap(&nodes[hi - 1], &nodes[lo]);
+        if (nodes[mid].p[axis] < nodes[hi - 1].p[axis]) KdSwap(&nodes[mid], &nodes[hi - 1]);
+        const double pivot = nodes[hi - 1].p[axis];
+
+        size_t store = lo;
+        for (size_t i = lo; i < hi - 1; i++)
+        {
+            if (nodes[i].p[axis] < pivot)
+                KdSwap(&nodes[i], &nodes[store++]);
+        }
+        KdSwap(&nodes[store], &nodes[hi - 1]);
+
+        if (k == store)
+            return;
+        if (k < store)
+            hi = store;
+        else
+            lo = store + 1;
+    }
+}
+
+static void KdBuild(KdNode* nodes, size_t lo, size_t hi)
+{
+    while (hi - lo > 1)
+    {
+        double mn[3] = { nodes[lo].p[0], nodes[lo].p[1], nodes[lo].p[2] };
+        double mx[3] = { mn[0], mn[1], mn[2] };
+        for (size_t i = lo + 1; i < hi; i++)
+        {
+            for (int a = 0; a < 3; a++)
+            {
+                if (nodes[i].p[a] < mn[a]) mn[a] = nodes[i].p[a];
+                if (nodes[i].p[a] > mx[a]) mx[a] = nodes[i].p[a];
+            }
+        }
+
+        int axis = 0;
+        for (int a = 1; a < 3; a++)
+        {
+            if (mx[a] - mn[a] > mx[axis] - mn[axis])
+                axis = a;
+        }
+
+        const size_t mid = lo + (hi - lo) / 2;
+        KdSelect(nodes, lo, hi, mid, axis);
+        nodes[mid].axis = axis;
+
+        // Recurse into the smaller half, loop on the larger one.
+        if (mid - lo < hi - (mid + 1))
+        {
+            KdBuild(nodes, lo, mid);
+            lo = mid + 1;
+        }
+        else
+        {
+            KdBuild(nodes, mid + 1, hi);
+            hi = mid;
+        }
+    }
+    if (hi - lo == 1)
+        nodes[lo].axis = 0;
+}
+
+static void KdNearest(const KdNode* nodes, size_t lo, size_t hi, const double* q, KdHit* best)
+{
+    while (lo < hi)
+    {
+        const size_t mid = lo + (hi - lo) / 2;
+        const KdNode* n = &nodes[mid];
+
+        const double d2 = KdDist2(n->p, q);
+        if (KdBetter(d2, n->id, best->d2, best->id))
+        {
+            best->d2 = d2;
+            best->id = n->id;
+        }
+
+        const double diff = q[n->axis] - n->p[n->axis];
+        if (diff < 0.0)
+        {
+            KdNearest(nodes, lo, mid, q, best);
+            lo = mid + 1;
+        }
+        else
+        {
+            KdNearest(nodes, mid + 1, hi, q, best);
+            hi = mid;
+        }
+
+        // Only skip the far side when it is strictly farther, an equally distant entry there may have a lower palette index.
+        if (diff * diff > best->d2)
+            return;
+    }
+}
+
+// CIE76 radius that can still hold an entry closer than 'de' by CIE94 / CIEDE2000.  Both are proven
+// bounds, the searches return exactly what a linear scan returns.
+//  CIE94:     dE76 <= SC * dE94, SC = 1 + 0.045 * C of the reference.
+//  CIEDE2000: dE00^2 = tl^2 + tc^2 + th^2 + RT * tc * th with |RT| <= 2 * sin(60) (dTheta <= 30 degrees,
+//             RC < 2), so dE00^2 >= (1 - sin(60)) * (tl^2 + tc^2 + th^2).  The a' scale (1 + G) is the
+//             same for both colors and >= 1, so dL'^2 + dC'^2 + dH'^2 >= dE76^2, and each t is its delta
+//             over an S of at most Smax = max(SL, SC) (SH <= SC since T <= 1.93).  That gives
+//             dE76 <= k * dE00 * Smax, k = 1 / sqrt(1 - sin(60)) = 1 + sqrt(3).
+//             An entry at CIE76 distance R has C <= Cref + R and |Lmean - 50| <= |Lref - 50| + R / 2, with
+//             C' <= 1.5 * C:  SC <= 1 + 0.0675 * Cref + 0.03375 * R,  SL <= 1 + 0.015 * |Lref - 50| + 0.0075 * R.
+//             Solving R <= k * de * S(R) for each gives the radius below.  Past dE00 ~10.8 there is no
+//             bound and the whole tree is visited (only sparse palettes get there).
+#define KD_DE2000_K 2.7320508075688772
+
+static inline double KdReach2000(double de, double a, double b)
+{
+    const double den = 1.0 - KD_DE2000_K * de * b;
+    return (den <= 0.0) ? HUGE_VAL : KD_DE2000_K * de * (1.0 + a) / den;
+}
+
+static inline double KdReach(DeltaEType type, double de, double chroma, double lightness)
+{
+    if (type == DELTAE_CIE94)
+        return de * (1.0 + 0.045 * chroma);
+
+    const double byChroma = KdReach2000(de, 0.0675 * chroma, 0.03375);
+    const double byLightness = KdReach2000(de, 0.015 * fabs(lightness - 50.0), 0.0075);
+    return (byChroma > byLightness) ? byChroma : byLightness;
+}
+
+// Nearest by CIE94 / CIEDE2000, best->d2 holds the best Delta-E.  A subtree is skipped once its
+// split plane is outside the KdReach radius of the best match so far.
+static void KdNearestDeltaE(const PaletteIndex* index, size_t lo, size_t hi, const double* q, LabSpace lab,
+    DeltaEType type, double chroma, KdHit* best)
+{
+    while (lo < hi)
+    {
+        const size_t mid = lo + (hi - lo) / 2;
+        const KdNode* n = &index->nodes[mid];
+
+        // Cheap CIE76 reject first, the weighted formula only runs for entries inside the radius.
+        double reach = KdReach(type, best->d2, chroma, q[0]);
+        if (KdDist2(n->p, q) <= reach * reach)
+        {
+            const double de = DeltaE(lab, index->labs[n->id], type);
+            if (KdBetter(de, n->id, best->d2, best->id))
+            {
+                best->d2 = de;
+                best->id = n->id;
+            }
+        }
+
+        const double diff = q[n->axis] - n->p[n->axis];
+        if (diff < 0.0)
+        {
+            KdNearestDeltaE(index, lo, mid, q, lab, type, chroma, best);
+            lo = mid + 1;
+        }
+        else
+        {
+            KdNearestDeltaE(index, mid + 1, hi, q, lab, type, chroma, best);
+            hi = mid;
+        }
+
+        reach = KdReach(type, best->d2, chroma, q[0]);
+        if (fabs(diff) > reach)
+            return;
+    }
+}
+
+static size_t NearestLab_Core(const PaletteIndex* index, LabSpace lab, DeltaEType type, size_t seed, double* distance)
+{
+    const double q[3] = { lab.l, lab.a, lab.b };
+
+    // A seed entry starts the search with its distance as the radius instead of infinity.  The result
+    // is the same, close seeds (the previous color of a scan) just prune most of the tree up front.
+    KdHit best = { HUGE_VAL, index->count };
+    if (seed < index->count)
+    {
+        const double p[3] = { index->labs[seed].l, index->labs[seed].a, index->labs[seed].b };
+        best.d2 = KdDist2(p, q);
+        best.id = seed;
+    }
+    KdNearest(index->nodes, 0, index->count, q, &best);
+
+    if (type != DELTAE_CIE94 && type != DELTAE_CIEDE2000)
+    {
+        if (distance != NULL)
+            *distance = sqrt(best.d2);
+        return best.id;
+    }
+
+    // The CIE76 match seeds the radius, usually it is the answer or close to it.
+    best.d2 = DeltaE(lab, index->labs[best.id], type);
+    KdNearestDeltaE(index, 0, index->count, q, lab, type, sqrt(lab.a * lab.a + lab.b * lab.b), &best);
+
+    if (distance != NULL)
+        *distance = best.d2;
+    return best.id;
+}
+
+size_t PaletteIndexNearestSeeded(const PaletteIndex* index, LabSpace lab, DeltaEType type, size_t seed, double* distance)
+{
+    return NearestLab_Core(index, lab, type, seed, distance);
+}
+
+CHIZL_COLORS_API PaletteIndex* PaletteIndexCreate(const RgbColor* palette, size_t count)
+{
+    if (palette == NULL || count == 0)
+        return NULL;
+
+    // One block: header, tree, Lab copy.  All three are multiples of 8 bytes so the arrays stay aligned.
+    const size_t headSize = (sizeof(PaletteIndex) + 7) & ~(size_t)7;
+    if (count > ((size_t)-1 - headSize) / (sizeof(KdNode) + sizeof(LabSpace)))
+        return NULL;
+
+    unsigned char* block = (unsigned char*)malloc(headSize + count * (sizeof(KdNode) + sizeof(LabSpace)));
+    if (block == NULL)
+        return NULL;
+
+    PaletteIndex* index = (PaletteIndex*)block;
+    index->count = count;
+    index->nodes = (KdNode*)(block + headSize);
+    index->labs = (LabSpace*)(block + headSize + count * sizeof(KdNode));
+
+    const double* linear = SrgbLinearTable();
+    for (size_t i = 0; i < count; i++)
+    {
+        const LabSpace lab = XyzToLab_White(RgbToXyz_Core(palette[i], linear), WP_D65_FULL);
+        index->labs[i] = lab;
+        index->nodes[i].p[0] = lab.l;
+        index->nodes[i].p[1] = lab.a;
+        index->nodes[i].p[2] = lab.b;
+        index->nodes[i].id = i;
+        index->nodes[i].axis = 0;
+    }
+
+    KdBuild(index->nodes, 0, count);
+    return index;
+}
+
+CHIZL_COLORS_API void PaletteIndexFree(PaletteIndex* index)
+{
+    free(index);
+}
+
+CHIZL_COLORS_API size_t PaletteIndexCount(const PaletteIndex* index)
+{
+    return (index == NULL) ? 0 : index->count;
+}
+
+CHIZL_COLORS_API size_t PaletteIndexNearestLab(const PaletteIndex* index, LabSpace lab, DeltaEType type, double* distance)
+{
+    if (index == NULL)
+        return 0;
+
+    return NearestLab_Core(index, lab, type, index->count, distance);
+}
+
+CHIZL_COLORS_API size_t PaletteIndexNearest(const PaletteIndex* index, RgbColor rgb, DeltaEType type, double* distance)
+{
+    if (index == NULL)
+        return 0;
+
+    const LabSpace lab = XyzToLab_White(RgbToXyz_Core(rgb, SrgbLinearTable()), WP_D65_FULL);
+    return NearestLab_Core(index, lab, type, index->count, distance);
+}
+
+CHIZL_COLORS_API size_t PaletteIndexNearestBatch(const PaletteIndex* index, const RgbColor* rgb, size_t* out, double* distances, size_t count, DeltaEType type)
+{
+    if (index == NULL || rgb == NULL || out == NULL)
+        return 0;
+
+    const double* linear = SrgbLinearTable();
+    size_t lastId = 0;
+    double lastDe = 0.0;
+
+    for (size_t i = 0; i < count; i++)
+    {
+        // Same color as the previous pixel, reuse its match.  Alpha is ignored, like RgbToLab.
+        if (i == 0 || rgb[i].red != rgb[i - 1].red || rgb[i].green != rgb[i - 1].green || rgb[i].blue != rgb[i - 1].blue)
+        {
+            const LabSpace lab = XyzToLab_White(RgbToXyz_Core(rgb[i], linear), WP_D65_FULL);
+            lastId = NearestLab_Core(index, lab, type, lastId, &lastDe);
+        }
+
+        out[i] = lastId;
+        if (distances != NULL)
+            distances[i] = lastDe;
+    }
+
+    return count;
+}
@@ -0,0 +1,86 @@
+// palette_index.h
+
+#pragma once
+
+#ifndef PALETTE_INDEX_H
+#define PALETTE_INDEX_H
+
+// --- Start of "extern C" block ---
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "import_exports.h"
+#include "chizl_colors_types.h"
+#include "delta_e.h"            // For DeltaEType
+#include <stddef.h>             // For size_t
+
+/// <summary>
+/// Opaque nearest color index over a fixed palette.  The palette is converted to Lab once and
+/// stored in a k-d tree, so each lookup is O(log N) instead of a Delta-E against every entry.<br/>
+/// Read only after creation, one index can be queried from any number of threads.
+/// </summary>
+typedef struct PaletteIndex PaletteIndex;
+
+/// <summary>
+/// Builds a nearest color index for a palette.  Colors are converted with RgbToLab (D65 full).
+/// </summary>
+/// <param name="palette">Pointer to the palette colors, the index keeps its own copy.</param>
+/// <param name="count">Number of palette colors.</param>
+/// <returns>The new index, or NULL if palette is NULL, count is 0 or out of memory.  Release with PaletteIndexFree.</returns>
+CHIZL_COLORS_API PaletteIndex* PaletteIndexCreate(const RgbColor* palette, size_t count);
+
+/// <summary>
+/// Releases an index created by PaletteIndexCreate.  NULL is ignored.
+/// </summary>
+/// <param name="index">Index to free.</param>
+/// <returns>This function does not return a value.</returns>
+CHIZL_COLORS_API void PaletteIndexFree(PaletteIndex* index);
+
+/// <summary>
+/// Number of colors in the palette the index was built from.
+/// </summary>
+/// <param name="index">Palette index.</param>
+/// <returns>The palette size, 0 if index is NULL.</returns>
+CHIZL_COLORS_API size_t PaletteIndexCount(const PaletteIndex* index);
+
+/// <summary>
+/// Finds the palette entry closest to a Lab color.<br/>
+/// Returns the same entry as DeltaENearest over the palette Lab values (lowest index on ties).<br/>
+/// Exact for every formula: the CIE94 and CIEDE2000 searches prune with proven CIE76 bounds
+/// (see palette_index.c), CIEDE2000 just visits more of the tree than CIE76.
+/// </summary>
+/// <param name="index">Palette index.</param>
+/// <param name="lab">Color to match, used as the reference color for CIE94.</param>
+/// <param name="type">Delta-E formula to rank by.</param>
+/// <param name="distance">Optional, receives the Delta-E of the match.  May be NULL.</param>
+/// <returns>Palette index of the closest entry, or 0 if index is NULL.</returns>
+CHIZL_COLORS_API size_t PaletteIndexNearestLab(const PaletteIndex* index, LabSpace lab, DeltaEType type, double* distance);
+
+/// <summary>
+/// Finds the palette entry closest to an RGB color, see PaletteIndexNearestLab.
+/// </summary>
+/// <param name="index">Palette index.</param>
+/// <param name="rgb">Color to match.</param>
+/// <param name="type">Delta-E formula to rank by.</param>
+/// <param name="distance">Optional, receives the Delta-E of the match.  May be NULL.</param>
+/// <returns>Palette index of the closest entry, or 0 if index is NULL.</returns>
+CHIZL_COLORS_API size_t PaletteIndexNearest(const PaletteIndex* index, RgbColor rgb, DeltaEType type, double* distance);
+
+/// <summary>
+/// PaletteIndexNearest for an array of colors.  Runs of the same color (common in images) are only looked up once.
+/// </summary>
+/// <param name="index">Palette index.</param>
+/// <param name="rgb">Pointer to the colors to match.</param>
+/// <param name="out">Pointer to 'count' size_t values to receive the palette indexes.</param>
+/// <param name="distances">Optional, pointer to 'count' doubles to receive the Delta-E of each match.  May be NULL.</param>
+/// <param name="count">Number of colors.</param>
+/// <param name="type">Delta-E formula to rank by.</param>
+/// <returns>The number of colors matched, 0 if index, rgb or out is NULL.</returns>
+CHIZL_COLORS_API size_t PaletteIndexNearestBatch(const PaletteIndex* index, const RgbColor* rgb, size_t* out, double* distances, size_t count, DeltaEType type);
+
+// --- End of "extern C" block ---
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -0,0 +1,20 @@
+// palette_index_core.h
+#pragma once
+
+#ifndef PALETTE_INDEX_CORE_H
+#define PALETTE_INDEX_CORE_H
+
+// Internal only, not part of the public API.
+// Entry points into the palette k-d tree for other modules that run many lookups
+// in a row (PaletteCache builds, quantizers) and can skip the public NULL checks.
+
+#include "palette_index.h"
+
+/// <summary>
+/// PaletteIndexNearestLab with a starting guess.  'seed' is a palette index expected to be close
+/// (e.g. the match of the previous color in a scan), or PaletteIndexCount() for none.  The result is
+/// identical to an unseeded search, a good seed only makes it faster.  'index' must not be NULL.
+/// </summary>
+size_t PaletteIndexNearestSeeded(const PaletteIndex* index, LabSpace lab, DeltaEType type, size_t seed, double* distance);
+
+#endif
@@ -0,0 +1,118 @@
+// parallel.c
+#include "parallel.h"
+#include "thread_pool.h"
+#include "common.h"             // For stridedAt
+#include "cmyk_space.h"
+#include "hsl_space.h"
+#include "hsv_space.h"
+#include "lch_space.h"
+#include "luv_space.h"
+#include "xyz_space.h"
+
+// Output bytes per chunk.  Small enough that a chunk's input and output stay in a core's L2
+// while it is being written, large enough that claiming a chunk (one lock) is noise.
+#define PARALLEL_CHUNK_BYTES (256 * 1024)
+#define PARALLEL_MIN_CHUNK 1024
+
+// Chunks are a multiple of this many colors so the vector kernels see the same 4 / 8 wide
+// groups and scalar tail as one *Batch call over the whole buffer (bit-identical results).
+#define PARALLEL_CHUNK_ALIGN 64
+
+typedef enum {
+    PAR_HSV,
+    PAR_HSL,
+    PAR_CMYK,
+    PAR_XYZ,
+    PAR_LAB,
+    PAR_LUV,
+    PAR_LCH
+} ParallelTarget;
+
+typedef struct {
+    const RgbColor* rgb;
+    unsigned char* out;
+    size_t stride;
+    size_t size;
+    ParallelTarget target;
+} RgbParallelJob;
+
+static void RgbParallelTask(void* ctx, size_t begin, size_t end)
+{
+    const RgbParallelJob* job = (const RgbParallelJob*)ctx;
+    const RgbColor* rgb = job->rgb + begin;
+    void* out = stridedAt(job->out, begin, job->stride, job->size);
+    const size_t n = end - begin;
+
+    switch (job->target)
+    {
+    case PAR_HSV:
+        RgbToHsvBatch(rgb, (HsvSpace*)out, n, job->stride);
+        break;
+    case PAR_HSL:
+        RgbToHslBatch(rgb, (HslSpace*)out, n, job->stride);
+        break;
+    case PAR_CMYK:
+        RgbToCmykBatch(rgb, (CmykSpace*)out, n, job->stride);
+        break;
+    case PAR_XYZ:
+        RgbToXyzBatch(rgb, (XyzSpace*)out, n, job->stride);
+        break;
+    case PAR_LAB:
+        RgbToLabBatch(rgb, (LabSpace*)out, n, job->stride);
+        break;
+    case PAR_LUV:
+        RgbToLuvBatch(rgb, (LuvSpace*)out, n, job->stride);
+        break;
+    case PAR_LCH:
+        RgbToLchBatch(rgb, (LchSpace*)out, n, job->stride);
+        break;
+    }
+}
+
+static size_t RgbParallel(const RgbColor* rgb, void* out, size_t count, size_t stride, size_t size, ParallelTarget target)
+{
+    if (rgb == NULL || out == NULL)
+        return 0;
+
+    size_t chunk = PARALLEL_CHUNK_BYTES / (stride > size ? stride : size);
+    chunk = (chunk > PARALLEL_MIN_CHUNK) ? chunk - (chunk % PARALLEL_CHUNK_ALIGN) : PARALLEL_MIN_CHUNK;
+
+    const RgbParallelJob job = { rgb, (unsigned char*)out, stride, size, target };
+    ChizlParallelFor(count, chunk, RgbParallelTask, (void*)&job);
+    return count;
+}
+
+CHIZL_COLORS_API size_t RgbToHsvParallel(const RgbColor* rgb, HsvSpace* hsv, size_t count, size_t stride)
+{
+    return RgbParallel(rgb, hsv, count, stride, sizeof(HsvSpace), PAR_HSV);
+}
+
+CHIZL_COLORS_API size_t RgbToHslParallel(const RgbColor* rgb, HslSpace* hsl, size_t count, size_t stride)
+{
+    return RgbParallel(rgb, hsl, count, stride, sizeof(HslSpace), PAR_HSL);
+}
+
+CHIZL_COLORS_API size_t RgbToCmykParallel(const RgbColor* rgb, CmykSpace* cmyk, size_t count, size_t stride)
+{
+    return RgbParallel(rgb, cmyk, count, stride, sizeof(CmykSpace), PAR_CMYK);
+}
+
+CHIZL_COLORS_API size_t RgbToXyzParallel(const RgbColor* rgb, XyzSpace* xyz, size_t count, size_t stride)
+{
+    return RgbParallel(rgb, xyz, count, stride, sizeof(XyzSpace), PAR_XYZ);
+}
+
+CHIZL_COLORS_API size_t RgbToLabParallel(const RgbColor* rgb, LabSpace* lab, size_t count, size_t stride)
+{
+    return RgbParallel(rgb, lab, count, stride, sizeof(LabSpace), PAR_LAB);
+}
+
+CHIZL_COLORS_API size_t RgbToLuvParallel(const RgbColor* rgb, LuvSpace* luv, size_t count, size_t stride)
+{
+    return RgbParallel(rgb, luv, count, stride, sizeof(LuvSpace), PAR_LUV);
+}
+
+CHIZL_COLORS_API size_t RgbToLchParallel(const RgbColor* rgb, LchSpace* lch, size_t count, size_t stride)
+{
+    return RgbParallel(rgb, lch, count, stride, sizeof(LchSpace), PAR_LCH);
+}
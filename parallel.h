@@ -0,0 +1,99 @@
+// parallel.h
+
+#pragma once
+
+#ifndef PARALLEL_H
+#define PARALLEL_H
+
+// --- Start of "extern C" block ---
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "import_exports.h"
+#include "chizl_colors_types.h"
+#include <stddef.h>             // For size_t
+
+// Multithreaded versions of the RgbTo*Batch conversions for large buffers (whole images).
+// The input is cut into chunks of a few hundred KB of output, which the library's worker pool
+// and the calling thread convert in parallel with the matching *Batch function, so results are
+// identical to a single *Batch call.  The call returns when the whole buffer is done.
+// Thread count: ChizlSetThreadCount / ChizlGetThreadCount (color_support.h).
+// Buffers below one chunk, or calls made while another thread's parallel call is running, are
+// converted on the calling thread.
+
+/// <summary>
+/// RgbToHsvBatch split across the worker pool, same results.
+/// </summary>
+/// <param name="rgb">Pointer to the first RGB color to convert.</param>
+/// <param name="hsv">Pointer to the first HsvSpace to write.</param>
+/// <param name="count">Number of colors to convert.</param>
+/// <param name="stride">Distance in bytes between output elements, 0 for a tightly packed array.</param>
+/// <returns>The number of colors converted, 0 if either pointer is NULL.</returns>
+CHIZL_COLORS_API size_t RgbToHsvParallel(const RgbColor* rgb, HsvSpace* hsv, size_t count, size_t stride);
+
+/// <summary>
+/// RgbToHslBatch split across the worker pool, same results.
+/// </summary>
+/// <param name="rgb">Pointer to the first RGB color to convert.</param>
+/// <param name="hsl">Pointer to the first HslSpace to write.</param>
+/// <param name="count">Number of colors to convert.</param>
+/// <param name="stride">Distance in bytes between output elements, 0 for a tightly packed array.</param>
+/// <returns>The number of colors converted, 0 if either pointer is NULL.</returns>
+CHIZL_COLORS_API size_t RgbToHslParallel(const RgbColor* rgb, HslSpace* hsl, size_t count, size_t stride);
+
+/// <summary>
+/// RgbToCmykBatch split across the worker pool, same results.
+/// </summary>
+/// <param name="rgb">Pointer to the first RGB color to convert.</param>
+/// <param name="cmyk">Pointer to the first CmykSpace to write.</param>
+/// <param name="count">Number of colors to convert.</param>
+/// <param name="stride">Distance in bytes between output elements, 0 for a tightly packed array.</param>
+/// <returns>The number of colors converted, 0 if either pointer is NULL.</returns>
+CHIZL_COLORS_API size_t RgbToCmykParallel(const RgbColor* rgb, CmykSpace* cmyk, size_t count, size_t stride);
+
+/// <summary>
+/// RgbToXyzBatch split across the worker pool, same results.
+/// </summary>
+/// <param name="rgb">Pointer to the first RGB color to convert.</param>
+/// <param name="xyz">Pointer to the first XyzSpace to write.</param>
+/// <param name="count">Number of colors to convert.</param>
+/// <param name="stride">Distance in bytes between output elements, 0 for a tightly packed array.</param>
+/// <returns>The number of colors converted, 0 if either pointer is NULL.</returns>
+CHIZL_COLORS_API size_t RgbToXyzParallel(const RgbColor* rgb, XyzSpace* xyz, size_t count, size_t stride);
+
+/// <summary>
+/// RgbToLabBatch split across the worker pool, same results.
+/// </summary>
+/// <param name="rgb">Pointer to the first RGB color to convert.</param>
+/// <param name="lab">Pointer to the first LabSpace to write.</param>
+/// <param name="count">Number of colors to convert.</param>
+/// <param name="stride">Distance in bytes between output elements, 0 for a tightly packed array.</param>
+/// <returns>The number of colors converted, 0 if either pointer is NULL.</returns>
+CHIZL_COLORS_API size_t RgbToLabParallel(const RgbColor* rgb, LabSpace* lab, size_t count, size_t stride);
+
+/// <summary>
+/// RgbToLuvBatch split across the worker pool, same results.
+/// </summary>
+/// <param name="rgb">Pointer to the first RGB color to convert.</param>
+/// <param name="luv">Pointer to the first LuvSpace to write.</param>
+/// <param name="count">Number of colors to convert.</param>
+/// <param name="stride">Distance in bytes between output elements, 0 for a tightly packed array.</param>
+/// <returns>The number of colors converted, 0 if either pointer is NULL.</returns>
+CHIZL_COLORS_API size_t RgbToLuvParallel(const RgbColor* rgb, LuvSpace* luv, size_t count, size_t stride);
+
+/// <summary>
+/// RgbToLchBatch split across the worker pool, same results.
+/// </summary>
+/// <param name="rgb">Pointer to the first RGB color to convert.</param>
+/// <param name="lch">Pointer to the first LchSpace to write.</param>
+/// <param name="count">Number of colors to convert.</param>
+/// <param name="stride">Distance in bytes between output elements, 0 for a tightly packed array.</param>
+/// <returns>The number of colors converted, 0 if either pointer is NULL.</returns>
+CHIZL_COLORS_API size_t RgbToLchParallel(const RgbColor* rgb, LchSpace* lch, size_t count, size_t stride);
+
+// --- End of "extern C" block ---
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -0,0 +1,109 @@
+// planar.c
+#include "planar.h"
+#include "cie_common.h"         // For LabToXyz_White, XyzToRgb_Core
+#include "simd_kernels.h"       // For RgbPlanarToLabKernel, RgbDeinterleaveKernel, RgbInterleaveKernel
+#include "srgb_linear.h"        // For SrgbLinearTable
+
+// Planar (structure of arrays) conversions and interleave helpers.
+
+CHIZL_COLORS_API size_t RgbDeinterleave(const RgbColor* rgb, unsigned char* r, unsigned char* g, unsigned char* b, unsigned char* a, size_t count)
+{
+    if (rgb == NULL || r == NULL || g == NULL || b == NULL)
+        return 0;
+
+    // SSE4.1 byte shuffles when available, see simd_kernels.c.
+    RgbDeinterleaveKernel(rgb, r, g, b, a, count);
+    return count;
+}
+
+CHIZL_COLORS_API size_t RgbInterleave(const unsigned char* r, const unsigned char* g, const unsigned char* b, const unsigned char* a, RgbColor* rgb, size_t count)
+{
+    if (r == NULL || g == NULL || b == NULL || rgb == NULL)
+        return 0;
+
+    RgbInterleaveKernel(r, g, b, a, rgb, count);
+    return count;
+}
+
+CHIZL_COLORS_API size_t LabDeinterleave(const LabSpace* lab, double* l, double* a, double* b, size_t count)
+{
+    if (lab == NULL || l == NULL || a == NULL || b == NULL)
+        return 0;
+
+    for (size_t i = 0; i < count; i++)
+    {
+        l[i] = lab[i].l;
+        a[i] = lab[i].a;
+        b[i] = lab[i].b;
+    }
+    return count;
+}
+
+CHIZL_COLORS_API size_t LabInterleave(const double* l, const double* a, const double* b, LabSpace* lab, size_t count)
+{
+    if (l == NULL || a == NULL || b == NULL || lab == NULL)
+        return 0;
+
+    for (size_t i = 0; i < count; i++)
+    {
+        lab[i].l = l[i];
+        lab[i].a = a[i];
+        lab[i].b = b[i];
+    }
+    return count;
+}
+
+CHIZL_COLORS_API size_t RgbPlanarToLabPlanar(const unsigned char* r, const unsigned char* g, const unsigned char* b,
+    double* lOut, double* aOut, double* bOut, size_t count)
+{
+    if (r == NULL || g == NULL || b == NULL || lOut == NULL || aOut == NULL || bOut == NULL)
+        return 0;
+
+    RgbPlanarToLabKernel(r, g, b, lOut, aOut, bOut, count, SrgbLinearTable(), WP_D65_FULL);
+    return count;
+}
+
+CHIZL_COLORS_API size_t RgbPlanarToLabPlanarF(const unsigned char* r, const unsigned char* g, const unsigned char* b,
+    float* lOut, float* aOut, float* bOut, size_t count)
+{
+    if (r == NULL || g == NULL || b == NULL || lOut == NULL || aOut == NULL || bOut == NULL)
+        return 0;
+
+    // Double kernel into small stack planes that stay in L1, then narrow (same as RgbToLabFBatch).
+    const double* linear = SrgbLinearTable();
+    double l[256], a[256], bb[256];
+
+    for (size_t done = 0; done < count; )
+    {
+        const size_t n = (count - done < 256) ? count - done : 256;
+        RgbPlanarToLabKernel(r + done, g + done, b + done, l, a, bb, n, linear, WP_D65_FULL);
+
+        for (size_t i = 0; i < n; i++)
+        {
+            lOut[done + i] = (float)l[i];
+            aOut[done + i] = (float)a[i];
+            bOut[done + i] = (float)bb[i];
+        }
+        done += n;
+    }
+    return count;
+}
+
+CHIZL_COLORS_API size_t LabPlanarToRgbPlanar(const double* l, const double* a, const double* b,
+    unsigned char* rOut, unsigned char* gOut, unsigned char* bOut, size_t count)
+{
+    if (l == NULL || a == NULL || b == NULL || rOut == NULL || gOut == NULL || bOut == NULL)
+        return 0;
+
+    const WhitePoint wp = WP_D65_FULL;     // Same default as RgbToLab
+
+    for (size_t i = 0; i < count; i++)
+    {
+        const LabSpace lab = { l[i], a[i], b[i] };
+        const RgbColor rgb = XyzToRgb_Core(LabToXyz_White(lab, wp));
+        rOut[i] = rgb.red;
+        gOut[i] = rgb.green;
+        bOut[i] = rgb.blue;
+    }
+    return count;
+}
@@ -0,0 +1,114 @@
+// planar.h
+
+#pragma once
+
+#ifndef PLANAR_H
+#define PLANAR_H
+
+// --- Start of "extern C" block ---
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "import_exports.h"
+#include "chizl_colors_types.h"
+#include <stddef.h>             // For size_t
+
+// Planar (structure of arrays) buffers: one array per channel instead of an array of structs.
+// Decoders and vector code usually work this way, these entry points take and produce planes
+// directly so no reshuffle pass is needed.  All planes hold 'count' elements.
+
+/// <summary>
+/// Splits an array of RgbColor into separate R, G, B and (optionally) A byte planes.
+/// </summary>
+/// <param name="rgb">Pointer to the colors to split.</param>
+/// <param name="r">Receives the red plane.</param>
+/// <param name="g">Receives the green plane.</param>
+/// <param name="b">Receives the blue plane.</param>
+/// <param name="a">Receives the alpha plane, NULL to skip alpha.</param>
+/// <param name="count">Number of colors.</param>
+/// <returns>The number of colors split, 0 if rgb, r, g or b is NULL.</returns>
+CHIZL_COLORS_API size_t RgbDeinterleave(const RgbColor* rgb, unsigned char* r, unsigned char* g, unsigned char* b, unsigned char* a, size_t count);
+
+/// <summary>
+/// Joins separate R, G, B and (optionally) A byte planes into an array of RgbColor.
+/// </summary>
+/// <param name="r">Red plane.</param>
+/// <param name="g">Green plane.</param>
+/// <param name="b">Blue plane.</param>
+/// <param name="a">Alpha plane, NULL for fully opaque (255).</param>
+/// <param name="rgb">Receives the colors.</param>
+/// <param name="count">Number of colors.</param>
+/// <returns>The number of colors written, 0 if r, g, b or rgb is NULL.</returns>
+CHIZL_COLORS_API size_t RgbInterleave(const unsigned char* r, const unsigned char* g, const unsigned char* b, const unsigned char* a, RgbColor* rgb, size_t count);
+
+/// <summary>
+/// Splits an array of LabSpace into separate L, a and b planes.
+/// </summary>
+/// <param name="lab">Pointer to the Lab values to split.</param>
+/// <param name="l">Receives the L* plane.</param>
+/// <param name="a">Receives the a* plane.</param>
+/// <param name="b">Receives the b* plane.</param>
+/// <param name="count">Number of values.</param>
+/// <returns>The number of values split, 0 if any pointer is NULL.</returns>
+CHIZL_COLORS_API size_t LabDeinterleave(const LabSpace* lab, double* l, double* a, double* b, size_t count);
+
+/// <summary>
+/// Joins separate L, a and b planes into an array of LabSpace.
+/// </summary>
+/// <param name="l">L* plane.</param>
+/// <param name="a">a* plane.</param>
+/// <param name="b">b* plane.</param>
+/// <param name="lab">Receives the Lab values.</param>
+/// <param name="count">Number of values.</param>
+/// <returns>The number of values written, 0 if any pointer is NULL.</returns>
+CHIZL_COLORS_API size_t LabInterleave(const double* l, const double* a, const double* b, LabSpace* lab, size_t count);
+
+/// <summary>
+/// RGB planes to Lab planes, same values as RgbToLabBatch (vectorized the same way, WP_D65_FULL).
+/// Planes in and out means the vector lanes load and store whole registers, nothing is regrouped per pixel.
+/// </summary>
+/// <param name="r">Red plane.</param>
+/// <param name="g">Green plane.</param>
+/// <param name="b">Blue plane.</param>
+/// <param name="lOut">Receives the L* plane.</param>
+/// <param name="aOut">Receives the a* plane.</param>
+/// <param name="bOut">Receives the b* plane.</param>
+/// <param name="count">Number of colors.</param>
+/// <returns>The number of colors converted, 0 if any pointer is NULL.</returns>
+CHIZL_COLORS_API size_t RgbPlanarToLabPlanar(const unsigned char* r, const unsigned char* g, const unsigned char* b,
+    double* lOut, double* aOut, double* bOut, size_t count);
+
+/// <summary>
+/// RgbPlanarToLabPlanar with float planes, half the output memory (see LabSpaceF for accuracy).
+/// </summary>
+/// <param name="r">Red plane.</param>
+/// <param name="g">Green plane.</param>
+/// <param name="b">Blue plane.</param>
+/// <param name="lOut">Receives the L* plane.</param>
+/// <param name="aOut">Receives the a* plane.</param>
+/// <param name="bOut">Receives the b* plane.</param>
+/// <param name="count">Number of colors.</param>
+/// <returns>The number of colors converted, 0 if any pointer is NULL.</returns>
+CHIZL_COLORS_API size_t RgbPlanarToLabPlanarF(const unsigned char* r, const unsigned char* g, const unsigned char* b,
+    float* lOut, float* aOut, float* bOut, size_t count);
+
+/// <summary>
+/// Lab planes back to RGB planes, same values as LabToRgbBatch (WP_D65_FULL, out of gamut clamped).
+/// </summary>
+/// <param name="l">L* plane.</param>
+/// <param name="a">a* plane.</param>
+/// <param name="b">b* plane.</param>
+/// <param name="rOut">Receives the red plane.</param>
+/// <param name="gOut">Receives the green plane.</param>
+/// <param name="bOut">Receives the blue plane.</param>
+/// <param name="count">Number of colors.</param>
+/// <returns>The number of colors converted, 0 if any pointer is NULL.</returns>
+CHIZL_COLORS_API size_t LabPlanarToRgbPlanar(const double* l, const double* a, const double* b,
+    unsigned char* rOut, unsigned char* gOut, unsigned char* bOut, size_t count);
+
+// --- End of "extern C" block ---
+#ifdef __cplusplus
+}
+#endif
+#endif
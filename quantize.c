@@ -0,0 +1,594 @@
+// quantize.c
+#include "quantize.h"
+#include "palette_index.h"
+#include "palette_index_core.h"  // For PaletteIndexNearestSeeded
+#include "thread_pool.h"
+#include "color_support.h"       // For ChizlGetThreadCount
+#include "cie_common.h"          // For RgbToXyz_Core, XyzToLab_White, LabToXyz_White, XyzToRgb_Core
+#include "srgb_linear.h"         // For SrgbLinearTable
+#include <stdint.h>              // For uint32_t, uint64_t
+#include <stdlib.h>              // For malloc, free, qsort
+#include <string.h>              // For memset
+
+// Image quantization in three steps:
+//
+// 1. Histogram.  Pixels are counted into a 5-5-5 bit RGB cube with the channel sums of every cell,
+//    so a cell stands for the mean of the pixels that fell in it, not its corner.  Each thread fills
+//    its own slice histogram with 32-bit counters, the slices are then added into one 64-bit histogram.
+//    Memory depends on the thread count only, never on the image size.
+// 2. Palette.  Every non-empty cell becomes one weighted Lab point (at most 32768) and median cut or
+//    k-means runs on those points.
+// 3. Index map.  Pixels are matched to the palette through a PaletteIndex on the thread pool.
+
+#define QUANT_BITS 5
+#define QUANT_BINS (1 << (3 * QUANT_BITS))
+
+// Pixels per slice.  255 * 2^24 still fits a 32-bit channel sum, larger images take several passes.
+#define QUANT_SLICE_MAX ((size_t)1 << 24)
+
+// Below this many pixels per slice, clearing the slice histogram costs more than the extra thread saves.
+#define QUANT_SLICE_MIN (64 * 1024)
+#define QUANT_MAX_SLICES 16
+
+#define QUANT_ASSIGN_CHUNK 1024
+#define QUANT_MAP_CHUNK (16 * 1024)
+#define QUANT_MAP_CACHE_BITS 12
+#define QUANT_MAP_CACHE (1 << QUANT_MAP_CACHE_BITS)
+#define QUANT_KMEANS_MAX_ITERATIONS 24
+
+typedef struct {
+    uint32_t n, r, g, b;
+} SliceBin;
+
+typedef struct {
+    uint64_t n, r, g, b;
+} HistBin;
+
+// One histogram cell as a Lab point, weighted by its pixel count.
+typedef struct {
+    double p[3];                // L*, a*, b*
+    double w;
+} QuantPoint;
+
+// A palette candidate: median cut box or k-means cluster.
+typedef struct {
+    double mean[3];
+    double w;
+    size_t order;               // Creation order, breaks weight ties so the palette order is fixed
+} QuantColor;
+
+static inline size_t BinOf(RgbColor c)
+{
+    return ((size_t)(c.red >> (8 - QUANT_BITS)) << (2 * QUANT_BITS)) |
+           ((size_t)(c.green >> (8 - QUANT_BITS)) << QUANT_BITS) |
+           (size_t)(c.blue >> (8 - QUANT_BITS));
+}
+
+static inline double Dist2(const double* a, const double* b)
+{
+    const double dl = a[0] - b[0];
+    const double da = a[1] - b[1];
+    const double db = a[2] - b[2];
+    return dl * dl + da * da + db * db;
+}
+
+// --- Histogram ---
+
+typedef struct {
+    const RgbColor* pixels;     // First pixel of this pass
+    size_t count;               // Pixels in this pass
+    size_t sliceSize;
+    SliceBin* slices;
+} HistJob;
+
+static void HistTask(void* ctx, size_t begin, size_t end)
+{
+    const HistJob* job = (const HistJob*)ctx;
+
+    for (size_t s = begin; s < end; s++)
+    {
+        SliceBin* bins = job->slices + s * QUANT_BINS;
+        const size_t first = s * job->sliceSize;
+        const size_t last = (job->count - first > job->sliceSize) ? first + job->sliceSize : job->count;
+
+        memset(bins, 0, QUANT_BINS * sizeof(SliceBin));
+        for (size_t i = first; i < last; i++)
+        {
+            const RgbColor c = job->pixels[i];
+            SliceBin* bin = bins + BinOf(c);
+            bin->n++;
+            bin->r += c.red;
+            bin->g += c.green;
+            bin->b += c.blue;
+        }
+    }
+}
+
+static int BuildHistogram(const RgbColor* pixels, size_t count, HistBin* hist)
+{
+    size_t slices = ChizlGetThreadCount();
+    if (slices > QUANT_MAX_SLICES)
+        slices = QUANT_MAX_SLICES;
+    if (slices > (count + QUANT_SLICE_MIN - 1) / QUANT_SLICE_MIN)
+        slices = (count + QUANT_SLICE_MIN - 1) / QUANT_SLICE_MIN;
+    if (slices < 1)
+        slices = 1;
+
+    SliceBin* bins = (SliceBin*)malloc(slices * QUANT_BINS * sizeof(SliceBin));
+    if (bins == NULL)
+        return 0;
+
+    memset(hist, 0, QUANT_BINS * sizeof(HistBin));
+    for (size_t done = 0; done < count; )
+    {
+        const size_t left = count - done;
+        const size_t pass = (left / slices > QUANT_SLICE_MAX) ? slices * QUANT_SLICE_MAX : left;
+        const size_t sliceSize = (pass + slices - 1) / slices;
+        const size_t used = (pass + sliceSize - 1) / sliceSize;
+
+        const HistJob job = { pixels + done, pass, sliceSize, bins };
+        ChizlParallelFor(used, 1, HistTask, (void*)&job);
+
+        for (size_t s = 0; s < used; s++)
+        {
+            const SliceBin* src = bins + s * QUANT_BINS;
+            for (size_t i = 0; i < QUANT_BINS; i++)
+            {
+                hist[i].n += src[i].n;
+                hist[i].r += src[i].r;
+                hist[i].g += src[i].g;
+                hist[i].b += src[i].b;
+            }
+        }
+        done += pass;
+    }
+
+    free(bins);
+    return 1;
+}
+
+/// <summary>
+/// One Lab point per non-empty histogram cell, at the cell's mean color.  Returns the point count.
+/// </summary>
+static size_t HistogramPoints(const HistBin* hist, QuantPoint* points)
+{
+    const double* linear = SrgbLinearTable();
+    size_t n = 0;
+
+    for (size_t i = 0; i < QUANT_BINS; i++)
+    {
+        if (hist[i].n == 0)
+            continue;
+
+        const uint64_t half = hist[i].n / 2;
+        const RgbColor mean = {
+            255,
+            (unsigned char)((hist[i].r + half) / hist[i].n),
+            (unsigned char)((hist[i].g + half) / hist[i].n),
+            (unsigned char)((hist[i].b + half) / hist[i].n)
+        };
+        const LabSpace lab = XyzToLab_White(RgbToXyz_Core(mean, linear), WP_D65_FULL);
+        points[n].p[0] = lab.l;
+        points[n].p[1] = lab.a;
+        points[n].p[2] = lab.b;
+        points[n].w = (double)hist[i].n;
+        n++;
+    }
+    return n;
+}
+
+// --- Median cut ---
+
+typedef struct {
+    size_t begin, end;          // Range of the points array
+    double w;
+    double mean[3];
+    double sse;                 // Weighted squared error around the mean, the split priority
+    int axis;                   // Axis with the largest spread
+} QuantBox;
+
+static int CompareL(const void* a, const void* b)
+{
+    const double x = ((const QuantPoint*)a)->p[0], y = ((const QuantPoint*)b)->p[0];
+    return (x > y) - (x < y);
+}
+
+static int CompareA(const void* a, const void* b)
+{
+    const double x = ((const QuantPoint*)a)->p[1], y = ((const QuantPoint*)b)->p[1];
+    return (x > y) - (x < y);
+}
+
+static int CompareB(const void* a, const void* b)
+{
+    const double x = ((const QuantPoint*)a)->p[2], y = ((const QuantPoint*)b)->p[2];
+    return (x > y) - (x < y);
+}
+
+static void BoxStats(const QuantPoint* points, QuantBox* box)
+{
+    double w = 0.0;
+    double s1[3] = { 0.0, 0.0, 0.0 };
+    double s2[3] = { 0.0, 0.0, 0.0 };
+
+    for (size_t i = box->begin; i < box->end; i++)
+    {
+        const QuantPoint* pt = points + i;
+        w += pt->w;
+        for (int k = 0; k < 3; k++)
+        {
+            s1[k] += pt->w * pt->p[k];
+            s2[k] += pt->w * pt->p[k] * pt->p[k];
+        }
+    }
+
+    box->w = w;
+    box->sse = 0.0;
+    box->axis = 0;
+    double widest = -1.0;
+    for (int k = 0; k < 3; k++)
+    {
+        box->mean[k] = s1[k] / w;
+        double var = s2[k] - s1[k] * s1[k] / w;
+        if (var < 0.0)
+            var = 0.0;
+        box->sse += var;
+        if (var > widest)
+        {
+            widest = var;
+            box->axis = k;
+        }
+    }
+}
+
+static size_t MedianCut(QuantPoint* points, size_t pointCount, size_t maxColors, QuantColor* out)
+{
+    static int (* const compare[3])(const void*, const void*) = { CompareL, CompareA, CompareB };
+
+    QuantBox* boxes = (QuantBox*)malloc(maxColors * sizeof(QuantBox));
+    if (boxes == NULL)
+        return 0;
+
+    size_t count = 1;
+    boxes[0].begin = 0;
+    boxes[0].end = pointCount;
+    BoxStats(points, &boxes[0]);
+
+    while (count < maxColors)
+    {
+        // Worst box that can still be split.
+        size_t pick = count;
+        for (size_t i = 0; i < count; i++)
+        {
+            if (boxes[i].end - boxes[i].begin > 1 && boxes[i].sse > 0.0 && (pick == count || boxes[i].sse > boxes[pick].sse))
+                pick = i;
+        }
+        if (pick == count)
+            break;
+
+        QuantBox* box = boxes + pick;
+        qsort(points + box->begin, box->end - box->begin, sizeof(QuantPoint), compare[box->axis]);
+
+        // Weighted median, both halves keep at least one point.
+        const double half = box->w / 2.0;
+        double sum = 0.0;
+        size_t split = box->begin + 1;
+        for (size_t i = box->begin; i < box->end - 1; i++)
+        {
+            sum += points[i].w;
+            split = i + 1;
+            if (sum >= half)
+                break;
+        }
+
+        QuantBox* right = boxes + count++;
+        right->begin = split;
+        right->end = box->end;
+        box->end = split;
+        BoxStats(points, box);
+        BoxStats(points, right);
+    }
+
+    for (size_t i = 0; i < count; i++)
+    {
+        out[i].mean[0] = boxes[i].mean[0];
+        out[i].mean[1] = boxes[i].mean[1];
+        out[i].mean[2] = boxes[i].mean[2];
+        out[i].w = boxes[i].w;
+        out[i].order = i;
+    }
+
+    free(boxes);
+    return count;
+}
+
+// --- K-means ---
+
+typedef struct {
+    const QuantPoint* points;
+    const QuantColor* centers;
+    size_t centerCount;
+    size_t* next;
+} AssignJob;
+
+static size_t NearestCenter(const QuantColor* centers, size_t count, const double* p)
+{
+    size_t best = 0;
+    double bestD2 = Dist2(centers[0].mean, p);
+    for (size_t c = 1; c < count; c++)
+    {
+        const double d2 = Dist2(centers[c].mean, p);
+        if (d2 < bestD2)
+        {
+            bestD2 = d2;
+            best = c;
+        }
+    }
+    return best;
+}
+
+static void AssignTask(void* ctx, size_t begin, size_t end)
+{
+    const AssignJob* job = (const AssignJob*)ctx;
+    for (size_t i = begin; i < end; i++)
+        job->next[i] = NearestCenter(job->centers, job->centerCount, job->points[i].p);
+}
+
+/// <summary>
+/// xorshift64*, a fixed seed keeps the k-means++ picks (and so the palette) the same on every run.
+/// </summary>
+static inline double NextRandom(uint64_t* state)
+{
+    uint64_t x = *state;
+    x ^= x >> 12;
+    x ^= x << 25;
+    x ^= x >> 27;
+    *state = x;
+    return (double)((x * 0x2545F4914F6CDD1DULL) >> 11) * (1.0 / 9007199254740992.0);
+}
+
+/// <summary>
+/// k-means++: the first center is drawn by pixel count, every next one by pixel count times the
+/// squared distance to the closest center so far.  Stops early once every point is a center.
+/// </summary>
+static size_t SeedCenters(const QuantPoint* points, size_t pointCount, size_t k, double* d2, QuantColor* centers)
+{
+    uint64_t state = 0x9E3779B97F4A7C15ULL;
+    size_t count = 0;
+
+    for (size_t i = 0; i < pointCount; i++)
+        d2[i] = 1.0;
+
+    while (count < k)
+    {
+        double total = 0.0;
+        for (size_t i = 0; i < pointCount; i++)
+            total += points[i].w * d2[i];
+        if (total <= 0.0)
+            break;
+
+        const double target = NextRandom(&state) * total;
+        size_t pick = pointCount - 1;
+        double sum = 0.0;
+        for (size_t i = 0; i < pointCount; i++)
+        {
+            sum += points[i].w * d2[i];
+            if (sum > target && d2[i] > 0.0)
+            {
+                pick = i;
+                break;
+            }
+        }
+
+        QuantColor* c = centers + count;
+        c->mean[0] = points[pick].p[0];
+        c->mean[1] = points[pick].p[1];
+        c->mean[2] = points[pick].p[2];
+        c->w = 0.0;
+        c->order = count;
+        count++;
+
+        for (size_t i = 0; i < pointCount; i++)
+        {
+            const double d = Dist2(c->mean, points[i].p);
+            if (count == 1 || d < d2[i])
+                d2[i] = d;
+        }
+    }
+    return count;
+}
+
+static size_t KMeans(const QuantPoint* points, size_t pointCount, size_t maxColors, QuantColor* out)
+{
+    // Per point: k-means++ distance, cluster and the cluster found by the next assignment pass.
+    double* d2 = (double*)malloc(pointCount * sizeof(double));
+    size_t* cluster = (size_t*)malloc(pointCount * sizeof(size_t));
+    size_t* next = (size_t*)malloc(pointCount * sizeof(size_t));
+    double* sums = (double*)malloc(maxColors * 4 * sizeof(double));
+    if (d2 == NULL || cluster == NULL || next == NULL || sums == NULL)
+    {
+        free(d2);
+        free(cluster);
+        free(next);
+        free(sums);
+        return 0;
+    }
+
+    const size_t count = SeedCenters(points, pointCount, maxColors, d2, out);
+    for (size_t i = 0; i < pointCount; i++)
+        cluster[i] = count;
+
+    const AssignJob job = { points, out, count, next };
+    for (int iteration = 0; iteration < QUANT_KMEANS_MAX_ITERATIONS; iteration++)
+    {
+        ChizlParallelFor(pointCount, QUANT_ASSIGN_CHUNK, AssignTask, (void*)&job);
+
+        // Summed in point order on this thread, the result does not depend on the thread count.
+        size_t changed = 0;
+        memset(sums, 0, count * 4 * sizeof(double));
+        for (size_t i = 0; i < pointCount; i++)
+        {
+            if (next[i] != cluster[i])
+            {
+                cluster[i] = next[i];
+                changed++;
+            }
+
+            double* s = sums + cluster[i] * 4;
+            s[0] += points[i].w * points[i].p[0];
+            s[1] += points[i].w * points[i].p[1];
+            s[2] += points[i].w * points[i].p[2];
+            s[3] += points[i].w;
+        }
+        if (changed == 0)
+            break;
+
+        for (size_t c = 0; c < count; c++)
+        {
+            const double* s = sums + c * 4;
+            out[c].w = s[3];
+            if (s[3] > 0.0)
+            {
+                out[c].mean[0] = s[0] / s[3];
+                out[c].mean[1] = s[1] / s[3];
+                out[c].mean[2] = s[2] / s[3];
+                continue;
+            }
+
+            // Empty cluster: move it to the point that costs its current cluster the most.
+            size_t worst = 0;
+            double worstCost = -1.0;
+            for (size_t i = 0; i < pointCount; i++)
+            {
+                const double cost = points[i].w * Dist2(out[cluster[i]].mean, points[i].p);
+                if (cost > worstCost)
+                {
+                    worstCost = cost;
+                    worst = i;
+                }
+            }
+            out[c].mean[0] = points[worst].p[0];
+            out[c].mean[1] = points[worst].p[1];
+            out[c].mean[2] = points[worst].p[2];
+        }
+    }
+
+    // Final weights for the centers the last pass settled on.
+    for (size_t c = 0; c < count; c++)
+        out[c].w = 0.0;
+    for (size_t i = 0; i < pointCount; i++)
+        out[cluster[i]].w += points[i].w;
+
+    free(d2);
+    free(cluster);
+    free(next);
+    free(sums);
+    return count;
+}
+
+// --- Index map ---
+
+typedef struct {
+    const PaletteIndex* index;
+    const RgbColor* pixels;
+    unsigned char* indexes;
+} RemapJob;
+
+static void RemapTask(void* ctx, size_t begin, size_t end)
+{
+    const RemapJob* job = (const RemapJob*)ctx;
+    const double* linear = SrgbLinearTable();
+    const RgbColor* px = job->pixels;
+    size_t last = PaletteIndexCount(job->index);
+
+    // Direct mapped cache of recent colors, photos repeat colors far more often than in runs.
+    // Keys carry bit 24 so the zeroed table never matches black.
+    uint32_t keys[QUANT_MAP_CACHE];
+    unsigned char values[QUANT_MAP_CACHE];
+    memset(keys, 0, sizeof(keys));
+
+    for (size_t i = begin; i < end; i++)
+    {
+        // Same color as the previous pixel, reuse its match.
+        if (i == begin || px[i].red != px[i - 1].red || px[i].green != px[i - 1].green || px[i].blue != px[i - 1].blue)
+        {
+            const uint32_t key = 0x1000000u | ((uint32_t)px[i].red << 16) | ((uint32_t)px[i].green << 8) | px[i].blue;
+            const size_t slot = (size_t)((key * 2654435761u) >> (32 - QUANT_MAP_CACHE_BITS));
+            if (keys[slot] == key)
+                last = values[slot];
+            else
+            {
+                const LabSpace lab = XyzToLab_White(RgbToXyz_Core(px[i], linear), WP_D65_FULL);
+                last = PaletteIndexNearestSeeded(job->index, lab, DELTAE_CIE76, last, NULL);
+                keys[slot] = key;
+                values[slot] = (unsigned char)last;
+            }
+        }
+        job->indexes[i] = (unsigned char)last;
+    }
+}
+
+static int CompareWeight(const void* a, const void* b)
+{
+    const QuantColor* x = (const QuantColor*)a;
+    const QuantColor* y = (const QuantColor*)b;
+    if (x->w != y->w)
+        return (x->w < y->w) ? 1 : -1;
+    return (x->order > y->order) - (x->order < y->order);
+}
+
+CHIZL_COLORS_API size_t QuantizeRemap(const RgbColor* pixels, size_t count, const RgbColor* palette, size_t paletteCount, unsigned char* indexes)
+{
+    if (pixels == NULL || palette == NULL || indexes == NULL || paletteCount == 0 || paletteCount > QUANTIZE_MAX_COLORS)
+        return 0;
+
+    PaletteIndex* index = PaletteIndexCreate(palette, paletteCount);
+    if (index == NULL)
+        return 0;
+
+    const RemapJob job = { index, pixels, indexes };
+    ChizlParallelFor(count, QUANT_MAP_CHUNK, RemapTask, (void*)&job);
+
+    PaletteIndexFree(index);
+    return count;
+}
+
+CHIZL_COLORS_API size_t QuantizeImage(const RgbColor* pixels, size_t count, RgbColor* palette, size_t maxColors, unsigned char* indexes, QuantizeMethod method)
+{
+    if (pixels == NULL || palette == NULL || count == 0 || maxColors == 0 || maxColors > QUANTIZE_MAX_COLORS)
+        return 0;
+    if (method != QUANTIZE_MEDIAN_CUT && method != QUANTIZE_KMEANS)
+        return 0;
+
+    HistBin* hist = (HistBin*)malloc(QUANT_BINS * sizeof(HistBin));
+    QuantPoint* points = (QuantPoint*)malloc(QUANT_BINS * sizeof(QuantPoint));
+    QuantColor* colors = (QuantColor*)malloc(maxColors * sizeof(QuantColor));
+    size_t colorCount = 0;
+
+    if (hist != NULL && points != NULL && colors != NULL && BuildHistogram(pixels, count, hist))
+    {
+        const size_t pointCount = HistogramPoints(hist, points);
+        colorCount = (method == QUANTIZE_KMEANS)
+            ? KMeans(points, pointCount, maxColors, colors)
+            : MedianCut(points, pointCount, maxColors, colors);
+    }
+
+    // Most used first.  A k-means cluster left empty by the last pass has no pixels, drop it.
+    if (colorCount > 1)
+        qsort(colors, colorCount, sizeof(QuantColor), CompareWeight);
+    while (colorCount > 1 && colors[colorCount - 1].w <= 0.0)
+        colorCount--;
+    for (size_t i = 0; i < colorCount; i++)
+    {
+        const LabSpace lab = { colors[i].mean[0], colors[i].mean[1], colors[i].mean[2] };
+        palette[i] = XyzToRgb_Core(LabToXyz_White(lab, WP_D65_FULL));
+    }
+
+    free(hist);
+    free(points);
+    free(colors);
+
+    if (colorCount != 0 && indexes != NULL && QuantizeRemap(pixels, count, palette, colorCount, indexes) == 0)
+        return 0;
+    return colorCount;
+}
@@ -0,0 +1,73 @@
+// quantize.h
+
+#pragma once
+
+#ifndef QUANTIZE_H
+#define QUANTIZE_H
+
+// --- Start of "extern C" block ---
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "import_exports.h"
+#include "chizl_colors_types.h"
+#include <stddef.h>             // For size_t
+
+/// <summary>
+/// Largest palette QuantizeImage builds, so every index fits in one byte of the index map.
+/// </summary>
+#define QUANTIZE_MAX_COLORS 256
+
+/// <summary>
+/// Palette selection algorithms for QuantizeImage.  Both work in Lab on a color histogram of the
+/// image, not on the pixels, so their cost does not grow with the image size.
+/// </summary>
+typedef enum {
+    /// <summary>
+    /// Median cut: the box with the largest squared error is split at the weighted median of its
+    /// widest Lab axis until there are maxColors boxes.  Fast and predictable.
+    /// </summary>
+    QUANTIZE_MEDIAN_CUT = 0,
+    /// <summary>
+    /// K-means: k-means++ seeding followed by Lloyd iterations in Lab until no color changes cluster.
+    /// Slower than median cut, usually a lower error.  Seeding is deterministic, the same image always
+    /// gives the same palette.
+    /// </summary>
+    QUANTIZE_KMEANS = 1
+} QuantizeMethod;
+
+/// <summary>
+/// Reduces an image to a palette of at most maxColors colors and optionally maps every pixel to it.<br/>
+/// Pixels are counted into a 5-5-5 bit RGB histogram (cells of 8x8x8 colors, represented by their mean),
+/// the palette is chosen in Lab, and the index map is filled with PaletteIndex (CIE76) matches.  Memory is
+/// about 2 MB plus 512 KB per thread whatever the image size.
+/// The histogram and index map run on the thread pool (see ChizlSetThreadCount).<br/>
+/// Alpha is ignored, palette colors have alpha 255.  Palette entries are ordered by pixel count, most used first.
+/// </summary>
+/// <param name="pixels">Pointer to the image pixels.</param>
+/// <param name="count">Number of pixels.</param>
+/// <param name="palette">Pointer to 'maxColors' colors to receive the palette.</param>
+/// <param name="maxColors">Palette size wanted, 1 to QUANTIZE_MAX_COLORS.  Images with fewer distinct colors get a smaller palette.</param>
+/// <param name="indexes">Optional, pointer to 'count' bytes to receive the palette index of each pixel.  May be NULL.</param>
+/// <param name="method">Palette selection algorithm.</param>
+/// <returns>The number of palette colors written, 0 on bad arguments or out of memory.</returns>
+CHIZL_COLORS_API size_t QuantizeImage(const RgbColor* pixels, size_t count, RgbColor* palette, size_t maxColors, unsigned char* indexes, QuantizeMethod method);
+
+/// <summary>
+/// Maps every pixel to its closest palette color (CIE76, same match as PaletteIndexNearest) on the thread pool.
+/// For reusing a QuantizeImage palette on more frames, or any palette of up to QUANTIZE_MAX_COLORS colors.
+/// </summary>
+/// <param name="pixels">Pointer to the image pixels.</param>
+/// <param name="count">Number of pixels.</param>
+/// <param name="palette">Pointer to the palette colors.</param>
+/// <param name="paletteCount">Number of palette colors, 1 to QUANTIZE_MAX_COLORS.</param>
+/// <param name="indexes">Pointer to 'count' bytes to receive the palette index of each pixel.</param>
+/// <returns>The number of pixels mapped, 0 on bad arguments or out of memory.</returns>
+CHIZL_COLORS_API size_t QuantizeRemap(const RgbColor* pixels, size_t count, const RgbColor* palette, size_t paletteCount, unsigned char* indexes);
+
+// --- End of "extern C" block ---
+#ifdef __cplusplus
+}
+#endif
+#endif
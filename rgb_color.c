@@ -1,33 +1,83 @@
 // rgb_color.c
 #include "rgb_color.h"
 #include "common.h"             // clampDbl
-#include <string.h>             // For strlen, strcpy_s
+#include <string.h>             // For memcpy
 #include <math.h>               // For fmin, fmax, fabs, round, pow
-#include <stdio.h>              // Required for sprintf
 #include <objbase.h>            // For malloc
 
-CHIZL_COLORS_API char* RgbToRgbHex(RgbColor clr, unsigned int includeAlpha)
-{
-    char rgbHex[16] = { 0 };
+// Two uppercase hex digits per byte value, so a channel is one 2 char copy instead of two nibble lookups.
+static const char s_hexPairs[512] =
+    "000102030405060708090A0B0C0D0E0F101112131415161718191A1B1C1D1E1F"
+    "202122232425262728292A2B2C2D2E2F303132333435363738393A3B3C3D3E3F"
+    "404142434445464748494A4B4C4D4E4F505152535455565758595A5B5C5D5E5F"
+    "606162636465666768696A6B6C6D6E6F707172737475767778797A7B7C7D7E7F"
+    "808182838485868788898A8B8C8D8E8F909192939495969798999A9B9C9D9E9F"
+    "A0A1A2A3A4A5A6A7A8A9AAABACADAEAFB0B1B2B3B4B5B6B7B8B9BABBBCBDBEBF"
+    "C0C1C2C3C4C5C6C7C8C9CACBCCCDCECFD0D1D2D3D4D5D6D7D8D9DADBDCDDDEDF"
+    "E0E1E2E3E4E5E6E7E8E9EAEBECEDEEEFF0F1F2F3F4F5F6F7F8F9FAFBFCFDFEFF";
 
+/// <summary>
+/// Writes "#RRGGBB" or "#AARRGGBB" (no terminator) and returns the length, 7 or 9.
+/// Same text as printf("#%06X") / printf("#%08X") of RgbToRgbDec / RgbToArgbDec.
+/// </summary>
+static inline size_t WriteRgbHex_Core(RgbColor clr, unsigned int includeAlpha, char* p)
+{
+    char* d = p;
+    *d++ = '#';
     if (includeAlpha)
-        snprintf(rgbHex, sizeof(rgbHex), "#%08X", (unsigned)RgbToArgbDec(clr));
-    else
-        snprintf(rgbHex, sizeof(rgbHex), "#%06X", (unsigned)RgbToRgbDec(clr));
+    {
+        memcpy(d, &s_hexPairs[clr.alpha * 2], 2);
+        d += 2;
+    }
+    memcpy(d, &s_hexPairs[clr.red * 2], 2);
+    memcpy(d + 2, &s_hexPairs[clr.green * 2], 2);
+    memcpy(d + 4, &s_hexPairs[clr.blue * 2], 2);
+    return (size_t)(d + 6 - p);
+}
 
-    size_t len = strlen(rgbHex) + 1;
-    char* buffer = (char*)malloc((size_t)len);
+CHIZL_COLORS_API char* RgbToRgbHex(RgbColor clr, unsigned int includeAlpha)
+{
+    char* buffer = (char*)malloc(CHIZL_ARGB_HEX_SIZE);
     if (!buffer) return NULL;
 
-#ifdef _WIN32
-    strcpy_s(buffer, len, rgbHex);
-#else
-    memcpy(buffer, rgbHex, len);
-#endif
-
+    buffer[WriteRgbHex_Core(clr, includeAlpha, buffer)] = '\0';
     return buffer;
 }
 
+CHIZL_COLORS_API size_t RgbToRgbHexInto(RgbColor clr, unsigned int includeAlpha, char* buffer, size_t bufferSize)
+{
+    if (buffer == NULL)
+        return 0;
+
+    if (bufferSize < (includeAlpha ? CHIZL_ARGB_HEX_SIZE : CHIZL_RGB_HEX_SIZE))
+    {
+        if (bufferSize > 0)
+            buffer[0] = '\0';
+        return 0;
+    }
+
+    const size_t len = WriteRgbHex_Core(clr, includeAlpha, buffer);
+    buffer[len] = '\0';
+    return len;
+}
+
+CHIZL_COLORS_API size_t RgbToRgbHexBatch(const RgbColor* rgb, char* out, size_t count, unsigned int includeAlpha, char separator)
+{
+    if (rgb == NULL || out == NULL)
+        return 0;
+
+    // Fixed width entries, so entry i is at a known offset and the loop never measures a string.
+    const size_t width = includeAlpha ? CHIZL_ARGB_HEX_SIZE : CHIZL_RGB_HEX_SIZE;
+    char* p = out;
+
+    for (size_t i = 0; i < count; i++, p += width)
+        p[WriteRgbHex_Core(rgb[i], includeAlpha, p)] = separator;
+
+    if (count > 0)
+        p[-1] = '\0';
+    return count;
+}
+
 CHIZL_COLORS_API chizl_color32 RgbToRgbDec(RgbColor clr)
 {
     // Decimal form: (r, g, b)
@@ -43,3 +93,167 @@ CHIZL_COLORS_API chizl_color32 RgbToArgbDec(RgbColor clr)
     return argb;
 }
 
+
+// Hex digit value, or 0x10 for anything that is not a hex digit.  Digits are OR-ed into a flag while
+// the value is built, so a whole color is validated with one test at the end instead of one per char.
+static const unsigned char s_hexValue[256] = {
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+    0x10, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+    0x10, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10
+};
+
+/// <summary>
+/// Parses 3, 4, 6 or 8 hex digits (no '#') into a color.  3 / 6 digits are RGB with alpha 255, 4 / 8 are
+/// ARGB, the same order RgbToRgbHex writes.  Short forms repeat each digit ("F80" = "FF8800").
+/// </summary>
+static inline int ParseHexDigits_Core(const unsigned char* p, size_t digits, RgbColor* out)
+{
+    uint32_t v = 0;
+    unsigned bad = 0;
+
+    if (digits == 6 || digits == 8)
+    {
+        for (size_t i = 0; i < digits; i++)
+        {
+            const unsigned d = s_hexValue[p[i]];
+            bad |= d;
+            v = (v << 4) | d;
+        }
+        if (digits == 6)
+            v |= 0xFF000000u;
+    }
+    else if (digits == 3 || digits == 4)
+    {
+        for (size_t i = 0; i < digits; i++)
+        {
+            const unsigned d = s_hexValue[p[i]];
+            bad |= d;
+            v = (v << 8) | (d * 0x11);
+        }
+        if (digits == 3)
+            v |= 0xFF000000u;
+    }
+    else
+        return 0;
+
+    if (bad & 0x10)
+        return 0;
+
+    out->alpha = (unsigned char)(v >> 24);
+    out->red = (unsigned char)(v >> 16);
+    out->green = (unsigned char)(v >> 8);
+    out->blue = (unsigned char)v;
+    return 1;
+}
+
+CHIZL_COLORS_API int RgbFromHex(const char* hex, RgbColor* out)
+{
+    if (hex == NULL || out == NULL)
+        return 0;
+
+    const unsigned char* p = (const unsigned char*)hex;
+    if (*p == '#')
+        p++;
+
+    // Longest valid form is 8 digits, never scan further than 9 chars.
+    size_t digits = 0;
+    while (digits < 9 && p[digits] != '\0')
+        digits++;
+
+    return ParseHexDigits_Core(p, digits, out);
+}
+
+CHIZL_COLORS_API RgbColor RgbFromRgbDec(chizl_color32 rgb)
+{
+    RgbColor clr = { 255, (unsigned char)(rgb >> 16), (unsigned char)(rgb >> 8), (unsigned char)rgb };
+    return clr;
+}
+
+CHIZL_COLORS_API RgbColor RgbFromArgbDec(chizl_color32 argb)
+{
+    RgbColor clr = { (unsigned char)(argb >> 24), (unsigned char)(argb >> 16), (unsigned char)(argb >> 8), (unsigned char)argb };
+    return clr;
+}
+
+CHIZL_COLORS_API int RgbFromDecString(const char* text, unsigned int includeAlpha, RgbColor* out)
+{
+    if (text == NULL || out == NULL)
+        return 0;
+
+    const unsigned char* p = (const unsigned char*)text;
+    const uint64_t max = includeAlpha ? 0xFFFFFFFFull : 0xFFFFFFull;
+    uint64_t v = 0;
+    size_t digits = 0;
+
+    // At most 10 digits are read, so v cannot overflow before the range check.
+    for (; digits <= 10 && (unsigned)(p[digits] - '0') < 10; digits++)
+        v = (v * 10) + (p[digits] - '0');
+
+    if (digits == 0 || digits > 10 || p[digits] != '\0' || v > max)
+        return 0;
+
+    *out = includeAlpha ? RgbFromArgbDec((chizl_color32)v) : RgbFromRgbDec((chizl_color32)v);
+    return 1;
+}
+
+/// <summary>
+/// List separators for RgbFromHexBatch: comma, semicolon and whitespace (any run counts as one).
+/// </summary>
+static inline int IsHexListSeparator(unsigned char c)
+{
+    return c == ',' || c == ';' || c == ' ' || c == '\n' || c == '\r' || c == '\t';
+}
+
+CHIZL_COLORS_API size_t RgbFromHexBatch(const char* text, size_t length, RgbColor* out, size_t maxCount, size_t* consumed)
+{
+    if (text == NULL || out == NULL)
+    {
+        if (consumed != NULL)
+            *consumed = 0;
+        return 0;
+    }
+
+    const unsigned char* p = (const unsigned char*)text;
+    size_t pos = 0;
+    size_t count = 0;
+
+    for (;;)
+    {
+        while (pos < length && IsHexListSeparator(p[pos]))
+            pos++;
+        if (pos >= length || count >= maxCount)
+            break;
+
+        // Token runs to the next separator, a bad token stops the parse at its first char.
+        const size_t start = pos;
+        if (p[pos] == '#')
+            pos++;
+        const size_t digitsAt = pos;
+        while (pos < length && !IsHexListSeparator(p[pos]))
+            pos++;
+
+        if (!ParseHexDigits_Core(p + digitsAt, pos - digitsAt, &out[count]))
+        {
+            pos = start;
+            break;
+        }
+        count++;
+    }
+
+    if (consumed != NULL)
+        *consumed = pos;
+    return count;
+}
@@ -13,9 +13,20 @@ extern "C" {
 #include "import_exports.h"
 #include "chizl_colors_types.h"
 #include <stdint.h>             // For uint32_t type
+#include <stddef.h>             // For size_t
 
 typedef uint32_t chizl_color32;
 
+/// <summary>
+/// Buffer size, including the terminating null, for "#RRGGBB" from RgbToRgbHexInto.
+/// </summary>
+#define CHIZL_RGB_HEX_SIZE 8
+
+/// <summary>
+/// Buffer size, including the terminating null, for "#AARRGGBB" from RgbToRgbHexInto.
+/// </summary>
+#define CHIZL_ARGB_HEX_SIZE 10
+
 /// <summary>
 /// Converts an RGB color to its hexadecimal string representation.
 /// </summary>
@@ -24,6 +35,31 @@ typedef uint32_t chizl_color32;
 /// <returns>A pointer to a null-terminated string containing the hexadecimal representation of the RGB color. The caller is responsible for managing the memory of the returned string.</returns>
 CHIZL_COLORS_API char* RgbToRgbHex(RgbColor clr, unsigned int includeAlpha);
 
+/// <summary>
+/// RgbToRgbHex into a caller supplied buffer, nothing is allocated and nothing needs to be freed.<br/>
+/// Writes "#RRGGBB" or "#AARRGGBB" (uppercase) plus a terminating null.
+/// </summary>
+/// <param name="clr">The RGB color to convert.</param>
+/// <param name="includeAlpha">Non-zero for "#AARRGGBB", zero for "#RRGGBB".</param>
+/// <param name="buffer">Receives the string.</param>
+/// <param name="bufferSize">Size of buffer in chars, at least CHIZL_RGB_HEX_SIZE (CHIZL_ARGB_HEX_SIZE with alpha).</param>
+/// <returns>The string length (7 or 9), 0 if buffer is NULL or too small (buffer is then set to "" when bufferSize allows).</returns>
+CHIZL_COLORS_API size_t RgbToRgbHexInto(RgbColor clr, unsigned int includeAlpha, char* buffer, size_t bufferSize);
+
+/// <summary>
+/// Writes the hex strings of an array of colors into one contiguous buffer, at a fixed width per color:
+/// color i starts at out + i * CHIZL_RGB_HEX_SIZE (CHIZL_ARGB_HEX_SIZE with alpha).<br/>
+/// Each string is followed by 'separator', except the last which is followed by a null.  A separator of
+/// '\0' gives 'count' separate C strings, ',' or '\n' gives one string ready for a CSS / JSON / text list.
+/// </summary>
+/// <param name="rgb">Pointer to the colors to convert.</param>
+/// <param name="out">Receives the strings, count * CHIZL_RGB_HEX_SIZE (or CHIZL_ARGB_HEX_SIZE) chars.</param>
+/// <param name="count">Number of colors.</param>
+/// <param name="includeAlpha">Non-zero for "#AARRGGBB", zero for "#RRGGBB".</param>
+/// <param name="separator">Character written after every string but the last.</param>
+/// <returns>The number of colors written, 0 if either pointer is NULL.</returns>
+CHIZL_COLORS_API size_t RgbToRgbHexBatch(const RgbColor* rgb, char* out, size_t count, unsigned int includeAlpha, char separator);
+
 /// <summary>
 /// Converts an RGB color to a 32-bit RGBA color value in decimal format.
 /// </summary>
@@ -38,6 +74,55 @@ CHIZL_COLORS_API chizl_color32 RgbToRgbDec(RgbColor clr);
 /// <returns>A 32-bit ARGB color value with the alpha channel set to fully opaque.</returns>
 CHIZL_COLORS_API chizl_color32 RgbToArgbDec(RgbColor rgb);
 
+/// <summary>
+/// Parses a hex color string, the reverse of RgbToRgbHex.  Accepts 3, 4, 6 or 8 hex digits, upper or
+/// lower case, with or without a leading '#':<br/>
+/// "RGB" / "RRGGBB" (alpha 255) and "ARGB" / "AARRGGBB".  Short forms repeat each digit, "#F80" = "#FF8800".<br/>
+/// Note the alpha comes first, as RgbToRgbHex writes it, not last as in CSS "#RRGGBBAA".
+/// </summary>
+/// <param name="hex">Null terminated string to parse.</param>
+/// <param name="out">Receives the color.</param>
+/// <returns>1 on success, 0 if either pointer is NULL or the string is not one of the forms above (out is unchanged).</returns>
+CHIZL_COLORS_API int RgbFromHex(const char* hex, RgbColor* out);
+
+/// <summary>
+/// Unpacks a 0x00RRGGBB value, the reverse of RgbToRgbDec.  Alpha is set to 255.
+/// </summary>
+/// <param name="rgb">Packed color, the top byte is ignored.</param>
+/// <returns>The RGB color.</returns>
+CHIZL_COLORS_API RgbColor RgbFromRgbDec(chizl_color32 rgb);
+
+/// <summary>
+/// Unpacks a 0xAARRGGBB value, the reverse of RgbToArgbDec.
+/// </summary>
+/// <param name="argb">Packed color.</param>
+/// <returns>The RGB color including alpha.</returns>
+CHIZL_COLORS_API RgbColor RgbFromArgbDec(chizl_color32 argb);
+
+/// <summary>
+/// Parses a packed color written in decimal (e.g. "16711680" for red), the text form of RgbToRgbDec /
+/// RgbToArgbDec.  Digits only, no sign or whitespace.
+/// </summary>
+/// <param name="text">Null terminated string to parse.</param>
+/// <param name="includeAlpha">Non-zero for a 0xAARRGGBB value (up to 4294967295), zero for 0xRRGGBB (up to 16777215, alpha 255).</param>
+/// <param name="out">Receives the color.</param>
+/// <returns>1 on success, 0 if either pointer is NULL, the text is not a number or it is out of range (out is unchanged).</returns>
+CHIZL_COLORS_API int RgbFromDecString(const char* text, unsigned int includeAlpha, RgbColor* out);
+
+/// <summary>
+/// Parses a list of hex colors (the RgbFromHex forms) in one pass, e.g. a palette file or the output of
+/// RgbToRgbHexBatch.  Entries are separated by any run of ',', ';', spaces, tabs or line breaks.<br/>
+/// Stops at the end of the text, after maxCount colors, or at the first entry that is not a valid color.
+/// </summary>
+/// <param name="text">Text to parse, does not need to be null terminated.</param>
+/// <param name="length">Number of chars in text.</param>
+/// <param name="out">Receives the colors.</param>
+/// <param name="maxCount">Capacity of out.</param>
+/// <param name="consumed">Optional, receives the offset parsing stopped at: length when the whole text was
+/// parsed, otherwise the start of the bad entry (or of the first entry that did not fit).</param>
+/// <returns>The number of colors parsed, 0 if text or out is NULL.</returns>
+CHIZL_COLORS_API size_t RgbFromHexBatch(const char* text, size_t length, RgbColor* out, size_t maxCount, size_t* consumed);
+
 // --- End of "extern C" block ---
 #ifdef __cplusplus
 }
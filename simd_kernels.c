@@ -0,0 +1,631 @@
+// simd_kernels.c
+#include "simd_kernels.h"
+#include "cie_common.h"         // For RgbToXyz_Core, XyzToLab_White (scalar tail)
+#include "oklab_core.h"         // For RgbToOkLab_Core (scalar tail)
+#include "chizl_once.h"
+#include "common.h"             // For stridedAt
+
+// Vectorized RGB -> XYZ -> Lab.
+//
+// The sRGB table lookup, matrix multiply, white point divide and the Lab f(t) toe are done
+// with the same operations, in the same order, as the scalar code (mul + add, no FMA), so
+// X, Y, Z and every linear part of the Lab math are bit-identical to RgbToLab.
+//
+// The only approximation is the cube root.  cbrt_sse() / cbrt_avx2() start from the classic
+// exponent/3 bit estimate (done in single precision, rel. error < 3.3%) and refine it with
+// three Halley iterations in double precision (error e -> ~e^3 per step).
+// ULP budget: over the Lab input range (6/29)^3..~1.1 the result is within 1 ULP of the
+// correctly rounded cube root.  CRT cbrt() implementations are not correctly rounded either
+// (glibc measured up to 4 ULP), so the kernel can differ from XyzToLab_White by a few ULP of
+// f(t), which is at most 1e-12 in L, a and b for every 8-bit RGB.
+//
+// RGB -> OKLab uses the same table lookup and cube root.  It has no toe, the only special case is
+// black: LMS is never negative for 8-bit input, and exact 0 lanes are masked to 0 after the root.
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+  #define CHIZL_SIMD_X86 1
+  #include <immintrin.h>        // For SSE4.1 / AVX2 intrinsics
+  #if defined(_MSC_VER) && !defined(__clang__)
+    #include <intrin.h>         // For __cpuid, __cpuidex, _xgetbv
+    // MSVC allows any intrinsic in any function, no per function target needed.
+    #define CHIZL_TARGET_SSE41
+    #define CHIZL_TARGET_AVX2
+  #else
+    #define CHIZL_TARGET_SSE41 __attribute__((target("sse4.1")))
+    #define CHIZL_TARGET_AVX2 __attribute__((target("avx2")))
+  #endif
+#else
+  #define CHIZL_SIMD_X86 0
+#endif
+
+static SimdLevel s_detectedLevel = SIMD_NONE;
+static volatile SimdLevel s_maxLevel = SIMD_AVX2;
+static ChizlOnce s_detectOnce = CHIZL_ONCE_INIT;
+
+static void DetectSimdLevel(void)
+{
+#if CHIZL_SIMD_X86
+  #if defined(_MSC_VER) && !defined(__clang__)
+    int info[4] = { 0 };
+    __cpuid(info, 0);
+    const int maxLeaf = info[0];
+
+    __cpuid(info, 1);
+    const int hasSse41 = (info[2] & (1 << 19)) != 0;
+    const int hasOsxsave = (info[2] & (1 << 27)) != 0;
+    const int hasAvx = (info[2] & (1 << 28)) != 0;
+
+    // AVX state (XMM + YMM) must also be enabled by the OS, not just supported by the CPU.
+    int hasAvx2 = 0;
+    if (maxLeaf >= 7 && hasOsxsave && hasAvx && (_xgetbv(0) & 0x6) == 0x6)
+    {
+        __cpuidex(info, 7, 0);
+        hasAvx2 = (info[1] & (1 << 5)) != 0;
+    }
+  #else
+    __builtin_cpu_init();
+    const int hasSse41 = __builtin_cpu_supports("sse4.1");
+    const int hasAvx2 = __builtin_cpu_supports("avx2");
+  #endif
+
+    if (hasAvx2)
+        s_detectedLevel = SIMD_AVX2;
+    else if (hasSse41)
+        s_detectedLevel = SIMD_SSE41;
+#endif
+}
+
+SimdLevel SimdActiveLevel(void)
+{
+    ChizlRunOnce(&s_detectOnce, DetectSimdLevel);
+    const SimdLevel cap = s_maxLevel;
+    return (s_detectedLevel < cap) ? s_detectedLevel : cap;
+}
+
+CHIZL_COLORS_API SimdLevel ChizlGetSimdLevel(void)
+{
+    return SimdActiveLevel();
+}
+
+CHIZL_COLORS_API SimdLevel ChizlSetSimdLevel(SimdLevel maxLevel)
+{
+    s_maxLevel = (maxLevel < SIMD_NONE) ? SIMD_NONE : ((maxLevel > SIMD_AVX2) ? SIMD_AVX2 : maxLevel);
+    return SimdActiveLevel();
+}
+
+// Scalar path, also used for the tail of the vector loops.
+static void RgbToLabScalar(const RgbColor* rgb, LabSpace* lab, size_t count, size_t stride, const double* linear, WhitePoint wp)
+{
+    for (size_t i = 0; i < count; i++)
+        *(LabSpace*)stridedAt(lab, i, stride, sizeof(LabSpace)) = XyzToLab_White(RgbToXyz_Core(rgb[i], linear), wp);
+}
+
+// Writes lanes of separate L, a, b registers back out as LabSpace structs.
+static inline void StoreLab(LabSpace* lab, size_t index, size_t stride, const double* l, const double* a, const double* b, int lanes)
+{
+    for (int k = 0; k < lanes; k++)
+    {
+        LabSpace* dst = (LabSpace*)stridedAt(lab, index + k, stride, sizeof(LabSpace));
+        dst->l = l[k];
+        dst->a = a[k];
+        dst->b = b[k];
+    }
+}
+
+static void RgbToOkLabScalar(const RgbColor* rgb, OkLabSpace* lab, size_t count, size_t stride, const double* linear)
+{
+    for (size_t i = 0; i < count; i++)
+        *(OkLabSpace*)stridedAt(lab, i, stride, sizeof(OkLabSpace)) = RgbToOkLab_Core(rgb[i], linear);
+}
+
+static inline void StoreOkLab(OkLabSpace* lab, size_t index, size_t stride, const double* l, const double* a, const double* b, int lanes)
+{
+    for (int k = 0; k < lanes; k++)
+    {
+        OkLabSpace* dst = (OkLabSpace*)stridedAt(lab, index + k, stride, sizeof(OkLabSpace));
+        dst->l = l[k];
+        dst->a = a[k];
+        dst->b = b[k];
+    }
+}
+
+static void RgbPlanarToLabScalar(const unsigned char* r, const unsigned char* g, const unsigned char* b,
+    double* l, double* a, double* bb, size_t count, const double* linear, WhitePoint wp)
+{
+    for (size_t i = 0; i < count; i++)
+    {
+        const RgbColor rgb = { 255, r[i], g[i], b[i] };
+        const LabSpace lab = XyzToLab_White(RgbToXyz_Core(rgb, linear), wp);
+        l[i] = lab.l;
+        a[i] = lab.a;
+        bb[i] = lab.b;
+    }
+}
+
+static void RgbDeinterleaveScalar(const RgbColor* rgb, unsigned char* r, unsigned char* g, unsigned char* b, unsigned char* a, size_t count)
+{
+    for (size_t i = 0; i < count; i++)
+    {
+        r[i] = rgb[i].red;
+        g[i] = rgb[i].green;
+        b[i] = rgb[i].blue;
+        if (a != NULL)
+            a[i] = rgb[i].alpha;
+    }
+}
+
+static void RgbInterleaveScalar(const unsigned char* r, const unsigned char* g, const unsigned char* b, const unsigned char* a, RgbColor* rgb, size_t count)
+{
+    for (size_t i = 0; i < count; i++)
+    {
+        rgb[i].alpha = (a != NULL) ? a[i] : 255;
+        rgb[i].red = r[i];
+        rgb[i].green = g[i];
+        rgb[i].blue = b[i];
+    }
+}
+
+#if CHIZL_SIMD_X86
+
+// FreeBSD cbrtf B1: (127 - 127.0/3 - 0.03306235651) * 2^23, the exponent/3 bit estimate.
+#define CBRT_MAGIC 709958130
+
+// Initial cube root estimate for up to 4 positive floats: bits / 3 + B1.
+// The divide is done in float, which loses low bits of the integer but only perturbs the guess.
+CHIZL_TARGET_SSE41 static inline __m128 cbrt_guess_ps(__m128 f)
+{
+    const __m128i bits = _mm_castps_si128(f);
+    const __m128 third = _mm_set1_ps(1.0f / 3.0f);
+    __m128i div3 = _mm_cvttps_epi32(_mm_mul_ps(_mm_cvtepi32_ps(bits), third));
+    return _mm_castsi128_ps(_mm_add_epi32(div3, _mm_set1_epi32(CBRT_MAGIC)));
+}
+
+// ---------------------------------------------------------------- SSE4.1, 2 doubles per register
+
+CHIZL_TARGET_SSE41 static inline __m128d cbrt_sse(__m128d x)
+{
+    __m128d y = _mm_cvtps_pd(cbrt_guess_ps(_mm_cvtpd_ps(x)));
+    const __m128d two = _mm_set1_pd(2.0);
+
+    // Halley: y = y * (y^3 + 2x) / (2y^3 + x)
+    for (int i = 0; i < 2; i++)
+    {
+        __m128d y3 = _mm_mul_pd(_mm_mul_pd(y, y), y);
+        __m128d num = _mm_add_pd(y3, _mm_mul_pd(two, x));
+        __m128d den = _mm_add_pd(_mm_mul_pd(two, y3), x);
+        y = _mm_mul_pd(y, _mm_div_pd(num, den));
+    }
+
+    // Last Halley step in correction form, y + y * (x - y^3) / (2y^3 + x), so the final
+    // rounding only touches the small correction term.
+    __m128d y3 = _mm_mul_pd(_mm_mul_pd(y, y), y);
+    __m128d den = _mm_add_pd(_mm_mul_pd(two, y3), x);
+    return _mm_add_pd(y, _mm_mul_pd(y, _mm_div_pd(_mm_sub_pd(x, y3), den)));
+}
+
+CHIZL_TARGET_SSE41 static inline __m128d lab_f_sse(__m128d t)
+{
+    const double delta = 6.0 / 29.0;
+    const double delta2 = delta * delta;
+    const double delta3 = delta2 * delta;
+    const double inv_3delta2 = 1.0 / (3.0 * delta2);
+
+    t = _mm_max_pd(t, _mm_setzero_pd());
+    const __m128d d3 = _mm_set1_pd(delta3);
+    const __m128d useCbrt = _mm_cmpge_pd(t, d3);
+
+    // Clamp the cube root input so toe lanes never feed 0 to the estimate; they are blended away.
+    const __m128d root = cbrt_sse(_mm_max_pd(t, d3));
+    const __m128d toe = _mm_add_pd(_mm_mul_pd(t, _mm_set1_pd(inv_3delta2)), _mm_set1_pd(4.0 / 29.0));
+    return _mm_blendv_pd(toe, root, useCbrt);
+}
+
+// Linear RGB (2 lanes) -> XYZ -> Lab, stored to l / a / b (2 doubles each).
+CHIZL_TARGET_SSE41 static inline void LinearToLabSse41(__m128d r, __m128d g, __m128d b, WhitePoint wp, double* l, double* a, double* bb)
+{
+    const __m128d hundred = _mm_set1_pd(100.0);
+    const __m128d x = _mm_mul_pd(_mm_add_pd(_mm_add_pd(
+        _mm_mul_pd(r, _mm_set1_pd(0.4124564)), _mm_mul_pd(g, _mm_set1_pd(0.3575761))), _mm_mul_pd(b, _mm_set1_pd(0.1804375))), hundred);
+    const __m128d y = _mm_mul_pd(_mm_add_pd(_mm_add_pd(
+        _mm_mul_pd(r, _mm_set1_pd(0.2126729)), _mm_mul_pd(g, _mm_set1_pd(0.7151522))), _mm_mul_pd(b, _mm_set1_pd(0.0721750))), hundred);
+    const __m128d z = _mm_mul_pd(_mm_add_pd(_mm_add_pd(
+        _mm_mul_pd(r, _mm_set1_pd(0.0193339)), _mm_mul_pd(g, _mm_set1_pd(0.1191920))), _mm_mul_pd(b, _mm_set1_pd(0.9503041))), hundred);
+
+    const __m128d fx = lab_f_sse(_mm_div_pd(x, _mm_set1_pd(wp.x)));
+    const __m128d fy = lab_f_sse(_mm_div_pd(y, _mm_set1_pd(wp.y)));
+    const __m128d fz = lab_f_sse(_mm_div_pd(z, _mm_set1_pd(wp.z)));
+
+    _mm_storeu_pd(l, _mm_sub_pd(_mm_mul_pd(_mm_set1_pd(116.0), fy), _mm_set1_pd(16.0)));
+    _mm_storeu_pd(a, _mm_mul_pd(_mm_set1_pd(500.0), _mm_sub_pd(fx, fy)));
+    _mm_storeu_pd(bb, _mm_mul_pd(_mm_set1_pd(200.0), _mm_sub_pd(fy, fz)));
+}
+
+CHIZL_TARGET_SSE41 static void RgbToLabSse41(const RgbColor* rgb, LabSpace* lab, size_t count, size_t stride, const double* linear, WhitePoint wp)
+{
+    size_t i = 0;
+    for (; i + 2 <= count; i += 2)
+    {
+        const __m128d r = _mm_set_pd(linear[rgb[i + 1].red], linear[rgb[i].red]);
+        const __m128d g = _mm_set_pd(linear[rgb[i + 1].green], linear[rgb[i].green]);
+        const __m128d b = _mm_set_pd(linear[rgb[i + 1].blue], linear[rgb[i].blue]);
+
+        double l[2], a[2], bb[2];
+        LinearToLabSse41(r, g, b, wp, l, a, bb);
+        StoreLab(lab, i, stride, l, a, bb, 2);
+    }
+
+    if (i < count)
+        RgbToLabScalar(rgb + i, (LabSpace*)stridedAt(lab, i, stride, sizeof(LabSpace)), count - i, stride, linear, wp);
+}
+
+CHIZL_TARGET_SSE41 static void RgbPlanarToLabSse41(const unsigned char* r, const unsigned char* g, const unsigned char* b,
+    double* l, double* a, double* bb, size_t count, const double* linear, WhitePoint wp)
+{
+    // Planar output: each lane group goes straight to its plane, no per pixel scatter.
+    size_t i = 0;
+    for (; i + 2 <= count; i += 2)
+    {
+        LinearToLabSse41(
+            _mm_set_pd(linear[r[i + 1]], linear[r[i]]),
+            _mm_set_pd(linear[g[i + 1]], linear[g[i]]),
+            _mm_set_pd(linear[b[i + 1]], linear[b[i]]),
+            wp, l + i, a + i, bb + i);
+    }
+
+    if (i < count)
+        RgbPlanarToLabScalar(r + i, g + i, b + i, l + i, a + i, bb + i, count - i, linear, wp);
+}
+
+// Linear RGB (2 lanes) -> LMS -> OKLab, stored to l / a / b (2 doubles each).  Same operation order as LinearRgbToOkLab_Core.
+CHIZL_TARGET_SSE41 static inline void LinearToOkLabSse41(__m128d r, __m128d g, __m128d b, double* l, double* a, double* bb)
+{
+    const __m128d zero = _mm_setzero_pd();
+    const __m128d lms0 = _mm_add_pd(_mm_add_pd(
+        _mm_mul_pd(r, _mm_set1_pd(0.4122214708)), _mm_mul_pd(g, _mm_set1_pd(0.5363325363))), _mm_mul_pd(b, _mm_set1_pd(0.0514459929)));
+    const __m128d lms1 = _mm_add_pd(_mm_add_pd(
+        _mm_mul_pd(r, _mm_set1_pd(0.2119034982)), _mm_mul_pd(g, _mm_set1_pd(0.6806995451))), _mm_mul_pd(b, _mm_set1_pd(0.1073969566)));
+    const __m128d lms2 = _mm_add_pd(_mm_add_pd(
+        _mm_mul_pd(r, _mm_set1_pd(0.0883024619)), _mm_mul_pd(g, _mm_set1_pd(0.2817188376))), _mm_mul_pd(b, _mm_set1_pd(0.6299787005)));
+
+    const __m128d lc = _mm_and_pd(cbrt_sse(lms0), _mm_cmpgt_pd(lms0, zero));
+    const __m128d mc = _mm_and_pd(cbrt_sse(lms1), _mm_cmpgt_pd(lms1, zero));
+    const __m128d sc = _mm_and_pd(cbrt_sse(lms2), _mm_cmpgt_pd(lms2, zero));
+
+    _mm_storeu_pd(l, _mm_sub_pd(_mm_add_pd(
+        _mm_mul_pd(_mm_set1_pd(0.2104542553), lc), _mm_mul_pd(_mm_set1_pd(0.7936177850), mc)), _mm_mul_pd(_mm_set1_pd(0.0040720468), sc)));
+    _mm_storeu_pd(a, _mm_add_pd(_mm_sub_pd(
+        _mm_mul_pd(_mm_set1_pd(1.9779984951), lc), _mm_mul_pd(_mm_set1_pd(2.4285922050), mc)), _mm_mul_pd(_mm_set1_pd(0.4505937099), sc)));
+    _mm_storeu_pd(bb, _mm_sub_pd(_mm_add_pd(
+        _mm_mul_pd(_mm_set1_pd(0.0259040371), lc), _mm_mul_pd(_mm_set1_pd(0.7827717662), mc)), _mm_mul_pd(_mm_set1_pd(0.8086757660), sc)));
+}
+
+CHIZL_TARGET_SSE41 static void RgbToOkLabSse41(const RgbColor* rgb, OkLabSpace* lab, size_t count, size_t stride, const double* linear)
+{
+    size_t i = 0;
+    for (; i + 2 <= count; i += 2)
+    {
+        double l[2], a[2], bb[2];
+        LinearToOkLabSse41(
+            _mm_set_pd(linear[rgb[i + 1].red], linear[rgb[i].red]),
+            _mm_set_pd(linear[rgb[i + 1].green], linear[rgb[i].green]),
+            _mm_set_pd(linear[rgb[i + 1].blue], linear[rgb[i].blue]),
+            l, a, bb);
+        StoreOkLab(lab, i, stride, l, a, bb, 2);
+    }
+
+    if (i < count)
+        RgbToOkLabScalar(rgb + i, (OkLabSpace*)stridedAt(lab, i, stride, sizeof(OkLabSpace)), count - i, stride, linear);
+}
+
+// 16 pixels per iteration.  RgbColor bytes are alpha, red, green, blue: one shuffle groups each
+// register's 4 pixels by channel, then a 4x4 dword transpose gathers each channel into one register.
+CHIZL_TARGET_SSE41 static void RgbDeinterleaveSse41(const RgbColor* rgb, unsigned char* r, unsigned char* g, unsigned char* b, unsigned char* a, size_t count)
+{
+    const __m128i byChannel = _mm_setr_epi8(0, 4, 8, 12, 1, 5, 9, 13, 2, 6, 10, 14, 3, 7, 11, 15);
+
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16)
+    {
+        const __m128i v0 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(rgb + i)), byChannel);
+        const __m128i v1 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(rgb + i + 4)), byChannel);
+        const __m128i v2 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(rgb + i + 8)), byChannel);
+        const __m128i v3 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(rgb + i + 12)), byChannel);
+
+        const __m128i ar01 = _mm_unpacklo_epi32(v0, v1), gb01 = _mm_unpackhi_epi32(v0, v1);
+        const __m128i ar23 = _mm_unpacklo_epi32(v2, v3), gb23 = _mm_unpackhi_epi32(v2, v3);
+
+        _mm_storeu_si128((__m128i*)(r + i), _mm_unpackhi_epi64(ar01, ar23));
+        _mm_storeu_si128((__m128i*)(g + i), _mm_unpacklo_epi64(gb01, gb23));
+        _mm_storeu_si128((__m128i*)(b + i), _mm_unpackhi_epi64(gb01, gb23));
+        if (a != NULL)
+            _mm_storeu_si128((__m128i*)(a + i), _mm_unpacklo_epi64(ar01, ar23));
+    }
+
+    if (i < count)
+        RgbDeinterleaveScalar(rgb + i, r + i, g + i, b + i, (a != NULL) ? a + i : NULL, count - i);
+}
+
+// 16 pixels per iteration, the reverse of RgbDeinterleaveSse41 with byte / word unpacks.
+CHIZL_TARGET_SSE41 static void RgbInterleaveSse41(const unsigned char* r, const unsigned char* g, const unsigned char* b, const unsigned char* a, RgbColor* rgb, size_t count)
+{
+    const __m128i opaque = _mm_set1_epi8((char)0xFF);
+
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16)
+    {
+        const __m128i va = (a != NULL) ? _mm_loadu_si128((const __m128i*)(a + i)) : opaque;
+        const __m128i vr = _mm_loadu_si128((const __m128i*)(r + i));
+        const __m128i vg = _mm_loadu_si128((const __m128i*)(g + i));
+        const __m128i vb = _mm_loadu_si128((const __m128i*)(b + i));
+
+        const __m128i arLo = _mm_unpacklo_epi8(va, vr), arHi = _mm_unpackhi_epi8(va, vr);
+        const __m128i gbLo = _mm_unpacklo_epi8(vg, vb), gbHi = _mm_unpackhi_epi8(vg, vb);
+
+        _mm_storeu_si128((__m128i*)(rgb + i), _mm_unpacklo_epi16(arLo, gbLo));
+        _mm_storeu_si128((__m128i*)(rgb + i + 4), _mm_unpackhi_epi16(arLo, gbLo));
+        _mm_storeu_si128((__m128i*)(rgb + i + 8), _mm_unpacklo_epi16(arHi, gbHi));
+        _mm_storeu_si128((__m128i*)(rgb + i + 12), _mm_unpackhi_epi16(arHi, gbHi));
+    }
+
+    if (i < count)
+        RgbInterleaveScalar(r + i, g + i, b + i, (a != NULL) ? a + i : NULL, rgb + i, count - i);
+}
+
+// ---------------------------------------------------------------- AVX2, 4 doubles per register
+
+CHIZL_TARGET_AVX2 static inline __m256d cbrt_avx2(__m256d x)
+{
+    __m256d y = _mm256_cvtps_pd(cbrt_guess_ps(_mm256_cvtpd_ps(x)));
+    const __m256d two = _mm256_set1_pd(2.0);
+
+    // Halley: y = y * (y^3 + 2x) / (2y^3 + x)
+    for (int i = 0; i < 2; i++)
+    {
+        __m256d y3 = _mm256_mul_pd(_mm256_mul_pd(y, y), y);
+        __m256d num = _mm256_add_pd(y3, _mm256_mul_pd(two, x));
+        __m256d den = _mm256_add_pd(_mm256_mul_pd(two, y3), x);
+        y = _mm256_mul_pd(y, _mm256_div_pd(num, den));
+    }
+
+    // Last Halley step in correction form, y + y * (x - y^3) / (2y^3 + x), so the final
+    // rounding only touches the small correction term.
+    __m256d y3 = _mm256_mul_pd(_mm256_mul_pd(y, y), y);
+    __m256d den = _mm256_add_pd(_mm256_mul_pd(two, y3), x);
+    return _mm256_add_pd(y, _mm256_mul_pd(y, _mm256_div_pd(_mm256_sub_pd(x, y3), den)));
+}
+
+CHIZL_TARGET_AVX2 static inline __m256d lab_f_avx2(__m256d t)
+{
+    const double delta = 6.0 / 29.0;
+    const double delta2 = delta * delta;
+    const double delta3 = delta2 * delta;
+    const double inv_3delta2 = 1.0 / (3.0 * delta2);
+
+    t = _mm256_max_pd(t, _mm256_setzero_pd());
+    const __m256d d3 = _mm256_set1_pd(delta3);
+    const __m256d useCbrt = _mm256_cmp_pd(t, d3, _CMP_GE_OQ);
+
+    const __m256d root = cbrt_avx2(_mm256_max_pd(t, d3));
+    const __m256d toe = _mm256_add_pd(_mm256_mul_pd(t, _mm256_set1_pd(inv_3delta2)), _mm256_set1_pd(4.0 / 29.0));
+    return _mm256_blendv_pd(toe, root, useCbrt);
+}
+
+// Linear RGB (4 lanes) -> XYZ -> Lab, stored to l / a / b (4 doubles each).
+CHIZL_TARGET_AVX2 static inline void LinearToLabAvx2(__m256d r, __m256d g, __m256d b, __m256d wx, __m256d wy, __m256d wz, double* l, double* a, double* bb)
+{
+    const __m256d hundred = _mm256_set1_pd(100.0);
+    const __m256d x = _mm256_mul_pd(_mm256_add_pd(_mm256_add_pd(
+        _mm256_mul_pd(r, _mm256_set1_pd(0.4124564)), _mm256_mul_pd(g, _mm256_set1_pd(0.3575761))), _mm256_mul_pd(b, _mm256_set1_pd(0.1804375))), hundred);
+    const __m256d y = _mm256_mul_pd(_mm256_add_pd(_mm256_add_pd(
+        _mm256_mul_pd(r, _mm256_set1_pd(0.2126729)), _mm256_mul_pd(g, _mm256_set1_pd(0.7151522))), _mm256_mul_pd(b, _mm256_set1_pd(0.0721750))), hundred);
+    const __m256d z = _mm256_mul_pd(_mm256_add_pd(_mm256_add_pd(
+        _mm256_mul_pd(r, _mm256_set1_pd(0.0193339)), _mm256_mul_pd(g, _mm256_set1_pd(0.1191920))), _mm256_mul_pd(b, _mm256_set1_pd(0.9503041))), hundred);
+
+    const __m256d fx = lab_f_avx2(_mm256_div_pd(x, wx));
+    const __m256d fy = lab_f_avx2(_mm256_div_pd(y, wy));
+    const __m256d fz = lab_f_avx2(_mm256_div_pd(z, wz));
+
+    _mm256_storeu_pd(l, _mm256_sub_pd(_mm256_mul_pd(_mm256_set1_pd(116.0), fy), _mm256_set1_pd(16.0)));
+    _mm256_storeu_pd(a, _mm256_mul_pd(_mm256_set1_pd(500.0), _mm256_sub_pd(fx, fy)));
+    _mm256_storeu_pd(bb, _mm256_mul_pd(_mm256_set1_pd(200.0), _mm256_sub_pd(fy, fz)));
+}
+
+// Converts 4 pixels starting at rgb[0] and writes them to lab element 'index'.
+CHIZL_TARGET_AVX2 static inline void RgbToLabAvx2_4(const RgbColor* rgb, LabSpace* lab, size_t index, size_t stride, const double* linear, __m256d wx, __m256d wy, __m256d wz)
+{
+    const __m256d r = _mm256_set_pd(linear[rgb[3].red], linear[rgb[2].red], linear[rgb[1].red], linear[rgb[0].red]);
+    const __m256d g = _mm256_set_pd(linear[rgb[3].green], linear[rgb[2].green], linear[rgb[1].green], linear[rgb[0].green]);
+    const __m256d b = _mm256_set_pd(linear[rgb[3].blue], linear[rgb[2].blue], linear[rgb[1].blue], linear[rgb[0].blue]);
+
+    double l[4], a[4], bb[4];
+    LinearToLabAvx2(r, g, b, wx, wy, wz, l, a, bb);
+    StoreLab(lab, index, stride, l, a, bb, 4);
+}
+
+CHIZL_TARGET_AVX2 static void RgbToLabAvx2(const RgbColor* rgb, LabSpace* lab, size_t count, size_t stride, const double* linear, WhitePoint wp)
+{
+    const __m256d wx = _mm256_set1_pd(wp.x), wy = _mm256_set1_pd(wp.y), wz = _mm256_set1_pd(wp.z);
+
+    // 8 pixels per iteration, two independent 4 lane chains to hide the divide latency.
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        RgbToLabAvx2_4(rgb + i, lab, i, stride, linear, wx, wy, wz);
+        RgbToLabAvx2_4(rgb + i + 4, lab, i + 4, stride, linear, wx, wy, wz);
+    }
+    if (i + 4 <= count)
+    {
+        RgbToLabAvx2_4(rgb + i, lab, i, stride, linear, wx, wy, wz);
+        i += 4;
+    }
+
+    if (i < count)
+        RgbToLabScalar(rgb + i, (LabSpace*)stridedAt(lab, i, stride, sizeof(LabSpace)), count - i, stride, linear, wp);
+}
+
+CHIZL_TARGET_AVX2 static inline void RgbPlanarToLabAvx2_4(const unsigned char* r, const unsigned char* g, const unsigned char* b,
+    double* l, double* a, double* bb, const double* linear, __m256d wx, __m256d wy, __m256d wz)
+{
+    LinearToLabAvx2(
+        _mm256_set_pd(linear[r[3]], linear[r[2]], linear[r[1]], linear[r[0]]),
+        _mm256_set_pd(linear[g[3]], linear[g[2]], linear[g[1]], linear[g[0]]),
+        _mm256_set_pd(linear[b[3]], linear[b[2]], linear[b[1]], linear[b[0]]),
+        wx, wy, wz, l, a, bb);
+}
+
+CHIZL_TARGET_AVX2 static void RgbPlanarToLabAvx2(const unsigned char* r, const unsigned char* g, const unsigned char* b,
+    double* l, double* a, double* bb, size_t count, const double* linear, WhitePoint wp)
+{
+    const __m256d wx = _mm256_set1_pd(wp.x), wy = _mm256_set1_pd(wp.y), wz = _mm256_set1_pd(wp.z);
+
+    // 8 pixels per iteration as two 4 lane chains, same as RgbToLabAvx2.
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        RgbPlanarToLabAvx2_4(r + i, g + i, b + i, l + i, a + i, bb + i, linear, wx, wy, wz);
+        RgbPlanarToLabAvx2_4(r + i + 4, g + i + 4, b + i + 4, l + i + 4, a + i + 4, bb + i + 4, linear, wx, wy, wz);
+    }
+    if (i + 4 <= count)
+    {
+        RgbPlanarToLabAvx2_4(r + i, g + i, b + i, l + i, a + i, bb + i, linear, wx, wy, wz);
+        i += 4;
+    }
+
+    if (i < count)
+        RgbPlanarToLabScalar(r + i, g + i, b + i, l + i, a + i, bb + i, count - i, linear, wp);
+}
+
+// Linear RGB (4 lanes) -> LMS -> OKLab, stored to l / a / b (4 doubles each).
+CHIZL_TARGET_AVX2 static inline void LinearToOkLabAvx2(__m256d r, __m256d g, __m256d b, double* l, double* a, double* bb)
+{
+    const __m256d zero = _mm256_setzero_pd();
+    const __m256d lms0 = _mm256_add_pd(_mm256_add_pd(
+        _mm256_mul_pd(r, _mm256_set1_pd(0.4122214708)), _mm256_mul_pd(g, _mm256_set1_pd(0.5363325363))), _mm256_mul_pd(b, _mm256_set1_pd(0.0514459929)));
+    const __m256d lms1 = _mm256_add_pd(_mm256_add_pd(
+        _mm256_mul_pd(r, _mm256_set1_pd(0.2119034982)), _mm256_mul_pd(g, _mm256_set1_pd(0.6806995451))), _mm256_mul_pd(b, _mm256_set1_pd(0.1073969566)));
+    const __m256d lms2 = _mm256_add_pd(_mm256_add_pd(
+        _mm256_mul_pd(r, _mm256_set1_pd(0.0883024619)), _mm256_mul_pd(g, _mm256_set1_pd(0.2817188376))), _mm256_mul_pd(b, _mm256_set1_pd(0.6299787005)));
+
+    const __m256d lc = _mm256_and_pd(cbrt_avx2(lms0), _mm256_cmp_pd(lms0, zero, _CMP_GT_OQ));
+    const __m256d mc = _mm256_and_pd(cbrt_avx2(lms1), _mm256_cmp_pd(lms1, zero, _CMP_GT_OQ));
+    const __m256d sc = _mm256_and_pd(cbrt_avx2(lms2), _mm256_cmp_pd(lms2, zero, _CMP_GT_OQ));
+
+    _mm256_storeu_pd(l, _mm256_sub_pd(_mm256_add_pd(
+        _mm256_mul_pd(_mm256_set1_pd(0.2104542553), lc), _mm256_mul_pd(_mm256_set1_pd(0.7936177850), mc)), _mm256_mul_pd(_mm256_set1_pd(0.0040720468), sc)));
+    _mm256_storeu_pd(a, _mm256_add_pd(_mm256_sub_pd(
+        _mm256_mul_pd(_mm256_set1_pd(1.9779984951), lc), _mm256_mul_pd(_mm256_set1_pd(2.4285922050), mc)), _mm256_mul_pd(_mm256_set1_pd(0.4505937099), sc)));
+    _mm256_storeu_pd(bb, _mm256_sub_pd(_mm256_add_pd(
+        _mm256_mul_pd(_mm256_set1_pd(0.0259040371), lc), _mm256_mul_pd(_mm256_set1_pd(0.7827717662), mc)), _mm256_mul_pd(_mm256_set1_pd(0.8086757660), sc)));
+}
+
+CHIZL_TARGET_AVX2 static inline void RgbToOkLabAvx2_4(const RgbColor* rgb, OkLabSpace* lab, size_t index, size_t stride, const double* linear)
+{
+    double l[4], a[4], bb[4];
+    LinearToOkLabAvx2(
+        _mm256_set_pd(linear[rgb[3].red], linear[rgb[2].red], linear[rgb[1].red], linear[rgb[0].red]),
+        _mm256_set_pd(linear[rgb[3].green], linear[rgb[2].green], linear[rgb[1].green], linear[rgb[0].green]),
+        _mm256_set_pd(linear[rgb[3].blue], linear[rgb[2].blue], linear[rgb[1].blue], linear[rgb[0].blue]),
+        l, a, bb);
+    StoreOkLab(lab, index, stride, l, a, bb, 4);
+}
+
+CHIZL_TARGET_AVX2 static void RgbToOkLabAvx2(const RgbColor* rgb, OkLabSpace* lab, size_t count, size_t stride, const double* linear)
+{
+    // 8 pixels per iteration as two 4 lane chains, same as RgbToLabAvx2.
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        RgbToOkLabAvx2_4(rgb + i, lab, i, stride, linear);
+        RgbToOkLabAvx2_4(rgb + i + 4, lab, i + 4, stride, linear);
+    }
+    if (i + 4 <= count)
+    {
+        RgbToOkLabAvx2_4(rgb + i, lab, i, stride, linear);
+        i += 4;
+    }
+
+    if (i < count)
+        RgbToOkLabScalar(rgb + i, (OkLabSpace*)stridedAt(lab, i, stride, sizeof(OkLabSpace)), count - i, stride, linear);
+}
+
+#endif // CHIZL_SIMD_X86
+
+void RgbToLabKernel(const RgbColor* rgb, LabSpace* lab, size_t count, size_t stride, const double* linear, WhitePoint wp)
+{
+#if CHIZL_SIMD_X86
+    switch (SimdActiveLevel())
+    {
+    case SIMD_AVX2:
+        RgbToLabAvx2(rgb, lab, count, stride, linear, wp);
+        return;
+    case SIMD_SSE41:
+        RgbToLabSse41(rgb, lab, count, stride, linear, wp);
+        return;
+    default:
+        break;
+    }
+#endif
+    RgbToLabScalar(rgb, lab, count, stride, linear, wp);
+}
+
+void RgbPlanarToLabKernel(const unsigned char* r, const unsigned char* g, const unsigned char* b,
+    double* l, double* a, double* bb, size_t count, const double* linear, WhitePoint wp)
+{
+#if CHIZL_SIMD_X86
+    switch (SimdActiveLevel())
+    {
+    case SIMD_AVX2:
+        RgbPlanarToLabAvx2(r, g, b, l, a, bb, count, linear, wp);
+        return;
+    case SIMD_SSE41:
+        RgbPlanarToLabSse41(r, g, b, l, a, bb, count, linear, wp);
+        return;
+    default:
+        break;
+    }
+#endif
+    RgbPlanarToLabScalar(r, g, b, l, a, bb, count, linear, wp);
+}
+
+void RgbToOkLabKernel(const RgbColor* rgb, OkLabSpace* lab, size_t count, size_t stride, const double* linear)
+{
+#if CHIZL_SIMD_X86
+    switch (SimdActiveLevel())
+    {
+    case SIMD_AVX2:
+        RgbToOkLabAvx2(rgb, lab, count, stride, linear);
+        return;
+    case SIMD_SSE41:
+        RgbToOkLabSse41(rgb, lab, count, stride, linear);
+        return;
+    default:
+        break;
+    }
+#endif
+    RgbToOkLabScalar(rgb, lab, count, stride, linear);
+}
+
+void RgbDeinterleaveKernel(const RgbColor* rgb, unsigned char* r, unsigned char* g, unsigned char* b, unsigned char* a, size_t count)
+{
+#if CHIZL_SIMD_X86
+    // Byte shuffles only, AVX2 adds nothing here.
+    if (SimdActiveLevel() >= SIMD_SSE41)
+    {
+        RgbDeinterleaveSse41(rgb, r, g, b, a, count);
+        return;
+    }
+#endif
+    RgbDeinterleaveScalar(rgb, r, g, b, a, count);
+}
+
+void RgbInterleaveKernel(const unsigned char* r, const unsigned char* g, const unsigned char* b, const unsigned char* a, RgbColor* rgb, size_t count)
+{
+#if CHIZL_SIMD_X86
+    if (SimdActiveLevel() >= SIMD_SSE41)
+    {
+        RgbInterleaveSse41(r, g, b, a, rgb, count);
+        return;
+    }
+#endif
+    RgbInterleaveScalar(r, g, b, a, rgb, count);
+}
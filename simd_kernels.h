@@ -0,0 +1,63 @@
+// simd_kernels.h
+#pragma once
+
+#ifndef SIMD_KERNELS_H
+#define SIMD_KERNELS_H
+
+// Internal only, not part of the public API.
+// Vectorized buffer kernels with runtime CPU dispatch.  Each kernel picks the best
+// instruction set the CPU supports (AVX2, then SSE4.1) and finishes the remainder of
+// the buffer with the scalar code from cie_common.h.
+
+#include "chizl_colors_types.h"
+#include "color_support.h"      // For SimdLevel
+#include "white_points.h"
+#include <stddef.h>             // For size_t
+
+/// <summary>
+/// Returns the SIMD level the kernels will use: the best level the CPU and OS support,
+/// capped by ChizlSetSimdLevel().
+/// </summary>
+SimdLevel SimdActiveLevel(void);
+
+/// <summary>
+/// RGB -> XYZ -> Lab for a whole buffer.  Matches XyzToLab_White(RgbToXyz_Core(...)) except
+/// for the cube root, which is a vectorized approximation (see simd_kernels.c for the error budget).
+/// </summary>
+/// <param name="rgb">Input colors.</param>
+/// <param name="lab">Output, 'stride' bytes apart (0 for packed).</param>
+/// <param name="count">Number of colors.</param>
+/// <param name="stride">Distance in bytes between output elements, 0 for a tightly packed array.</param>
+/// <param name="linear">Table from SrgbLinearTable().</param>
+/// <param name="wp">Reference white for the XYZ to Lab step.</param>
+void RgbToLabKernel(const RgbColor* rgb, LabSpace* lab, size_t count, size_t stride, const double* linear, WhitePoint wp);
+
+/// <summary>
+/// RgbToLabKernel for planar input and output: separate R, G, B byte planes in, separate L, a, b planes out.
+/// Same math and accuracy as RgbToLabKernel.
+/// </summary>
+void RgbPlanarToLabKernel(const unsigned char* r, const unsigned char* g, const unsigned char* b,
+    double* l, double* a, double* bb, size_t count, const double* linear, WhitePoint wp);
+
+/// <summary>
+/// RGB -> OKLab for a whole buffer.  Matches RgbToOkLab_Core except for the cube root, the same
+/// approximation RgbToLabKernel uses.
+/// </summary>
+/// <param name="rgb">Input colors.</param>
+/// <param name="lab">Output, 'stride' bytes apart (0 for packed).</param>
+/// <param name="count">Number of colors.</param>
+/// <param name="stride">Distance in bytes between output elements, 0 for a tightly packed array.</param>
+/// <param name="linear">Table from SrgbLinearTable().</param>
+void RgbToOkLabKernel(const RgbColor* rgb, OkLabSpace* lab, size_t count, size_t stride, const double* linear);
+
+/// <summary>
+/// Splits RgbColor structs into R, G, B (and optionally A, may be NULL) byte planes.
+/// </summary>
+void RgbDeinterleaveKernel(const RgbColor* rgb, unsigned char* r, unsigned char* g, unsigned char* b, unsigned char* a, size_t count);
+
+/// <summary>
+/// Joins R, G, B byte planes (and optionally A, NULL for opaque) into RgbColor structs.
+/// </summary>
+void RgbInterleaveKernel(const unsigned char* r, const unsigned char* g, const unsigned char* b, const unsigned char* a, RgbColor* rgb, size_t count);
+
+#endif
@@ -0,0 +1,30 @@
+// srgb_linear.c
+#include "srgb_linear.h"
+#include "chizl_once.h"
+#include <math.h>               // For pow
+
+static double s_linearTable[256];
+static ChizlOnce s_linearOnce = CHIZL_ONCE_INIT;
+
+double SrgbToLinear(double v)
+{
+    return (v > 0.04045) ? pow((v + 0.055) / 1.055, 2.4) : v / 12.92;
+}
+
+double LinearToSrgb(double v)
+{
+    return (v > 0.0031308) ? (1.055 * pow(v, 1.0 / 2.4)) - 0.055 : v * 12.92;
+}
+
+static void BuildLinearTable(void)
+{
+    // Same normalization RgbToXyz used per channel: (channel / 255.0) then gamma expansion.
+    for (int i = 0; i < 256; i++)
+        s_linearTable[i] = SrgbToLinear(i / 255.0);
+}
+
+const double* SrgbLinearTable(void)
+{
+    ChizlRunOnce(&s_linearOnce, BuildLinearTable);
+    return s_linearTable;
+}
@@ -0,0 +1,30 @@
+// srgb_linear.h
+#pragma once
+
+#ifndef SRGB_LINEAR_H
+#define SRGB_LINEAR_H
+
+// Internal only, not part of the public API.
+// 8-bit sRGB channels only have 256 possible values, so the sRGB -> linear RGB
+// gamma expansion is done once per value into a table instead of calling
+// pow(..., 2.4) three times per color.
+
+/// <summary>
+/// Returns the 256 entry sRGB to linear RGB (0.0-1.0) table, building it on first use.<br/>
+/// Entries are computed with the exact expression RgbToXyz has always used, so table 
+/// lookups are bit-identical to the per color pow() results.
+/// </summary>
+const double* SrgbLinearTable(void);
+
+/// <summary>
+/// The reference sRGB gamma expansion for a single channel (0.0-1.0).  Used to build the table 
+/// and kept for non 8-bit inputs.
+/// </summary>
+double SrgbToLinear(double v);
+
+/// <summary>
+/// The inverse gamma (linear RGB 0.0-1.0 -> sRGB 0.0-1.0) used when converting back to RgbColor.
+/// </summary>
+double LinearToSrgb(double v);
+
+#endif
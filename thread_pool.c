@@ -0,0 +1,288 @@
+// thread_pool.c
+#include "thread_pool.h"
+#include "color_support.h"
+#include "chizl_lock.h"         // For ChizlMutex, ChizlLock, ChizlUnlock
+#include <stdlib.h>             // For malloc, free
+
+// One job at a time owns the pool.  The job is a range split into fixed size chunks, every thread
+// (workers and the caller) claims the next chunk under the lock, runs it unlocked and comes back
+// for more until the range is used up.  Claiming per chunk balances uneven cores without any
+// per thread queues, and with chunks of thousands of colors the lock is taken rarely.
+//
+// Workers wait on s_wake for a new job generation, the caller waits on s_done until the range is
+// claimed and no chunk is still running.  A worker that wakes late simply finds nothing to claim.
+
+#if defined(_WIN32) || defined(_WIN64)
+  #ifndef WIN32_LEAN_AND_MEAN
+    #define WIN32_LEAN_AND_MEAN
+  #endif
+  #include <windows.h>          // For CONDITION_VARIABLE, GetActiveProcessorCount
+  #include <process.h>          // For _beginthreadex
+
+  typedef CONDITION_VARIABLE ChizlCond;
+  typedef HANDLE ChizlThread;
+  #define CHIZL_COND_INIT CONDITION_VARIABLE_INIT
+
+  static inline void CondWait(ChizlCond* c, ChizlMutex* m) { SleepConditionVariableSRW(c, m, INFINITE, 0); }
+  static inline void CondBroadcast(ChizlCond* c) { WakeAllConditionVariable(c); }
+  static inline void CondSignal(ChizlCond* c) { WakeConditionVariable(c); }
+
+  static size_t HardwareThreads(void) { return (size_t)GetActiveProcessorCount(ALL_PROCESSOR_GROUPS); }
+#else
+  #include <pthread.h>          // For pthread_create, pthread_cond_t
+  #include <unistd.h>           // For sysconf
+
+  typedef pthread_cond_t ChizlCond;
+  typedef pthread_t ChizlThread;
+  #define CHIZL_COND_INIT PTHREAD_COND_INITIALIZER
+
+  static inline void CondWait(ChizlCond* c, ChizlMutex* m) { pthread_cond_wait(c, m); }
+  static inline void CondBroadcast(ChizlCond* c) { pthread_cond_broadcast(c); }
+  static inline void CondSignal(ChizlCond* c) { pthread_cond_signal(c); }
+
+  static size_t HardwareThreads(void)
+  {
+      const long n = sysconf(_SC_NPROCESSORS_ONLN);
+      return (n > 0) ? (size_t)n : 1;
+  }
+#endif
+
+// Upper bound for ChizlSetThreadCount, far above any useful count for memory bound conversions.
+#define CHIZL_MAX_THREADS 256
+
+static ChizlMutex s_ownerLock = CHIZL_MUTEX_INIT;  // Held by the job (or thread count change) that owns the pool
+static ChizlMutex s_lock = CHIZL_MUTEX_INIT;       // Guards everything below
+static ChizlCond s_wake = CHIZL_COND_INIT;
+static ChizlCond s_done = CHIZL_COND_INIT;
+
+static ChizlThread* s_workers = NULL;
+static size_t s_workerCount = 0;
+static size_t s_threadCount = 0;                    // 0 until first used or set, then includes the caller
+static int s_stop = 0;
+static unsigned s_generation = 0;
+
+static ChizlTaskFn s_fn = NULL;
+static void* s_ctx = NULL;
+static size_t s_count = 0;
+static size_t s_chunk = 0;
+static size_t s_next = 0;
+static size_t s_running = 0;
+
+static size_t ClampThreads(size_t n)
+{
+    if (n == 0)
+        n = HardwareThreads();
+    return (n < 1) ? 1 : ((n > CHIZL_MAX_THREADS) ? CHIZL_MAX_THREADS : n);
+}
+
+/// <summary>
+/// Claims and runs chunks of the current job until none are left.  Called with s_lock held, returns with it held.
+/// </summary>
+static void RunChunks(void)
+{
+    while (s_next < s_count)
+    {
+        const size_t begin = s_next;
+        const size_t end = (s_count - begin > s_chunk) ? begin + s_chunk : s_count;
+        const ChizlTaskFn fn = s_fn;
+        void* ctx = s_ctx;
+
+        s_next = end;
+        s_running++;
+        ChizlUnlock(&s_lock);
+
+        fn(ctx, begin, end);
+
+        ChizlLock(&s_lock);
+        s_running--;
+    }
+
+    if (s_running == 0)
+        CondSignal(&s_done);
+}
+
+#if defined(_WIN32) || defined(_WIN64)
+static unsigned __stdcall WorkerMain(void* arg)
+#else
+static void* WorkerMain(void* arg)
+#endif
+{
+    (void)arg;
+    unsigned seen = 0;
+
+    ChizlLock(&s_lock);
+    seen = s_generation;
+    for (;;)
+    {
+        while (!s_stop && seen == s_generation)
+            CondWait(&s_wake, &s_lock);
+        if (s_stop)
+            break;
+
+        seen = s_generation;
+        RunChunks();
+    }
+    ChizlUnlock(&s_lock);
+    return 0;
+}
+
+/// <summary>
+/// Wakes every worker with the stop flag and waits for them to exit.  Caller owns s_ownerLock.
+/// </summary>
+static void StopWorkers(void)
+{
+    ChizlLock(&s_lock);
+    s_stop = 1;
+    CondBroadcast(&s_wake);
+    ChizlUnlock(&s_lock);
+
+    for (size_t i = 0; i < s_workerCount; i++)
+    {
+#if defined(_WIN32) || defined(_WIN64)
+        WaitForSingleObject(s_workers[i], INFINITE);
+        CloseHandle(s_workers[i]);
+#else
+        pthread_join(s_workers[i], NULL);
+#endif
+    }
+
+    free(s_workers);
+    s_workers = NULL;
+    s_workerCount = 0;
+    s_stop = 0;
+}
+
+#if !defined(_WIN32) && !defined(_WIN64)
+/// <summary>
+/// atexit handler, stops the workers at exit or dlclose.
+/// </summary>
+static void ShutdownAtExit(void)
+{
+    // A job still running (exit() called from inside one) keeps its workers, the process is going away.
+    if (!ChizlTryLock(&s_ownerLock))
+        return;
+    if (s_workers != NULL)
+        StopWorkers();
+    ChizlUnlock(&s_ownerLock);
+}
+#endif
+
+/// <summary>
+/// Starts threadCount - 1 workers.  Caller owns s_ownerLock.  A worker that fails to start just
+/// leaves the pool smaller, jobs still complete on the threads that did start.
+/// </summary>
+static void StartWorkers(size_t threadCount)
+{
+    const size_t want = threadCount - 1;
+    s_workers = (ChizlThread*)malloc(want * sizeof(ChizlThread));
+    if (s_workers == NULL)
+        return;
+
+#if !defined(_WIN32) && !defined(_WIN64)
+    // dlclose and exit run atexit handlers registered by a shared library, so the workers are gone
+    // before the code they sleep in is unmapped.  There is no such hook on Windows: every
+    // _beginthreadex thread holds a reference on this DLL, FreeLibrary can't unload it while workers
+    // exist, callers stop them first with ChizlStopThreads.
+    static int s_atExit = 0;
+    if (!s_atExit)
+        s_atExit = (atexit(ShutdownAtExit) == 0);
+#endif
+
+    s_stop = 0;
+    for (size_t i = 0; i < want; i++)
+    {
+#if defined(_WIN32) || defined(_WIN64)
+        const HANDLE h = (HANDLE)_beginthreadex(NULL, 0, WorkerMain, NULL, 0, NULL);
+        const int started = (h != NULL);
+        if (started)
+            s_workers[s_workerCount++] = h;
+#else
+        const int started = (pthread_create(&s_workers[s_workerCount], NULL, WorkerMain, NULL) == 0);
+        if (started)
+            s_workerCount++;
+#endif
+        if (!started)
+            break;
+    }
+}
+
+void ChizlParallelFor(size_t count, size_t chunk, ChizlTaskFn fn, void* ctx)
+{
+    if (count == 0 || fn == NULL)
+        return;
+    if (chunk == 0)
+        chunk = count;
+
+    // Busy pool (another thread's job, or fn itself calling back in): run here rather than wait.
+    if (count <= chunk || !ChizlTryLock(&s_ownerLock))
+    {
+        fn(ctx, 0, count);
+        return;
+    }
+
+    if (s_threadCount == 0)
+        s_threadCount = ClampThreads(0);
+    if (s_threadCount > 1 && s_workers == NULL)
+        StartWorkers(s_threadCount);
+
+    if (s_workerCount == 0)
+    {
+        ChizlUnlock(&s_ownerLock);
+        fn(ctx, 0, count);
+        return;
+    }
+
+    ChizlLock(&s_lock);
+    s_fn = fn;
+    s_ctx = ctx;
+    s_count = count;
+    s_chunk = chunk;
+    s_next = 0;
+    s_running = 0;
+    s_generation++;
+    CondBroadcast(&s_wake);
+
+    RunChunks();
+    while (s_next < s_count || s_running != 0)
+        CondWait(&s_done, &s_lock);
+
+    s_fn = NULL;
+    s_ctx = NULL;
+    ChizlUnlock(&s_lock);
+    ChizlUnlock(&s_ownerLock);
+}
+
+CHIZL_COLORS_API size_t ChizlGetThreadCount(void)
+{
+    ChizlLock(&s_ownerLock);
+    if (s_threadCount == 0)
+        s_threadCount = ClampThreads(0);
+    const size_t n = s_threadCount;
+    ChizlUnlock(&s_ownerLock);
+    return n;
+}
+
+CHIZL_COLORS_API size_t ChizlSetThreadCount(size_t threadCount)
+{
+    const size_t n = ClampThreads(threadCount);
+
+    // Waits for a running job to finish, then restarts the pool at the new size on the next job.
+    ChizlLock(&s_ownerLock);
+    if (n != s_threadCount || n == 1)
+    {
+        if (s_workers != NULL)
+            StopWorkers();
+        s_threadCount = n;
+    }
+    ChizlUnlock(&s_ownerLock);
+    return n;
+}
+
+CHIZL_COLORS_API void ChizlStopThreads(void)
+{
+    // Waits for a running job like ChizlSetThreadCount, the thread count itself is kept.
+    ChizlLock(&s_ownerLock);
+    if (s_workers != NULL)
+        StopWorkers();
+    ChizlUnlock(&s_ownerLock);
+}
@@ -0,0 +1,28 @@
+// thread_pool.h
+#pragma once
+
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+// Internal only, not part of the public API.
+// Persistent worker pool behind the *Parallel entry points.  Workers are started on the first
+// job that needs them and then sleep between jobs, so a call costs a wake up, not a thread start.
+// Thread count is set with ChizlSetThreadCount() (color_support.h), ChizlStopThreads() stops the workers
+// before the library is unloaded.
+
+#include <stddef.h>             // For size_t
+
+/// <summary>
+/// Work callback for ChizlParallelFor, processes items [begin, end).  Called from several threads
+/// at once with different ranges, it must only write to its own part of the output.
+/// </summary>
+typedef void (*ChizlTaskFn)(void* ctx, size_t begin, size_t end);
+
+/// <summary>
+/// Splits [0, count) into ranges of 'chunk' items and runs 'fn' on them across the pool, the calling
+/// thread works too.  Returns once every range is done.  Runs inline (one fn call for the whole range)
+/// when the pool is set to one thread, the job is a single chunk, or another job already owns the pool.
+/// </summary>
+void ChizlParallelFor(size_t count, size_t chunk, ChizlTaskFn fn, void* ctx);
+
+#endif
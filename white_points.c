@@ -1,5 +1,129 @@
-// color_support.c
-#include "white_points.h"
+// white_points.c
+#include "white_points_core.h"
+#include "cie_common.h"         // For LuvWhiteChromaticity
+#include "chizl_once.h"
+#include "chizl_lock.h"
+#include <math.h>               // For isfinite
 
 const WhitePoint WP_D65 = { 95.0470, 100.0000, 108.8830 };
 const WhitePoint WP_D65_FULL = { 95.0489, 100.0000, 108.8840 };
+
+// CIE 1931 2° observer, Y = 100, in WhitePointType order.
+static const WhitePoint s_builtIn[WPID_BUILTIN_COUNT] = {
+    {  95.0470, 100.0000, 108.8830 },   // D65
+    {  95.0489, 100.0000, 108.8840 },   // D65 full precision
+    {  96.4220, 100.0000,  82.5210 },   // D50
+    {  95.6820, 100.0000,  92.1490 },   // D55
+    {  94.9720, 100.0000, 122.6380 },   // D75
+    { 109.8500, 100.0000,  35.5850 },   // A
+    {  98.0740, 100.0000, 118.2320 },   // C
+    { 100.0000, 100.0000, 100.0000 },   // E
+    {  92.8340, 100.0000, 103.6650 },   // F1
+    {  99.1870, 100.0000,  67.3950 },   // F2
+    { 103.7540, 100.0000,  49.8610 },   // F3
+    { 109.1470, 100.0000,  38.8130 },   // F4
+    {  90.8720, 100.0000,  98.7230 },   // F5
+    {  97.3090, 100.0000,  60.1910 },   // F6
+    {  95.0440, 100.0000, 108.7550 },   // F7
+    {  96.4130, 100.0000,  82.3330 },   // F8
+    { 100.3650, 100.0000,  67.8680 },   // F9
+    {  96.1740, 100.0000,  81.7120 },   // F10
+    { 100.9660, 100.0000,  64.3700 },   // F11
+    { 108.0460, 100.0000,  39.2280 }    // F12
+};
+
+// Built in entries are filled once and never change, so they are read without locking.
+// Custom entries are appended under s_customLock and read under it too.
+static WhitePointInfo s_builtInInfo[WPID_BUILTIN_COUNT];
+static ChizlOnce s_builtInOnce = CHIZL_ONCE_INIT;
+
+static WhitePointInfo s_custom[CHIZL_MAX_CUSTOM_WHITE_POINTS];
+static size_t s_customCount = 0;
+static ChizlMutex s_customLock = CHIZL_MUTEX_INIT;
+
+static WhitePointInfo MakeInfo(WhitePoint wp)
+{
+    WhitePointInfo info;
+    info.wp = wp;
+    LuvWhiteChromaticity(wp, &info.un_prime, &info.vn_prime);
+    return info;
+}
+
+static void BuildBuiltInInfo(void)
+{
+    for (int i = 0; i < WPID_BUILTIN_COUNT; i++)
+        s_builtInInfo[i] = MakeInfo(s_builtIn[i]);
+}
+
+int WhitePointLookup(WhitePointType id, WhitePointInfo* info)
+{
+    const int n = (int)id;
+    if (n >= 0 && n < WPID_BUILTIN_COUNT)
+    {
+        ChizlRunOnce(&s_builtInOnce, BuildBuiltInInfo);
+        *info = s_builtInInfo[n];
+        return 1;
+    }
+
+    if (n < WPID_CUSTOM)
+        return 0;
+
+    const size_t slot = (size_t)(n - WPID_CUSTOM);
+    int found = 0;
+    ChizlLock(&s_customLock);
+    if (slot < s_customCount)
+    {
+        *info = s_custom[slot];
+        found = 1;
+    }
+    ChizlUnlock(&s_customLock);
+    return found;
+}
+
+WhitePointInfo WhitePointInfoFromType(WhitePointType id)
+{
+    WhitePointInfo info;
+    if (!WhitePointLookup(id, &info))
+        WhitePointLookup(WPID_D65, &info);
+    return info;
+}
+
+CHIZL_COLORS_API int WhitePointRegister(WhitePoint wp, WhitePointType* id)
+{
+    if (id == NULL)
+        return 0;
+    if (!isfinite(wp.x) || !isfinite(wp.y) || !isfinite(wp.z) || wp.x <= 0.0 || wp.y <= 0.0 || wp.z <= 0.0)
+        return 0;
+
+    int ok = 0;
+    ChizlLock(&s_customLock);
+    for (size_t i = 0; i < s_customCount; i++)
+    {
+        const WhitePoint* c = &s_custom[i].wp;
+        if (c->x == wp.x && c->y == wp.y && c->z == wp.z)
+        {
+            *id = (WhitePointType)(WPID_CUSTOM + (int)i);
+            ok = 1;
+            break;
+        }
+    }
+    if (!ok && s_customCount < CHIZL_MAX_CUSTOM_WHITE_POINTS)
+    {
+        s_custom[s_customCount] = MakeInfo(wp);
+        *id = (WhitePointType)(WPID_CUSTOM + (int)s_customCount);
+        s_customCount++;
+        ok = 1;
+    }
+    ChizlUnlock(&s_customLock);
+    return ok;
+}
+
+CHIZL_COLORS_API int WhitePointGet(WhitePointType id, WhitePoint* wp)
+{
+    WhitePointInfo info;
+    if (wp == NULL || !WhitePointLookup(id, &info))
+        return 0;
+
+    *wp = info.wp;
+    return 1;
+}
@@ -1,14 +1,49 @@
 #pragma once
 
+#ifndef WHITE_POINTS_H
+#define WHITE_POINTS_H
+
+// --- Start of "extern C" block ---
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "import_exports.h"
+
 /// <summary>
-/// Enumeration of standard illuminant white point types for color space calculations.
+/// Enumeration of standard illuminant white point types for color space calculations.<br/>
+/// Values are the CIE 1931 2° observer tristimulus values with Y = 100.  Ids from WPID_CUSTOM up
+/// are handed out by WhitePointRegister.
 /// </summary>
 typedef enum {
     WPID_D65 = 0,
-    WPID_D65_FULL = 1
-    // later: D50, D55, etc.
+    WPID_D65_FULL = 1,
+    WPID_D50 = 2,           // Print / ICC profile connection space
+    WPID_D55 = 3,
+    WPID_D75 = 4,
+    WPID_A = 5,             // Incandescent
+    WPID_C = 6,
+    WPID_E = 7,             // Equal energy
+    WPID_F1 = 8,            // F1 - F12 fluorescent
+    WPID_F2 = 9,
+    WPID_F3 = 10,
+    WPID_F4 = 11,
+    WPID_F5 = 12,
+    WPID_F6 = 13,
+    WPID_F7 = 14,
+    WPID_F8 = 15,
+    WPID_F9 = 16,
+    WPID_F10 = 17,
+    WPID_F11 = 18,
+    WPID_F12 = 19,
+    WPID_CUSTOM = 100       // First id WhitePointRegister returns
 } WhitePointType;
 
+/// <summary>
+/// Maximum number of custom white points WhitePointRegister can hold.
+/// </summary>
+#define CHIZL_MAX_CUSTOM_WHITE_POINTS 64
+
 /// <summary>
 /// Represents a white point in three-dimensional color space.
 /// </summary>
@@ -22,4 +57,28 @@ extern const WhitePoint WP_D65;
 /// <summary>
 /// Represents the D65 standard illuminant white point with full precision.
 /// </summary>
-extern const WhitePoint WP_D65_FULL;
\ No newline at end of file
+extern const WhitePoint WP_D65_FULL;
+
+/// <summary>
+/// Adds a custom white point (a measured paper white, a display's native white, ...) so it can be used
+/// anywhere a WhitePointType is taken.  Registering the same values again returns the id they already have.<br/>
+/// Registered points stay for the life of the process, up to CHIZL_MAX_CUSTOM_WHITE_POINTS.  Thread safe.
+/// </summary>
+/// <param name="wp">White point XYZ on the 0 - 100 scale, every component above 0.</param>
+/// <param name="id">Receives the new id (WPID_CUSTOM or higher).</param>
+/// <returns>1 on success, 0 if id is NULL, the values are not valid or the registry is full.</returns>
+CHIZL_COLORS_API int WhitePointRegister(WhitePoint wp, WhitePointType* id);
+
+/// <summary>
+/// Looks up the values of a built in or registered white point.
+/// </summary>
+/// <param name="id">White point id.</param>
+/// <param name="wp">Receives the white point XYZ (0 - 100 scale).</param>
+/// <returns>1 on success, 0 if wp is NULL or the id is unknown.</returns>
+CHIZL_COLORS_API int WhitePointGet(WhitePointType id, WhitePoint* wp);
+
+// --- End of "extern C" block ---
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -0,0 +1,41 @@
+// white_points_core.h
+#pragma once
+
+#ifndef WHITE_POINTS_CORE_H
+#define WHITE_POINTS_CORE_H
+
+// Internal only, not part of the public API.
+// White point registry lookups for the Ex conversions and chromatic adaptation.  Each entry carries the
+// constants derived from its XYZ, worked out once when the point is added instead of on every conversion.
+
+#include "white_points.h"
+
+// Built in ids are 0 .. WPID_BUILTIN_COUNT - 1.
+#define WPID_BUILTIN_COUNT (WPID_F12 + 1)
+
+typedef struct {
+    WhitePoint wp;
+    double un_prime;            // Luv reference chromaticity (u'n, v'n)
+    double vn_prime;
+} WhitePointInfo;
+
+/// <summary>
+/// Copies the registry entry for a built in or registered id.  Returns 1 if the id is known, 0 otherwise.
+/// </summary>
+int WhitePointLookup(WhitePointType id, WhitePointInfo* info);
+
+/// <summary>
+/// Registry entry for an id.  Unknown ids fall back to WP_D65, matching the default branch
+/// XyzToLabEx and XyzToLuvEx have always used.
+/// </summary>
+WhitePointInfo WhitePointInfoFromType(WhitePointType id);
+
+/// <summary>
+/// Maps a WhitePointType id to its white point values, unknown ids fall back to WP_D65.
+/// </summary>
+static inline WhitePoint WhitePointFromType(WhitePointType id)
+{
+    return WhitePointInfoFromType(id).wp;
+}
+
+#endif
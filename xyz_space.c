@@ -1,5 +1,8 @@
 // xyz_space.c
 #include "xyz_space.h"
+#include "cie_common.h"         // For RgbToXyz_Core, XyzToLab_White
+#include "white_points_core.h"  // For WhitePointFromType
+#include "simd_kernels.h"       // For RgbToLabKernel
 #include "common.h"
 #include <string.h>             // For strlen, strcpy_s
 #include <math.h>               // For fmin, fmax, fabs, round, pow
@@ -8,90 +11,244 @@
 
 // CIELAB, CIELCh, and CIELUV, and XYZ conversions.
 
-static inline double lab_f(double t)
+CHIZL_COLORS_API LabSpace RgbToLab(RgbColor rgb)
 {
-    if (t < 0.0) t = 0.0;
+    XyzSpace xyz = RgbToXyz_Core(rgb, SrgbLinearTable());
+	return XyzToLab_White(xyz, WP_D65_FULL);     // WP_D65_FULL - default, WP_D65 is the other options
+}
 
-    const double delta = 6.0 / 29.0;
-    const double delta2 = delta * delta;
-    const double delta3 = delta2 * delta;
+CHIZL_COLORS_API XyzSpace RgbToXyz(RgbColor rgb)
+{
+    return RgbToXyz_Core(rgb, SrgbLinearTable());
+}
 
-    if (t >= delta3)
-        return cbrt(t);
+CHIZL_COLORS_API LabSpace XyzToLabEx(XyzSpace xyz, WhitePointType wp)
+{
+    return XyzToLab_White(xyz, WhitePointFromType(wp));
+}
 
-    const double inv_3delta2 = 1.0 / (3.0 * delta2);
-    return (t * inv_3delta2) + (4.0 / 29.0);
+CHIZL_COLORS_API LabSpace XyzToLab(XyzSpace xyz)
+{
+    return XyzToLab_White(xyz, WP_D65_FULL);     // WP_D65_FULL - default, WP_D65 is the other options
 }
 
-static inline LabSpace XyzToLab_White(XyzSpace xyz, WhitePoint wp)
+CHIZL_COLORS_API size_t RgbToXyzBatch(const RgbColor* rgb, XyzSpace* xyz, size_t count, size_t stride)
 {
-    // Normalize XYZ by reference white (XYZ expected 0..100 scale)
-    const double x = xyz.x / wp.x;
-    const double y = xyz.y / wp.y;
-    const double z = xyz.z / wp.z;
+    if (rgb == NULL || xyz == NULL)
+        return 0;
 
-    const double fx = lab_f(x);
-    const double fy = lab_f(y);
-    const double fz = lab_f(z);
+    const double* linear = SrgbLinearTable();
 
-    LabSpace lab = {
-        (116.0 * fy) - 16.0,
-        500.0 * (fx - fy),
-        200.0 * (fy - fz)
-    };
+    if (isPackedStride(stride, sizeof(XyzSpace)))
+    {
+        for (size_t i = 0; i < count; i++)
+            xyz[i] = RgbToXyz_Core(rgb[i], linear);
+    }
+    else
+    {
+        for (size_t i = 0; i < count; i++)
+            *(XyzSpace*)stridedAt(xyz, i, stride, sizeof(XyzSpace)) = RgbToXyz_Core(rgb[i], linear);
+    }
 
-    return lab;
+    return count;
 }
 
-CHIZL_COLORS_API LabSpace RgbToLab(RgbColor rgb)
+CHIZL_COLORS_API size_t RgbToLabBatch(const RgbColor* rgb, LabSpace* lab, size_t count, size_t stride)
 {
-    XyzSpace xyz = RgbToXyz(rgb);
-	return XyzToLab_White(xyz, WP_D65_FULL);     // WP_D65_FULL - default, WP_D65 is the other options
+    if (rgb == NULL || lab == NULL)
+        return 0;
+
+    // Vectorized (AVX2 / SSE4.1) when the CPU supports it, see simd_kernels.c.
+    RgbToLabKernel(rgb, lab, count, stride, SrgbLinearTable(), WP_D65_FULL);
+
+    return count;
 }
 
-CHIZL_COLORS_API XyzSpace RgbToXyz(RgbColor rgb)
+CHIZL_COLORS_API RgbColor XyzToRgb(XyzSpace xyz)
+{
+    return XyzToRgb_Core(xyz);
+}
+
+CHIZL_COLORS_API XyzSpace LabToXyzEx(LabSpace lab, WhitePointType wp)
+{
+    return LabToXyz_White(lab, WhitePointFromType(wp));
+}
+
+CHIZL_COLORS_API XyzSpace LabToXyz(LabSpace lab)
+{
+    return LabToXyz_White(lab, WP_D65_FULL);     // WP_D65_FULL - default, same as XyzToLab
+}
+
+CHIZL_COLORS_API RgbColor LabToRgb(LabSpace lab)
+{
+    return XyzToRgb_Core(LabToXyz_White(lab, WP_D65_FULL));
+}
+
+CHIZL_COLORS_API size_t XyzToRgbBatch(const XyzSpace* xyz, RgbColor* rgb, size_t count, size_t stride)
+{
+    if (xyz == NULL || rgb == NULL)
+        return 0;
+
+    if (isPackedStride(stride, sizeof(RgbColor)))
+    {
+        for (size_t i = 0; i < count; i++)
+            rgb[i] = XyzToRgb_Core(xyz[i]);
+    }
+    else
+    {
+        for (size_t i = 0; i < count; i++)
+            *(RgbColor*)stridedAt(rgb, i, stride, sizeof(RgbColor)) = XyzToRgb_Core(xyz[i]);
+    }
+
+    return count;
+}
+
+CHIZL_COLORS_API size_t LabToRgbBatch(const LabSpace* lab, RgbColor* rgb, size_t count, size_t stride)
+{
+    if (lab == NULL || rgb == NULL)
+        return 0;
+
+    const WhitePoint wp = WP_D65_FULL;     // Same default as RgbToLab
+
+    if (isPackedStride(stride, sizeof(RgbColor)))
+    {
+        for (size_t i = 0; i < count; i++)
+            rgb[i] = XyzToRgb_Core(LabToXyz_White(lab[i], wp));
+    }
+    else
+    {
+        for (size_t i = 0; i < count; i++)
+            *(RgbColor*)stridedAt(rgb, i, stride, sizeof(RgbColor)) = XyzToRgb_Core(LabToXyz_White(lab[i], wp));
+    }
+
+    return count;
+}
+
+// Float variants: same math in double, rounded to float once on the way out.
+static inline XyzSpaceF XyzToF(XyzSpace xyz)
+{
+    XyzSpaceF f = { (float)xyz.x, (float)xyz.y, (float)xyz.z };
+    return f;
+}
+
+static inline XyzSpace XyzFromF(XyzSpaceF f)
 {
-    // Normalize R, G, B to the range [0, 1]
-    double r = rgb.red / 255.0;
-    double g = rgb.green / 255.0;
-    double b = rgb.blue / 255.0;
-
-    // Apply gamma correction (sRGB to linear RGB)
-    r = (r > 0.04045) ? pow((r + 0.055) / 1.055, 2.4) : r / 12.92;
-    g = (g > 0.04045) ? pow((g + 0.055) / 1.055, 2.4) : g / 12.92;
-    b = (b > 0.04045) ? pow((b + 0.055) / 1.055, 2.4) : b / 12.92;
-
-    // Convert linear RGB to XYZ using sRGB-specific transformation matrix
-    // These coefficients are for sRGB with D65 illuminant
-    double x = r * 0.4124564 + g * 0.3575761 + b * 0.1804375;
-    double y = r * 0.2126729 + g * 0.7151522 + b * 0.0721750;
-    double z = r * 0.0193339 + g * 0.1191920 + b * 0.9503041;
-
-    // Scale XYZ to 0-100 range for consistency with common representations
-    // If Y is expected to be 100 for white, then X and Z should be scaled accordingly.
-    // The coefficients already produce values in a range where Y for white is ~1.0,
-    // so multiplying by 100 makes Y for white = 100.
-    XyzSpace xyz = {
-        x * 100.0,
-        y * 100.0,
-        z * 100.0
-    };
+    XyzSpace xyz = { f.x, f.y, f.z };
     return xyz;
 }
 
-CHIZL_COLORS_API LabSpace XyzToLabEx(XyzSpace xyz, WhitePointType wp)
+static inline LabSpaceF LabToF(LabSpace lab)
+{
+    LabSpaceF f = { (float)lab.l, (float)lab.a, (float)lab.b };
+    return f;
+}
+
+static inline LabSpace LabFromF(LabSpaceF f)
+{
+    LabSpace lab = { f.l, f.a, f.b };
+    return lab;
+}
+
+CHIZL_COLORS_API XyzSpaceF RgbToXyzF(RgbColor rgb)
+{
+    return XyzToF(RgbToXyz_Core(rgb, SrgbLinearTable()));
+}
+
+CHIZL_COLORS_API LabSpaceF RgbToLabF(RgbColor rgb)
+{
+    return LabToF(XyzToLab_White(RgbToXyz_Core(rgb, SrgbLinearTable()), WP_D65_FULL));
+}
+
+CHIZL_COLORS_API RgbColor XyzFToRgb(XyzSpaceF xyz)
+{
+    return XyzToRgb_Core(XyzFromF(xyz));
+}
+
+CHIZL_COLORS_API RgbColor LabFToRgb(LabSpaceF lab)
+{
+    return XyzToRgb_Core(LabToXyz_White(LabFromF(lab), WP_D65_FULL));
+}
+
+CHIZL_COLORS_API size_t RgbToXyzFBatch(const RgbColor* rgb, XyzSpaceF* xyz, size_t count, size_t stride)
+{
+    if (rgb == NULL || xyz == NULL)
+        return 0;
+
+    const double* linear = SrgbLinearTable();
+
+    if (isPackedStride(stride, sizeof(XyzSpaceF)))
+    {
+        for (size_t i = 0; i < count; i++)
+            xyz[i] = XyzToF(RgbToXyz_Core(rgb[i], linear));
+    }
+    else
+    {
+        for (size_t i = 0; i < count; i++)
+            *(XyzSpaceF*)stridedAt(xyz, i, stride, sizeof(XyzSpaceF)) = XyzToF(RgbToXyz_Core(rgb[i], linear));
+    }
+
+    return count;
+}
+
+CHIZL_COLORS_API size_t RgbToLabFBatch(const RgbColor* rgb, LabSpaceF* lab, size_t count, size_t stride)
 {
-    switch (wp)
+    if (rgb == NULL || lab == NULL)
+        return 0;
+
+    // Runs the vectorized double kernel a block at a time into a stack buffer that stays in L1,
+    // then narrows.  The float buffer is the only pass over caller memory.
+    const double* linear = SrgbLinearTable();
+    LabSpace block[256];
+
+    for (size_t done = 0; done < count; )
     {
-    case WPID_D65_FULL:
-        return XyzToLab_White(xyz, WP_D65_FULL);
-    case WPID_D65:
-    default:
-        return XyzToLab_White(xyz, WP_D65);
+        const size_t n = (count - done < 256) ? count - done : 256;
+        RgbToLabKernel(rgb + done, block, n, 0, linear, WP_D65_FULL);
+
+        for (size_t i = 0; i < n; i++)
+            *(LabSpaceF*)stridedAt(lab, done + i, stride, sizeof(LabSpaceF)) = LabToF(block[i]);
+        done += n;
     }
+
+    return count;
 }
 
-CHIZL_COLORS_API LabSpace XyzToLab(XyzSpace xyz)
+CHIZL_COLORS_API size_t XyzFToRgbBatch(const XyzSpaceF* xyz, RgbColor* rgb, size_t count, size_t stride)
 {
-    return XyzToLab_White(xyz, WP_D65_FULL);     // WP_D65_FULL - default, WP_D65 is the other options
+    if (xyz == NULL || rgb == NULL)
+        return 0;
+
+    if (isPackedStride(stride, sizeof(RgbColor)))
+    {
+        for (size_t i = 0; i < count; i++)
+            rgb[i] = XyzToRgb_Core(XyzFromF(xyz[i]));
+    }
+    else
+    {
+        for (size_t i = 0; i < count; i++)
+            *(RgbColor*)stridedAt(rgb, i, stride, sizeof(RgbColor)) = XyzToRgb_Core(XyzFromF(xyz[i]));
+    }
+
+    return count;
+}
+
+CHIZL_COLORS_API size_t LabFToRgbBatch(const LabSpaceF* lab, RgbColor* rgb, size_t count, size_t stride)
+{
+    if (lab == NULL || rgb == NULL)
+        return 0;
+
+    const WhitePoint wp = WP_D65_FULL;     // Same default as RgbToLab
+
+    if (isPackedStride(stride, sizeof(RgbColor)))
+    {
+        for (size_t i = 0; i < count; i++)
+            rgb[i] = XyzToRgb_Core(LabToXyz_White(LabFromF(lab[i]), wp));
+    }
+    else
+    {
+        for (size_t i = 0; i < count; i++)
+            *(RgbColor*)stridedAt(rgb, i, stride, sizeof(RgbColor)) = XyzToRgb_Core(LabToXyz_White(LabFromF(lab[i]), wp));
+    }
+
+    return count;
 }
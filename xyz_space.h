@@ -14,6 +14,7 @@ extern "C" {
 #include "chizl_colors_types.h"
 #include "white_points.h"       // For white point definitions used in XYZ to Lab conversions.
 #include <stdint.h>             // For uint32_t type
+#include <stddef.h>             // For size_t
 
 
 
@@ -48,6 +49,151 @@ CHIZL_COLORS_API LabSpace XyzToLab(XyzSpace xyz);
 /// <returns>The color converted to LAB color space.</returns>
 CHIZL_COLORS_API LabSpace XyzToLabEx(XyzSpace xyz, WhitePointType wp);
 
+/// <summary>
+/// Converts an array of RGB colors to the CIE XYZ color space in a single call.
+/// </summary>
+/// <param name="rgb">Pointer to the first RGB color to convert.</param>
+/// <param name="xyz">Pointer to the first XyzSpace to write.</param>
+/// <param name="count">Number of colors to convert.</param>
+/// <param name="stride">Distance in bytes between output elements, 0 for a tightly packed array.</param>
+/// <returns>The number of colors converted, 0 if either pointer is NULL.</returns>
+CHIZL_COLORS_API size_t RgbToXyzBatch(const RgbColor* rgb, XyzSpace* xyz, size_t count, size_t stride);
+
+/// <summary>
+/// Converts an array of RGB colors to the Lab color space in a single call.<br/>
+/// (Default: WP_D65_FULL white point is used for the conversion.)<br/>
+/// Uses AVX2 or SSE4.1 when available (see ChizlGetSimdLevel), where the cube root is approximated 
+/// to within 1 ULP, so results can differ from RgbToLab by up to 1e-12.
+/// </summary>
+/// <param name="rgb">Pointer to the first RGB color to convert.</param>
+/// <param name="lab">Pointer to the first LabSpace to write.</param>
+/// <param name="count">Number of colors to convert.</param>
+/// <param name="stride">Distance in bytes between output elements, 0 for a tightly packed array.</param>
+/// <returns>The number of colors converted, 0 if either pointer is NULL.</returns>
+CHIZL_COLORS_API size_t RgbToLabBatch(const RgbColor* rgb, LabSpace* lab, size_t count, size_t stride);
+
+/// <summary>
+/// Converts a color from the CIE XYZ color space back to RGB.  Out of gamut colors are clamped to 0-255.
+/// </summary>
+/// <param name="xyz">The color in XYZ color space (0-100 scale) to convert.</param>
+/// <returns>The converted RGB color, alpha is set to 255.</returns>
+CHIZL_COLORS_API RgbColor XyzToRgb(XyzSpace xyz);
+
+/// <summary>
+/// Converts a color from Lab color space back to XYZ color space.<br/>
+/// (Default: WP_D65_FULL white point is used for the conversion.)
+/// </summary>
+/// <param name="lab">The color in Lab color space to convert.</param>
+/// <returns>The color converted to XYZ color space.</returns>
+CHIZL_COLORS_API XyzSpace LabToXyz(LabSpace lab);
+
+/// <summary>
+/// Converts a color from Lab color space back to XYZ color space using a specified white point.
+/// </summary>
+/// <param name="lab">The color in Lab color space to convert.</param>
+/// <param name="wp">The white point type the Lab color was created with.</param>
+/// <returns>The color converted to XYZ color space.</returns>
+CHIZL_COLORS_API XyzSpace LabToXyzEx(LabSpace lab, WhitePointType wp);
+
+/// <summary>
+/// Converts a color from Lab color space back to RGB.  Out of gamut colors are clamped to 0-255.<br/>
+/// (Default: WP_D65_FULL white point is used for the conversion.)
+/// </summary>
+/// <param name="lab">The color in Lab color space to convert.</param>
+/// <returns>The converted RGB color, alpha is set to 255.</returns>
+CHIZL_COLORS_API RgbColor LabToRgb(LabSpace lab);
+
+/// <summary>
+/// Converts an array of XYZ colors back to RGB in a single call.
+/// </summary>
+/// <param name="xyz">Pointer to the first XyzSpace to convert.</param>
+/// <param name="rgb">Pointer to the first RgbColor to write.</param>
+/// <param name="count">Number of colors to convert.</param>
+/// <param name="stride">Distance in bytes between output elements, 0 for a tightly packed array.</param>
+/// <returns>The number of colors converted, 0 if either pointer is NULL.</returns>
+CHIZL_COLORS_API size_t XyzToRgbBatch(const XyzSpace* xyz, RgbColor* rgb, size_t count, size_t stride);
+
+/// <summary>
+/// Converts an array of Lab colors back to RGB in a single call.<br/>
+/// (Default: WP_D65_FULL white point is used for the conversion.)
+/// </summary>
+/// <param name="lab">Pointer to the first LabSpace to convert.</param>
+/// <param name="rgb">Pointer to the first RgbColor to write.</param>
+/// <param name="count">Number of colors to convert.</param>
+/// <param name="stride">Distance in bytes between output elements, 0 for a tightly packed array.</param>
+/// <returns>The number of colors converted, 0 if either pointer is NULL.</returns>
+CHIZL_COLORS_API size_t LabToRgbBatch(const LabSpace* lab, RgbColor* rgb, size_t count, size_t stride);
+
+// --- Float (single precision) variants, see chizl_colors_types.h for accuracy ---
+
+/// <summary>
+/// Float version of RgbToXyz, the double result rounded to float.
+/// </summary>
+/// <param name="rgb">RGB Color</param>
+/// <returns>XyzSpaceF struct</returns>
+CHIZL_COLORS_API XyzSpaceF RgbToXyzF(RgbColor rgb);
+
+/// <summary>
+/// Float version of XyzToRgb.
+/// </summary>
+/// <param name="xyz">XyzSpaceF struct</param>
+/// <returns>RGB Color</returns>
+CHIZL_COLORS_API RgbColor XyzFToRgb(XyzSpaceF xyz);
+
+/// <summary>
+/// Converts an array of RGB colors to XyzSpaceF in a single call.  Half the output memory of RgbToXyzBatch.
+/// </summary>
+/// <param name="rgb">Pointer to the first RGB color to convert.</param>
+/// <param name="xyz">Pointer to the first XyzSpaceF to write.</param>
+/// <param name="count">Number of colors to convert.</param>
+/// <param name="stride">Distance in bytes between output elements, 0 for a tightly packed array.</param>
+/// <returns>The number of colors converted, 0 if either pointer is NULL.</returns>
+CHIZL_COLORS_API size_t RgbToXyzFBatch(const RgbColor* rgb, XyzSpaceF* xyz, size_t count, size_t stride);
+
+/// <summary>
+/// Converts an array of XyzSpaceF colors back to RGB in a single call.
+/// </summary>
+/// <param name="xyz">Pointer to the first XyzSpaceF to convert.</param>
+/// <param name="rgb">Pointer to the first RGB color to write.</param>
+/// <param name="count">Number of colors to convert.</param>
+/// <param name="stride">Distance in bytes between output elements, 0 for a tightly packed array.</param>
+/// <returns>The number of colors converted, 0 if either pointer is NULL.</returns>
+CHIZL_COLORS_API size_t XyzFToRgbBatch(const XyzSpaceF* xyz, RgbColor* rgb, size_t count, size_t stride);
+
+/// <summary>
+/// Float version of RgbToLab, the double result rounded to float.
+/// </summary>
+/// <param name="rgb">RGB Color</param>
+/// <returns>LabSpaceF struct</returns>
+CHIZL_COLORS_API LabSpaceF RgbToLabF(RgbColor rgb);
+
+/// <summary>
+/// Float version of LabToRgb.
+/// </summary>
+/// <param name="lab">LabSpaceF struct</param>
+/// <returns>RGB Color</returns>
+CHIZL_COLORS_API RgbColor LabFToRgb(LabSpaceF lab);
+
+/// <summary>
+/// Converts an array of RGB colors to LabSpaceF in a single call.  Half the output memory of RgbToLabBatch.
+/// </summary>
+/// <param name="rgb">Pointer to the first RGB color to convert.</param>
+/// <param name="lab">Pointer to the first LabSpaceF to write.</param>
+/// <param name="count">Number of colors to convert.</param>
+/// <param name="stride">Distance in bytes between output elements, 0 for a tightly packed array.</param>
+/// <returns>The number of colors converted, 0 if either pointer is NULL.</returns>
+CHIZL_COLORS_API size_t RgbToLabFBatch(const RgbColor* rgb, LabSpaceF* lab, size_t count, size_t stride);
+
+/// <summary>
+/// Converts an array of LabSpaceF colors back to RGB in a single call.
+/// </summary>
+/// <param name="lab">Pointer to the first LabSpaceF to convert.</param>
+/// <param name="rgb">Pointer to the first RGB color to write.</param>
+/// <param name="count">Number of colors to convert.</param>
+/// <param name="stride">Distance in bytes between output elements, 0 for a tightly packed array.</param>
+/// <returns>The number of colors converted, 0 if either pointer is NULL.</returns>
+CHIZL_COLORS_API size_t LabFToRgbBatch(const LabSpaceF* lab, RgbColor* rgb, size_t count, size_t stride);
+
 // --- End of "extern C" block ---
 #ifdef __cplusplus
 }